@@ -33,18 +33,27 @@
  */
 
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
 
 #include "applications/sdfgraph.hpp"
 #include "platform/platform.hpp"
 #include "system/mapping.hpp"
+#include "system/instance.hpp"
 //#include "cp_model/model.hpp"
 #include "cp_model/sdf_pr_online_model.hpp"
 #include "presolving/oneProcMappings.hpp"
 #include "execution/execution.cpp"
+#include "execution/decomposition.hpp"
 #include "presolving/presolver.cpp"
+#include "presolving/actorClustering.hpp"
 #include "settings/input_reader.hpp"
 #include "cp_model/schedulability.hpp"
 #include "validation/validation.hpp"
+#include "validation/evaluator.hpp"
 
 #include "metaheuristic/swarm.hpp"
 #include "metaheuristic/ga_population.hpp"
@@ -56,6 +65,111 @@
 using namespace Gecode;
 using namespace Int;
 
+/**
+ * Reads the XML inputs of a run into instance. Every SDF3 file is parsed,
+ * transformed and closed (path matrix) by a pool of worker threads, while
+ * the taskset, platform, WCET and design constraint files are read by
+ * separate tasks in parallel. The graphs keep the order of inputs_paths.
+ * @return the design constraints document, needed by the Applications object
+ */
+shared_ptr<XMLdoc> loadXMLInputs(Config& cfg, CompiledInstance& instance) {
+  typedef chrono::steady_clock timer;
+  auto msSince = [](timer::time_point start) {
+    return tools::toString(chrono::duration_cast<chrono::milliseconds>(timer::now() - start).count()) + " ms";
+  };
+  const auto start = timer::now();
+
+  string taskset_path, platform_path, WCET_path, desConst_path;
+  vector<string> sdf_paths;
+  for (const auto& path : cfg.settings().inputs_paths) {
+    if (path.find("taskset") != string::npos)
+      taskset_path = path;
+    if (path.find("platform") != string::npos)
+      platform_path = path;
+    if (path.find("WCETs") != string::npos)
+      WCET_path = path;
+    if (path.find("desConst") != string::npos)
+      desConst_path = path;
+    if (path.find("/sdfs/") != string::npos)
+      sdf_paths.push_back(path);
+  }
+
+  //libxml2 has to be initialized once before it is used from several threads
+  xmlInitParser();
+
+  auto taskset = async(launch::async, [&]() -> TaskSet* {
+    if (taskset_path.empty())
+      return nullptr;
+    const auto t0 = timer::now();
+    XMLdoc xml(taskset_path);
+    xml.read(false);
+    TaskSet* ts = new TaskSet(xml);
+    if (ts->getNumberOfTasks() > 0)
+      ts->SetRMPriorities();
+    LOG_INFO("Parsed the taskset in " + msSince(t0));
+    return ts;
+  });
+  auto platform = async(launch::async, [&]() -> Platform* {
+    const auto t0 = timer::now();
+    XMLdoc xml(platform_path);
+    xml.read(false);
+    Platform* p = new Platform(xml);
+    LOG_INFO("Parsed the platform in " + msSince(t0));
+    return p;
+  });
+  auto wcets = async(launch::async, [&]() {
+    const auto t0 = timer::now();
+    XMLdoc xml(WCET_path);
+    xml.read(false);
+    vector<Mapping::WCETEntry> entries = Mapping::readWCETs(xml);
+    LOG_INFO("Parsed the WCETs in " + msSince(t0));
+    return entries;
+  });
+  auto desConst = async(launch::async, [&]() {
+    const auto t0 = timer::now();
+    shared_ptr<XMLdoc> xml = make_shared<XMLdoc>(desConst_path);
+    xml->read(false);
+    LOG_INFO("Parsed the design constraints in " + msSince(t0));
+    return xml;
+  });
+
+  vector<SDFGraph*> graphs(sdf_paths.size(), nullptr);
+  vector<exception_ptr> errors(sdf_paths.size());
+  atomic<size_t> next(0);
+  const size_t n_workers = min<size_t>(sdf_paths.size(), max(1u, thread::hardware_concurrency()));
+  vector<thread> workers;
+  for (size_t w = 0; w < n_workers; w++) {
+    workers.emplace_back([&]() {
+      for (size_t i = next++; i < sdf_paths.size(); i = next++) {
+        try {
+          const auto t0 = timer::now();
+          XMLdoc xml(sdf_paths[i]);
+          xml.readXSD("sdf3", "noNamespaceSchemaLocation");
+          graphs[i] = new SDFGraph(xml, cfg.settings().max_unfolding);
+          LOG_INFO("Parsed and transformed " + sdf_paths[i] + " in " + msSince(t0));
+        } catch (...) {
+          errors[i] = current_exception();
+        }
+      }
+    });
+  }
+  for (auto& worker : workers)
+    worker.join();
+  LOG_INFO("Loaded " + tools::toString(sdf_paths.size()) + " SDF graphs on "
+           + tools::toString(n_workers) + " threads in " + msSince(start));
+
+  instance.taskset = taskset.get();
+  instance.platform = platform.get();
+  instance.wcets = wcets.get();
+  shared_ptr<XMLdoc> xml_const = desConst.get();
+  for (auto& error : errors) {
+    if (error)
+      rethrow_exception(error);
+  }
+  instance.sdfs = graphs;
+  LOG_INFO("Loaded all XML inputs in " + msSince(start));
+  return xml_const;
+}
 
 int main(int argc, const char* argv[]) {
 
@@ -74,79 +188,101 @@ int main(int argc, const char* argv[]) {
 
   try {
 	  
-	  TaskSet* taskset;
-	  Platform* platform;
-	  string WCET_path;
-	  string desConst_path;
-	  for (const auto& path : cfg.settings().inputs_paths) {
-       /// Reading taskset
-       size_t found_taskset=path.find("taskset");
-       if(found_taskset != string::npos){
-			XMLdoc xml(path);
-			LOG_INFO("Parsing taskset XML files...");
-			xml.read(false);
-			taskset =  new TaskSet(xml);
-			if (taskset->getNumberOfTasks() > 0) {
-			  taskset->SetRMPriorities();
-			  cout << *taskset;
-			} else {
-			  cout << "did not import any periodic tasks!" << endl;
-			}
-	   }
-	   /// Reading platform
-       size_t found_platform=path.find("platform");
-       if(found_platform != string::npos){
-			XMLdoc xml(path);
-			LOG_INFO("Parsing platform XML files...");
-			xml.read(false);
-			platform =  new Platform(xml);
-			cout << *platform << endl;
-	   }
-	   /// Storing WCET xml path
-       size_t found_wcet=path.find("WCETs");
-       if(found_wcet != string::npos){
-		   WCET_path = path;
-			LOG_INFO("Storing WCET XML file...");
-	   }
-	   /// Storing design constraints xml path
-       size_t found_desConst=path.find("desConst");
-       if(found_desConst != string::npos){
-		   desConst_path = path;
-			LOG_INFO("Storing desConst XML file...");
-	   }
-     }
-	
-    
-    vector<SDFGraph*> sdfs;
+    CompiledInstance instance;
+    vector<SDFGraph*>& sdfs = instance.sdfs;
+    TaskSet*& taskset = instance.taskset;
+    Platform*& platform = instance.platform;
+    Applications* appset;
+
+    string compiled_path;
     for (const auto& path : cfg.settings().inputs_paths) {
-		 
-       if(path.find("/sdfs/") != string::npos){		
-           XMLdoc xml(path);
-           LOG_INFO("Parsing SDF3 graphs...");
-           xml.readXSD("sdf3", "noNamespaceSchemaLocation");
-           sdfs.push_back(new SDFGraph(xml));
-       }
-     }
-    /*for(auto &i : sdfXMLs)
-     sdfs.push_back(new SDFGraph(i));*/
+       if(path.size() > 4 && path.compare(path.size()-4, 4, ".dsy") == 0)
+           compiled_path = path;
+    }
+
+    if(!compiled_path.empty())
+    {
+        LOG_INFO("Loading the compiled instance " + compiled_path + " (XML inputs are ignored) ...");
+        instance.read(compiled_path);
+        cout << *platform << endl;
+        LOG_INFO("Creating an application object ... ");
+        //the design constraints are part of the compiled graphs
+        appset = new Applications(sdfs, vector<DesignConstraints*>(), taskset);
+    }
+    else
+    {
+	shared_ptr<XMLdoc> xml_const = loadXMLInputs(cfg, instance);
+	if (taskset && taskset->getNumberOfTasks() > 0) {
+	  cout << *taskset;
+	} else {
+	  cout << "did not import any periodic tasks!" << endl;
+	}
+	cout << *platform << endl;
 
-    
-	XMLdoc xml_const(desConst_path);
-	xml_const.read(false);
     LOG_INFO("Creating an application object ... ");
-    Applications* appset = new Applications(sdfs, taskset, xml_const);
+    appset = new Applications(sdfs, taskset, *xml_const);
+    }
     cout << *appset;
 
 	LOG_INFO("Creating a mapping object ... " );
-    XMLdoc xml_wcet(WCET_path);
-    xml_wcet.read(false);
-    Mapping* map = new Mapping(appset, platform, xml_wcet);
+    Mapping* map = new Mapping(appset, platform, instance.wcets);
     
     LOG_INFO("Sorting pr tasks based on utilization ... ");
     //map->PrintWCETs();
     map->SortTasksUtilization();
     cout << *taskset;
 
+    if(cfg.settings().compile)
+    {
+        string instance_path = cfg.settings().output_path + "out/instance.dsy";
+        instance.write(instance_path);
+        cout << "Compiled instance written to " << instance_path << endl;
+        return exit_status;
+    }
+
+    if(!cfg.settings().evaluate_path.empty())
+    {
+        LOG_INFO("Evaluating the designs in " + cfg.settings().evaluate_path + " ... ");
+        BatchEvaluator evaluator(map, cfg);
+        evaluator.run(cfg.settings().evaluate_path);
+        return exit_status;
+    }
+
+    //with presolver.clustering, the exploration runs on clustered copies of the
+    //graphs and its solutions are expanded back to the unclustered fullMap
+    unique_ptr<ActorClustering> clustering;
+    Mapping* fullMap = map;
+    vector<SDFGraph*> explored = sdfs;
+    //only the CP exploration expands its solutions, GA, PSO and the decomposed
+    //exploration would print designs of the clustered actors
+    bool expandable = cfg.settings().search != Config::GA && cfg.settings().search != Config::PSO
+                      && !cfg.settings().decompose;
+    if(cfg.settings().pre_clustering && sdfs.size() > 0 && !expandable)
+    {
+        LOG_WARNING("presolver.clustering is only supported by the CP search without dse.decompose, exploring the unclustered graphs.");
+    }
+    else if(cfg.settings().pre_clustering && sdfs.size() > 0)
+    {
+        LOG_INFO("Clustering actors ... ");
+        clustering.reset(new ActorClustering(map, cfg));
+        vector<SDFGraph*> clustered;
+        for(auto sdf : sdfs)
+            clustered.push_back(new SDFGraph(*sdf));
+        if(clustering->apply(clustered))
+        {
+            //owns the clustered copies
+            explored = clustered;
+            appset = new Applications(clustered, vector<DesignConstraints*>(), taskset);
+            map = new Mapping(appset, platform, instance.wcets);
+            map->SortTasksUtilization();
+        }
+        else
+        {
+            for(auto sdf : clustered)
+                delete sdf;
+            clustering.reset();
+        }
+    }
     
 //Testing the design class --------------------------------------------
 /*
@@ -191,8 +327,8 @@ int main(int argc, const char* argv[]) {
     if(cfg.settings().search == Config::GA)
     {
        
-        shared_ptr<Mapping> map_ptr(new Mapping(appset, platform, xml_wcet));
-        shared_ptr<Applications> appset_ptr(new Applications(sdfs, taskset, xml_const));
+        shared_ptr<Mapping> map_ptr(new Mapping(appset, platform, instance.wcets));
+        shared_ptr<Applications> appset_ptr(new Applications(explored, vector<DesignConstraints*>(), taskset));
 
         
         GA_Population p(map_ptr, appset_ptr, cfg);
@@ -203,8 +339,8 @@ int main(int argc, const char* argv[]) {
     if(cfg.settings().search == Config::PSO)
     {
        
-        shared_ptr<Mapping> map_ptr(new Mapping(appset, platform, xml_wcet));
-        shared_ptr<Applications> appset_ptr(new Applications(sdfs, taskset, xml_const));
+        shared_ptr<Mapping> map_ptr(new Mapping(appset, platform, instance.wcets));
+        shared_ptr<Applications> appset_ptr(new Applications(explored, vector<DesignConstraints*>(), taskset));
 
         
         Swarm s(map_ptr, appset_ptr, cfg);
@@ -213,6 +349,37 @@ int main(int argc, const char* argv[]) {
     }
 
 
+    if(cfg.settings().render)
+    {
+        LOG_INFO("Rendering the solution log ... ");
+        //the log holds the expanded designs
+        SDFPROnlineModel* model = new SDFPROnlineModel(fullMap, &cfg);
+        Execution<SDFPROnlineModel> execObj(model, cfg);
+        execObj.Render();
+        return exit_status;
+    }
+
+    if(cfg.settings().decompose && sdfs.size() > 0)
+    {
+        LOG_INFO("Partitioning the applications into independent groups ... ");
+        Decomposition decomposition(map, instance.wcets, cfg);
+        if(decomposition.getGroups().size() > 1)
+        {
+            LOG_INFO("Running the decomposed exploration ... ");
+            decomposition.run();
+            return exit_status;
+        }
+        cout << "No independent applications, exploring all of them in one model." << endl;
+    }
+
+    //before presolving, which constrains the models built afterwards
+    SDFPROnlineModel* fullModel = nullptr;
+    if(clustering)
+    {
+        LOG_INFO("Creating the unclustered constraint model object ... ");
+        fullModel = new SDFPROnlineModel(fullMap, &cfg);
+    }
+
     SDFPROnlineModel* model;
     //PRESOLVING +++
 
@@ -237,6 +404,8 @@ int main(int argc, const char* argv[]) {
     }
     LOG_INFO("Creating an execution object ... ");
     Execution<SDFPROnlineModel> execObj(model, cfg);
+    if(fullModel)
+        execObj.expandClusters(fullModel, clustering.get());
 
     LOG_INFO("Running the model object ... ");
     execObj.Execute();
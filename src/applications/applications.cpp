@@ -10,8 +10,9 @@ Applications::Applications() {
 }
 
 Applications::~Applications() {
-  for (size_t i=0; i<sdfApps.size(); i++)
-    delete sdfApps[i];
+  if (ownsGraphs)
+    for (size_t i=0; i<sdfApps.size(); i++)
+      delete sdfApps[i];
   for (size_t i=0; i<desContr.size(); i++)
     delete desContr[i];
 }
@@ -31,6 +32,7 @@ Applications::Applications(vector<SDFGraph*> _sdfApps, TaskSet* _iptApps, XMLdoc
   
   n_iptTasks = iptApps->getNumberOfTasks();
   all_channels = getChannels();
+  buildIndex();
   load_const(xml);
 }
 void Applications::load_const(XMLdoc& xml)
@@ -78,6 +80,7 @@ Applications::Applications(vector<SDFGraph*> _sdfApps, vector<DesignConstraints*
   
   n_iptTasks = iptApps->getNumberOfTasks();
   all_channels = getChannels();
+  buildIndex();
   }
 
 Applications::Applications(vector<SDFGraph*> _sdfApps, vector<DesignConstraints*> _desContr)
@@ -94,6 +97,7 @@ Applications::Applications(vector<SDFGraph*> _sdfApps, vector<DesignConstraints*
   }
   
   n_iptTasks = 0; 
+  buildIndex();
 }
 
 Applications::Applications(TaskSet* _iptApps)
@@ -105,6 +109,71 @@ Applications::Applications(TaskSet* _iptApps)
   n_iptTasks = iptApps->getNumberOfTasks();
 }
 
+Applications::Applications(Applications* parent, const vector<size_t>& graphs)
+  : iptApps(parent->iptApps), ownsGraphs(false) {
+
+  n_sdfActors       = 0;
+  n_sdfParentActors = 0;
+  n_sdfChannels     = 0;
+  for (size_t g : graphs){
+    sdfApps.push_back(parent->sdfApps[g]);
+    offsets.push_back(n_sdfActors);
+    n_sdfActors += parent->sdfApps[g]->n_actors();
+    n_sdfParentActors += parent->sdfApps[g]->n_parentActors();
+    n_sdfChannels += parent->sdfApps[g]->n_channels();
+  }
+
+  n_iptTasks = iptApps->getNumberOfTasks();
+  all_channels = getChannels();
+  buildIndex();
+}
+
+void Applications::buildIndex(){
+  graphOf.assign(n_sdfActors, 0);
+  succOffsets.assign(n_sdfActors+1, 0);
+  predOffsets.assign(n_sdfActors+1, 0);
+  channelTokens.clear();
+  for (size_t app=0; app<sdfApps.size(); app++){
+    for (int a=0; a<sdfApps[app]->n_actors(); a++)
+      graphOf[offsets[app]+a] = app;
+    for (auto ch : sdfApps[app]->getChannels()){
+      size_t src = offsets[app]+ch->source;
+      size_t dst = offsets[app]+ch->destination;
+      channelTokens.insert(make_pair(src*n_sdfActors+dst, ch->initTokens));
+    }
+  }
+
+  for (size_t id=0; id<n_sdfActors; id++){
+    size_t app = graphOf[id];
+    succOffsets[id+1] = succOffsets[id] + sdfApps[app]->successorIds(id-offsets[app]).size();
+    predOffsets[id+1] = predOffsets[id] + sdfApps[app]->predecessorIds(id-offsets[app]).size();
+  }
+  succIds.clear();
+  predIds.clear();
+  for (size_t id=0; id<n_sdfActors; id++){
+    size_t app = graphOf[id];
+    for (int a : sdfApps[app]->successorIds(id-offsets[app]))
+      succIds.push_back(a+offsets[app]);
+    for (int a : sdfApps[app]->predecessorIds(id-offsets[app]))
+      predIds.push_back(a+offsets[app]);
+  }
+
+  //dependencies only exist within an application
+  depWords = (n_sdfActors+63)/64;
+  dependency.assign(n_sdfActors*depWords, 0);
+  for (size_t app=0; app<sdfApps.size(); app++){
+    int n = sdfApps[app]->n_actors();
+    for (int i=0; i<n; i++){
+      for (int j=0; j<n; j++){
+        if (sdfApps[app]->precedes(i, j)){
+          size_t id1 = offsets[app]+j;
+          dependency[(offsets[app]+i)*depWords + id1/64] |= uint64_t(1) << (id1%64);
+        }
+      }
+    }
+  }
+}
+
 //Does id belong to an IPT task?
 bool Applications::isIPT(size_t id){
   return (id >= n_sdfActors && id < n_sdfActors+n_iptTasks);
@@ -117,17 +186,10 @@ bool Applications::isSDF(size_t id){
 
 //Is id1 dependent on id0?
 bool Applications::dependsOn(size_t id0, size_t id1){
-  if(isIPT(id0) || isIPT(id1)){
+  if(!isSDF(id0) || !isSDF(id1)){
     return false;
-  }else{ //TODO add later: if id0 and id1 are sdf, but in different applications
-    int app0 = getSDFGraph(id0);
-    int app1 = getSDFGraph(id1); 
-    if(app0 != app1){
-      return false;
-    }else{
-      return sdfApps[app0]->precedes(id0-offsets[app0], id1-offsets[app0]);
-    }
   }
+  return (dependency[id0*depWords + id1/64] >> (id1%64)) & 1;
 }
 
 
@@ -158,6 +220,14 @@ std::string Applications::getType(size_t id) {
   return "";
 }
 
+std::vector<std::string> Applications::getTypes(size_t id) {
+  if(isSDF(id)){
+    size_t app = getSDFGraph(id);
+    return sdfApps[app]->getMembers(id-offsets[app]);
+  }
+  return vector<std::string>(1, getType(id));
+}
+
 // Gives the name of the actor
 std::string Applications::getParentActorName(size_t id){
   if(isIPT(id)) { 
@@ -173,6 +243,15 @@ std::string Applications::getParentActorName(size_t id){
   return name;
 }
 
+// Gives the number of firings of the parent actor executed by the entity
+size_t Applications::getFirings(size_t id){
+  if(isSDF(id)){
+    size_t app = getSDFGraph(id);
+    return sdfApps[app]->getFirings(id-offsets[app]);
+  }
+  return 1;
+}
+
 // Gives the name of the graph
 std::string Applications::getGraphName(size_t g_id){
   std::string name;
@@ -369,10 +448,7 @@ SolutionMode Applications::getConstrType(size_t g_id){
 //get index of the SDFG that actor id belongs to
 size_t Applications::getSDFGraph(size_t id){
   if(isSDF(id)){
-    for (size_t i=0; i<offsets.size()-1; i++){
-      if(id<offsets[i+1]) return i;
-    }
-    if(id<offsets.back()+sdfApps.back()->n_actors()) return offsets.size()-1;
+    return graphOf[id];
   }
   return -1;
 }
@@ -409,28 +485,32 @@ int Applications::getLastFiring(size_t id){
 
 //get a list of predecessors of program entity id
 vector<int> Applications::getPredecessors(size_t id){
-  vector<int> preds;
   if(isSDF(id)){
-    int app = getSDFGraph(id);
-    vector<SDFActor*> _preds = sdfApps[app]->getPredecessors(id-offsets[app]);
-    for (size_t i=0; i<_preds.size(); i++){
-      preds.push_back(_preds[i]->id+offsets[app]);
-    }
+    return vector<int>(predIds.begin()+predOffsets[id], predIds.begin()+predOffsets[id+1]);
   }
-  return preds;
+  return vector<int>();
 }
 
 //get a list of successors of program entity id
 vector<int> Applications::getSuccessors(size_t id){
-  vector<int> succs;
   if(isSDF(id)){
-    int app = getSDFGraph(id);
-    vector<SDFActor*> _succs = sdfApps[app]->getSuccessors(id-offsets[app]);
-    for (size_t i=0; i<_succs.size(); i++){
-      succs.push_back(_succs[i]->id+offsets[app]);
-    }
+    return vector<int>(succIds.begin()+succOffsets[id], succIds.begin()+succOffsets[id+1]);
+  }
+  return vector<int>();
+}
+
+tools::ArrayView<int> Applications::predecessorIds(size_t id) const{
+  if(id < n_sdfActors){
+    return tools::ArrayView<int>(predIds.data()+predOffsets[id], predIds.data()+predOffsets[id+1]);
   }
-  return succs;
+  return tools::ArrayView<int>();
+}
+
+tools::ArrayView<int> Applications::successorIds(size_t id) const{
+  if(id < n_sdfActors){
+    return tools::ArrayView<int>(succIds.data()+succOffsets[id], succIds.data()+succOffsets[id+1]);
+  }
+  return tools::ArrayView<int>();
 }
 
 //get the list of channels in the program 
@@ -489,13 +569,11 @@ size_t Applications::getTokenSize(size_t id) {
 //get the number of initial tokens on a channel from src to dst
 int Applications::getTokensOnChannel(int src, int dst) {
   if(isSDF(src)&&isSDF(dst)){
-    int srcApp = getSDFGraph(src);
-    int dstApp = getSDFGraph(dst);
-    if(srcApp == dstApp){
-      return sdfApps[srcApp]->tokensOnChannel(src-offsets[srcApp], dst-offsets[dstApp]);
-    }else{
-      return 0;	
+    if(graphOf[src] != graphOf[dst]){
+      return 0;
     }
+    auto it = channelTokens.find(src*n_sdfActors+dst);
+    return it == channelTokens.end() ? -1 : it->second;
   }
   return 0;
 }
@@ -503,13 +581,7 @@ int Applications::getTokensOnChannel(int src, int dst) {
 //does a channel from src to destination exist?
 bool Applications::channelExists(int src, int dst) {
   if(isSDF(src)&&isSDF(dst)){
-    int srcApp = getSDFGraph(src);
-    int dstApp = getSDFGraph(dst);
-    if(srcApp == dstApp){
-      return sdfApps[srcApp]->channelExists(src-offsets[srcApp], dst-offsets[dstApp]);
-    }else{
-      return false;
-    }
+    return channelTokens.count(src*n_sdfActors+dst) > 0;
   }
   return false;
 }
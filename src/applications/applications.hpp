@@ -31,6 +31,7 @@
 #include <math.h>
 #include <iostream>
 #include <vector>
+#include <cstdint>
 
 #include "sdfgraph.hpp" 
 #include "pr_taskset.hpp" 
@@ -55,6 +56,18 @@ protected:
   size_t n_iptTasks;
   
   vector<SDFChannel*> all_channels;/** pointer to all channels of all sdf apps. */
+  bool ownsGraphs = true;          /** false if the graphs belong to another Applications object. */
+
+  //index over the global actor ids, built once the graphs are loaded
+  vector<size_t> graphOf;                  /** graph of each sdf actor. */
+  vector<int> succOffsets, succIds;        /** successors (no initial tokens) of id: succIds[succOffsets[id]..succOffsets[id+1]-1]. */
+  vector<int> predOffsets, predIds;        /** predecessors (no initial tokens), as succOffsets/succIds. */
+  unordered_map<size_t, int> channelTokens;/** initial tokens on the first channel src->dst, keyed by src*n_sdfActors+dst. */
+  vector<uint64_t> dependency;             /** bit id0*depWords*64+id1 set iff id1 depends on id0. */
+  size_t depWords = 0;                     /** 64-bit words per row of dependency. */
+
+  //builds graphOf, the adjacency arrays, channelTokens and dependency
+  void buildIndex();
 
 public:
   Applications();
@@ -63,6 +76,11 @@ public:
   Applications(vector<SDFGraph*> _sdfApps, vector<DesignConstraints*> _desContr, TaskSet* _iptApps);
   Applications(vector<SDFGraph*> _sdfApps, vector<DesignConstraints*> _desContr);
   Applications(TaskSet* _iptApps);
+  /**
+   * Subset of the SDF applications of parent, in the order of graphs.
+   * The graphs and the task set stay owned by parent.
+   */
+  Applications(Applications* parent, const vector<size_t>& graphs);
 
   //Does id belong to an IPT task?
   bool isIPT(size_t id);
@@ -74,8 +92,12 @@ public:
   std::string getName(size_t id);
   // Gives the type of the program entity id
   std::string getType(size_t id);
+  // Gives the types executed by program entity id, one per member of a clustered actor
+  vector<std::string> getTypes(size_t id);
   // Gives the name of the parent actor
   std::string getParentActorName(size_t id);
+  // Gives the number of parent-actor firings executed by program entity id (1 for IPT tasks)
+  size_t getFirings(size_t id);
   // Gives the name of the graph
   std::string getGraphName(size_t g_id);
 
@@ -143,6 +165,10 @@ public:
   vector<int> getPredecessors(size_t id);
   //get a list of successors of program entity id
   vector<int> getSuccessors(size_t id);
+  //predecessors of program entity id without copying them (empty if not an SDF actor)
+  tools::ArrayView<int> predecessorIds(size_t id) const;
+  //successors of program entity id without copying them (empty if not an SDF actor)
+  tools::ArrayView<int> successorIds(size_t id) const;
 
   //get the list of channels in the application appId 
   vector<SDFChannel*> getChannels(int appId);
@@ -30,6 +30,7 @@
 
 CPP_FILES := applications.cpp \
              sdfgraph.cpp \
+             sdfgraphbuilder.cpp \
              pr_taskset.cpp \
              pr_task.cpp \
              flexperiodictasks.cpp
@@ -19,6 +19,47 @@ TaskSet::TaskSet(XMLdoc& xml)
 	load_xml(xml);
 }
 
+TaskSet::TaskSet(tools::BinaryReader& in)
+  : Scheduler(FP)
+{
+	uint64_t n = in.get<uint64_t>();
+	for(uint64_t i=0; i<n && in.good(); i++)
+	{
+		int phase    = in.get<int32_t>();
+		int period   = in.get<int32_t>();
+		int deadline = in.get<int32_t>();
+		int memCons  = in.get<int32_t>();
+		int codeSize = in.get<int32_t>();
+		int priority = in.get<int32_t>();
+		string name  = in.getString();
+		string type  = in.getString();
+		int id       = in.get<int32_t>();
+		PeriodicTask* pr_task = new PeriodicTask(phase, period, deadline, memCons, codeSize, priority, name, type, id);
+		pr_task->preemtable = in.get<uint8_t>();
+		tasks.push_back(pr_task);
+	}
+	if (!in.good())
+		THROW_EXCEPTION(InvalidFormatException, "compiled taskset is truncated");
+}
+
+void TaskSet::write(tools::BinaryWriter& out) const
+{
+	out.put<uint64_t>(tasks.size());
+	for (auto t : tasks)
+	{
+		out.put<int32_t>(t->phase);
+		out.put<int32_t>(t->period);
+		out.put<int32_t>(t->deadline);
+		out.put<int32_t>(t->memCons);
+		out.put<int32_t>(t->codeSize);
+		out.put<int32_t>(t->priority);
+		out.putString(t->name);
+		out.putString(t->type);
+		out.put<int32_t>(t->id);
+		out.put<uint8_t>(t->preemtable);
+	}
+}
+
 TaskSet::~TaskSet() {
   for (size_t i=0;i<tasks.size();i++)
     delete tasks[i];
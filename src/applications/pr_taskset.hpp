@@ -25,6 +25,7 @@
  */
 #include "pr_task.hpp"
 #include "../xml/xmldoc.hpp"
+#include "../tools/binaryio.hpp"
 
 using namespace std;
 
@@ -44,6 +45,14 @@ public:
     ~TaskSet();
     TaskSet(vector<PeriodicTask*> _tasks);
     TaskSet(XMLdoc& doc);
+    /**
+     * Restores a taskset saved with write()
+     */
+    TaskSet(tools::BinaryReader& in);
+    /**
+     * Saves the tasks for a compiled problem instance
+     */
+    void write(tools::BinaryWriter& out) const;
     SchedulingAlgorith Scheduler;
 
     int getNumberOfTasks();
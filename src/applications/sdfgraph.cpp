@@ -3,28 +3,260 @@
 #include <math.h>
 #include <algorithm>
 
-SDFGraph::SDFGraph(XMLdoc& xmlAppGraph) : xml(xmlAppGraph) {
+namespace {
+  /**
+   * Transitive closure (paths of length >= 1) of the graph with n vertices
+   * and the given edges. The strongly connected components are found with
+   * Tarjan's algorithm, which emits them sinks first, so each component
+   * row is the union of the rows and members of its successor components,
+   * 64 vertices per word. compOf maps each vertex to its row in reach.
+   */
+  void bitClosure(size_t n, const vector<pair<int,int>>& edges,
+                  vector<int>& compOf, vector<uint64_t>& reach, size_t words) {
+    vector<vector<int>> succ(n);
+    for (auto& e : edges)
+      succ[e.first].push_back(e.second);
+
+    //iterative Tarjan
+    compOf.assign(n, -1);
+    vector<int> index(n, -1), low(n, 0), stack;
+    vector<char> onStack(n, 0);
+    vector<vector<int>> comps;
+    vector<pair<int,size_t>> call;
+    int counter = 0;
+    for (size_t root = 0; root < n; root++) {
+      if (index[root] >= 0)
+        continue;
+      call.push_back(make_pair((int)root, 0));
+      while (!call.empty()) {
+        int v = call.back().first;
+        size_t& it = call.back().second;
+        if (it == 0 && index[v] < 0) {
+          index[v] = low[v] = counter++;
+          stack.push_back(v);
+          onStack[v] = 1;
+        }
+        if (it < succ[v].size()) {
+          int w = succ[v][it++];
+          if (index[w] < 0)
+            call.push_back(make_pair(w, 0));
+          else if (onStack[w])
+            low[v] = min(low[v], index[w]);
+          continue;
+        }
+        if (low[v] == index[v]) {
+          vector<int> comp;
+          int w;
+          do {
+            w = stack.back();
+            stack.pop_back();
+            onStack[w] = 0;
+            compOf[w] = comps.size();
+            comp.push_back(w);
+          } while (w != v);
+          comps.push_back(comp);
+        }
+        call.pop_back();
+        if (!call.empty()) {
+          int u = call.back().first;
+          low[u] = min(low[u], low[v]);
+        }
+      }
+    }
+
+    reach.assign(comps.size() * words, 0);
+    for (size_t c = 0; c < comps.size(); c++) {
+      uint64_t* row = &reach[c * words];
+      bool cyclic = comps[c].size() > 1;
+      for (int v : comps[c]) {
+        for (int w : succ[v]) {
+          size_t d = compOf[w];
+          if (d == c) {
+            cyclic = true;
+            continue;
+          }
+          //successor components were completed before c
+          const uint64_t* succRow = &reach[d * words];
+          for (size_t k = 0; k < words; k++)
+            row[k] |= succRow[k];
+          row[w / 64] |= uint64_t(1) << (w % 64);
+        }
+      }
+      if (cyclic) {
+        for (int v : comps[c])
+          row[v / 64] |= uint64_t(1) << (v % 64);
+      }
+    }
+  }
+}
+
+SDFGraph::SDFGraph(XMLdoc& xmlAppGraph, size_t _maxUnfolding) : xml(&xmlAppGraph) {
   
   //Initializations
   parentActors 	     = 0;
+  maxUnfolding       = _maxUnfolding;
   period_constraint  = 0;
   latency_constraint = 0;
 
-  graphName = xml.xpathStrings("///sdf/@name")[0];
+  graphName = xml->xpathStrings("///sdf/@name")[0];
   LOG_INFO("Parsing application " + graphName + "...");
 
   _d = new dictionaries();
   buildDictionaries();
+  build();
+  xml = nullptr;
+}
+
+SDFGraph::SDFGraph(const SDFGraphBuilder& graph, size_t _maxUnfolding) : xml(nullptr) {
+  parentActors       = 0;
+  maxUnfolding       = _maxUnfolding;
+  period_constraint  = graph.getPeriodConstraint();
+  latency_constraint = graph.getLatencyConstraint();
+
+  graphName = graph.getName();
+  LOG_INFO("Building application " + graphName + "...");
+
+  _d = new dictionaries();
+  for (const auto& a : graph.getActors()){
+    _d->actor_id[a.name] = _d->actors.size();
+    _d->actor_sz[a.name] = a.stateSize;
+    _d->actors.push_back(a.name);
+  }
+  //each channel gets its own pair of ports
+  for (const auto& c : graph.getChannels()){
+    string src_prt = c.name + "_out";
+    string dst_prt = c.name + "_in";
+    _d->rate[c.src][src_prt]    = c.prod;
+    _d->rate[c.dst][dst_prt]    = c.cons;
+    _d->channel[c.src][src_prt] = c.name;
+    _d->channel[c.dst][dst_prt] = c.name;
+    _d->chan_con[c.name] = {c.src, src_prt, c.dst, dst_prt};
+    _d->chan_sz[c.name]  = c.tokenSize;
+    _d->init_tok[c.name] = c.initTokens;
+    _d->channels.push_back(c.name);
+  }
+  build();
+}
+
+void SDFGraph::build() {
   transform();
   createPathMatrix();
+  buildAdjacency();
   set_root_actors();
-  
-  
-  if (_d) delete _d;
+
+  delete _d;
+  _d = nullptr;
 
   LOG_DEBUG("SDFGraph intermediate representation built successfully");
   //LOG_DEBUG(getString());
+}
+
+SDFGraph::SDFGraph(tools::BinaryReader& in) : _d(nullptr), xml(nullptr) {
+  graphName          = in.getString();
+  parentActors       = in.get<uint64_t>();
+  maxUnfolding       = in.get<uint64_t>();
+  period_constraint  = in.get<int32_t>();
+  latency_constraint = in.get<int32_t>();
+
+  uint64_t n = in.get<uint64_t>();
+  for (uint64_t i=0; i<n && in.good(); i++){
+    SDFActor* a = new SDFActor();
+    a->id          = in.get<uint64_t>();
+    a->name        = in.getString();
+    a->parent_id   = in.get<uint64_t>();
+    a->parent_name = in.getString();
+    a->codeSize    = in.get<uint64_t>();
+    a->dataSize    = in.get<uint64_t>();
+    a->firings     = in.get<uint64_t>();
+    a->members     = in.getStrings();
+    actors.push_back(a);
+  }
+  n = in.get<uint64_t>();
+  for (uint64_t i=0; i<n && in.good(); i++){
+    SDFChannel* c = new SDFChannel();
+    c->id          = in.get<uint64_t>();
+    c->name        = in.getString();
+    c->source      = in.get<int32_t>();
+    c->src_name    = in.getString();
+    c->prod        = in.get<int32_t>();
+    c->destination = in.get<int32_t>();
+    c->dst_name    = in.getString();
+    c->cons        = in.get<int32_t>();
+    c->initTokens  = in.get<int32_t>();
+    c->tokenSize   = in.get<uint64_t>();
+    c->messageSize = in.get<uint64_t>();
+    c->oldIds      = in.getVector<int>();
+    channels.push_back(c);
+  }
+
+  pathWords     = in.get<uint64_t>();
+  pathComp      = in.getVector<int>();
+  pathRows      = in.getVector<uint64_t>();
+  tokenFreeComp = in.getVector<int>();
+  tokenFreeRows = in.getVector<uint64_t>();
+  if (!in.good())
+    THROW_EXCEPTION(InvalidFormatException, "compiled graph " + graphName + " is truncated");
+
+  buildAdjacency();
+  set_root_actors();
+}
+
+SDFGraph::SDFGraph(const SDFGraph& g) :
+    _d(nullptr), xml(nullptr), graphName(g.graphName),
+    parentActors(g.parentActors), maxUnfolding(g.maxUnfolding),
+    pathComp(g.pathComp), pathRows(g.pathRows),
+    tokenFreeComp(g.tokenFreeComp), tokenFreeRows(g.tokenFreeRows), pathWords(g.pathWords),
+    succOffsets(g.succOffsets), succActors(g.succActors),
+    predOffsets(g.predOffsets), predActors(g.predActors),
+    channelOf(g.channelOf),
+    period_constraint(g.period_constraint), latency_constraint(g.latency_constraint) {
+  for (auto a : g.actors)
+    actors.push_back(new SDFActor(*a));
+  for (auto c : g.channels)
+    channels.push_back(new SDFChannel(*c));
+  for (auto a : g.root_actors)
+    root_actors.push_back(actors[a->id]);
+}
+
+void SDFGraph::write(tools::BinaryWriter& out) const {
+  out.putString(graphName);
+  out.put<uint64_t>(parentActors);
+  out.put<uint64_t>(maxUnfolding);
+  out.put<int32_t>(period_constraint);
+  out.put<int32_t>(latency_constraint);
+
+  out.put<uint64_t>(actors.size());
+  for (auto a : actors){
+    out.put<uint64_t>(a->id);
+    out.putString(a->name);
+    out.put<uint64_t>(a->parent_id);
+    out.putString(a->parent_name);
+    out.put<uint64_t>(a->codeSize);
+    out.put<uint64_t>(a->dataSize);
+    out.put<uint64_t>(a->firings);
+    out.putStrings(a->members);
+  }
+  out.put<uint64_t>(channels.size());
+  for (auto c : channels){
+    out.put<uint64_t>(c->id);
+    out.putString(c->name);
+    out.put<int32_t>(c->source);
+    out.putString(c->src_name);
+    out.put<int32_t>(c->prod);
+    out.put<int32_t>(c->destination);
+    out.putString(c->dst_name);
+    out.put<int32_t>(c->cons);
+    out.put<int32_t>(c->initTokens);
+    out.put<uint64_t>(c->tokenSize);
+    out.put<uint64_t>(c->messageSize);
+    out.putVector(c->oldIds);
+  }
 
+  out.put<uint64_t>(pathWords);
+  out.putVector(pathComp);
+  out.putVector(pathRows);
+  out.putVector(tokenFreeComp);
+  out.putVector(tokenFreeRows);
 }
 
 SDFGraph::~SDFGraph(){
@@ -40,39 +272,41 @@ SDFGraph::~SDFGraph(){
 void SDFGraph::buildDictionaries() {
 
   // extract port rates from the XMLdoc
-  auto acts = xml.xpathNodes("///sdf/actor");
+  auto acts = xml->xpathNodes("///sdf/actor");
   for (size_t i=0; i<acts.size(); i++){
-    string name  = xml.getProp(acts[i], "name");
+    string name  = xml->getProp(acts[i], "name");
     string query = "///sdf/actor[@name=\'" + name + "\']/port";
-    auto   ports = xml.xpathNodes(query.c_str());
+    auto   ports = xml->xpathNodes(query.c_str());
     for (auto port : ports) {
-      string port_name = xml.getProp(port, "name");
-      string port_rate = xml.getProp(port, "rate");
+      string port_name = xml->getProp(port, "name");
+      string port_rate = xml->getProp(port, "rate");
       _d->rate[name][port_name]=atoi(port_rate.c_str());
     }
     _d->actor_id[name] = i;
+    _d->actors.push_back(name);
 
     string size_query = "///sdfProperties/actorProperties[@actor=\'" + name + "\']/processor/memory/stateSize/@max";
-    auto codeSizeValue = xml.xpathStrings(size_query.c_str());
+    auto codeSizeValue = xml->xpathStrings(size_query.c_str());
     // TODO: if state size are not found, they are replaced with 0;
     _d->actor_sz[name] = (codeSizeValue.size() > 0) ? atoi(codeSizeValue[0].c_str()) : 0;
   }
 
-  auto chans = xml.xpathNodes("///sdf/channel");
+  auto chans = xml->xpathNodes("///sdf/channel");
   for (size_t i=0; i<chans.size(); i++){
-    string ch_name = xml.getProp(chans[i], "name");
-    string src_act = xml.getProp(chans[i], "srcActor");
-    string dst_act = xml.getProp(chans[i], "dstActor");
-    string src_prt = xml.getProp(chans[i], "srcPort");
-    string dst_prt = xml.getProp(chans[i], "dstPort");
+    string ch_name = xml->getProp(chans[i], "name");
+    string src_act = xml->getProp(chans[i], "srcActor");
+    string dst_act = xml->getProp(chans[i], "dstActor");
+    string src_prt = xml->getProp(chans[i], "srcPort");
+    string dst_prt = xml->getProp(chans[i], "dstPort");
     _d->channel[src_act][src_prt] = ch_name;
     _d->channel[dst_act][dst_prt] = ch_name;
     _d->chan_con[ch_name] = {src_act, src_prt, dst_act, dst_prt};
+    _d->channels.push_back(ch_name);
     string size_query = "///sdfProperties/channelProperties[@channel=\'" + ch_name + "\']/tokenSize/@sz";
-    auto tokenSizeValue = xml.xpathStrings(size_query.c_str());
+    auto tokenSizeValue = xml->xpathStrings(size_query.c_str());
     // TODO: if token sizes or channel sizes are not found, they are replaced with 0;
     _d->chan_sz[ch_name] = (tokenSizeValue.size() > 0) ? atoi(tokenSizeValue[0].c_str()) : 0;
-    _d->init_tok[ch_name] = xml.hasProp(chans[i], "initialTokens") ? atoi(xml.getProp(chans[i], "initialTokens").c_str()) : 0;
+    _d->init_tok[ch_name] = xml->hasProp(chans[i], "initialTokens") ? atoi(xml->getProp(chans[i], "initialTokens").c_str()) : 0;
   }
 }
 
@@ -115,9 +349,7 @@ void SDFGraph::transform(){
   using boost::gcd;
   vector<rational<int>> firing(actor_id.size(), rational<int>(0));
 
-  auto acts = xml.xpathNodes("///sdf/actor");
-  for (auto& a : acts){
-    string name  = xml.getProp(a, "name");
+  for (const auto& name : _d->actors){
     if (firing[actor_id[name]] == 0) {
       firing[actor_id[name]] = 1;
       calculateRepetitionVector(firing, name);
@@ -137,7 +369,92 @@ void SDFGraph::transform(){
 
   //Initiate corresponding transformation method
   bool isHSDF = all_of(rep_vec.begin(), rep_vec.end(), [](int i){return i==1;});
-  isHSDF ? transformFromHSDF() : transformFromSDF(rep_vec);
+  if(isHSDF){
+    transformFromHSDF();
+    return;
+  }
+  if(maxUnfolding == 0 || *max_element(rep_vec.begin(), rep_vec.end()) <= (int)maxUnfolding){
+    transformFromSDF(rep_vec);
+    return;
+  }
+
+  //partial expansion, falling back to the full one if clustering the firings deadlocks the graph
+  auto rate     = _d->rate;
+  auto init_tok = _d->init_tok;
+  vector<int> unfolding = partialUnfolding(rep_vec);
+  transformFromSDF(unfolding);
+  if(hasTokenFreeCycle()){
+    LOG_WARNING("Partial unfolding of " + graphName + " deadlocks, expanding it fully.");
+    for (auto a : actors) delete a;
+    for (auto ch : channels) delete ch;
+    actors.clear();
+    channels.clear();
+    _d->rate     = rate;
+    _d->init_tok = init_tok;
+    transformFromSDF(rep_vec);
+    return;
+  }
+  for (auto a : actors)
+    a->firings = rep_vec[a->parent_id] / unfolding[a->parent_id];
+  LOG_INFO("Unfolded " + graphName + " partially: " + tools::toString(unfolding)
+           + " copies instead of " + tools::toString(rep_vec));
+}
+
+vector<int> SDFGraph::partialUnfolding(const vector<int>& rep_vec) {
+  auto& rate     = _d->rate;
+  auto& actor_id = _d->actor_id;
+  auto& chan_con = _d->chan_con;
+  auto& init_tok = _d->init_tok;
+
+  //the firings of an actor are split into unfolding[a] consecutive blocks of
+  //rep_vec[a]/unfolding[a] firings, which only requires the block size to divide rep_vec[a]
+  vector<int> unfolding(rep_vec);
+  for (size_t a = 0; a < rep_vec.size(); a++) {
+    int block = 1;
+    while (rep_vec[a] / block > (int)maxUnfolding || rep_vec[a] % block != 0)
+      block++;
+    unfolding[a] = rep_vec[a] / block;
+  }
+
+  for (auto& a_r : rate) {
+    int block = rep_vec[actor_id[a_r.first]] / unfolding[actor_id[a_r.first]];
+    for (auto& p_r : a_r.second)
+      p_r.second *= block;
+  }
+  //a self-loop carries the state between consecutive firings, which are
+  //internal to a block, so only the dependence between blocks remains
+  for (auto& ch : chan_con) {
+    const vector<string>& c = ch.second;
+    if (c[0] != c[2] || init_tok[ch.first] == 0)
+      continue;
+    int blockRate = rate[c[2]][c[3]];
+    init_tok[ch.first] = blockRate * max(1, init_tok[ch.first] / blockRate);
+  }
+  return unfolding;
+}
+
+bool SDFGraph::hasTokenFreeCycle() const {
+  //Kahn's algorithm on the channels without initial tokens
+  vector<int> inDegree(actors.size(), 0);
+  vector<vector<int>> succ(actors.size());
+  for (auto ch : channels) {
+    if (ch->initTokens == 0) {
+      succ[ch->source].push_back(ch->destination);
+      inDegree[ch->destination]++;
+    }
+  }
+  vector<int> ready;
+  for (size_t i = 0; i < actors.size(); i++)
+    if (inDegree[i] == 0) ready.push_back(i);
+  size_t visited = 0;
+  while (!ready.empty()) {
+    int i = ready.back();
+    ready.pop_back();
+    visited++;
+    for (int j : succ[i])
+      if (--inDegree[j] == 0) ready.push_back(j);
+  }
+  return visited < actors.size();
 }
 
 size_t newIndex(size_t actor, const vector<int> &repVector){
@@ -168,13 +485,12 @@ void SDFGraph::transformFromSDF(const vector<int>& rp) {
   //keep number of original (parent) actors
   parentActors = actor_id.size();
 
-  auto chan_nodes = xml.xpathNodes("///sdf/channel");
-  for (auto& gC : chan_nodes) {
-    string ch_name = xml.getProp(gC, "name");
-    string src_act = xml.getProp(gC, "srcActor");
-    string dst_act = xml.getProp(gC, "dstActor");
-    string src_prt = xml.getProp(gC, "srcPort");
-    string dst_prt = xml.getProp(gC, "dstPort");
+  for (const auto& ch_name : _d->channels) {
+    const vector<string>& con = _d->chan_con[ch_name];
+    string src_act = con[0];
+    string src_prt = con[1];
+    string dst_act = con[2];
+    string dst_prt = con[3];
 
     int srcId   = actor_id[src_act];
     int dstId   = actor_id[dst_act];
@@ -267,10 +583,8 @@ void SDFGraph::transformFromHSDF() {
     int parentActorCount = 0;
     unordered_map<string, int> parentActorIds;
 
-    auto actor_nodes = xml.xpathNodes("///sdf/actor");
-    for(auto& gF : actor_nodes){
+    for(const auto& a_name : _d->actors){
         SDFActor* a = new SDFActor();
-        string a_name = xml.getProp(gF, "name");
 
         a->name = a_name;
         a->id = actor_id[a_name];
@@ -302,14 +616,13 @@ void SDFGraph::transformFromHSDF() {
     int old = 0;
     int newCh = 0;
 
-    auto chan_nodes = xml.xpathNodes("///sdf/channel");
-    for(size_t i = 0; i < chan_nodes.size(); i++){
-        auto gC = chan_nodes[i];
-        string ch_name = xml.getProp(gC, "name");
-        string src_act = xml.getProp(gC, "srcActor");
-        string dst_act = xml.getProp(gC, "dstActor");
-        string src_prt = xml.getProp(gC, "srcPort");
-        string dst_prt = xml.getProp(gC, "dstPort");
+    for(size_t i = 0; i < _d->channels.size(); i++){
+        const string& ch_name = _d->channels[i];
+        const vector<string>& con = _d->chan_con[ch_name];
+        string src_act = con[0];
+        string src_prt = con[1];
+        string dst_act = con[2];
+        string dst_prt = con[3];
 
         SDFChannel* c = new SDFChannel();
         c->id = i;
@@ -394,45 +707,47 @@ void SDFGraph::transformFromHSDF() {
 }
 
 void SDFGraph::createPathMatrix() {
-    using namespace boost;
-    typedef adjacency_list<vecS, vecS, bidirectionalS> Graph;
-    typedef adjacency_list<> TcGraph;
-    pathMatrix.assign(actors.size() * actors.size(), simplePath());
-    const int num_vertices = actors.size();
-
-    Graph g(num_vertices);
-    TcGraph tc;
-    Graph g_noTokens(num_vertices);
-    TcGraph tc_noTokens;
-
+    vector<pair<int,int>> edges, tokenFreeEdges;
     for(size_t k = 0; k < channels.size(); k++){
-        int src = channels[k]->source;
-        int dst = channels[k]->destination;
-        int initTokens = channels[k]->initTokens;
-        if(!initTokens){
-            add_edge(src, dst, g_noTokens);
+        pair<int,int> e(channels[k]->source, channels[k]->destination);
+        if(!channels[k]->initTokens){
+            tokenFreeEdges.push_back(e);
         }
-        add_edge(src, dst, g);
+        edges.push_back(e);
     }
+    pathWords = (actors.size()+63)/64;
+    bitClosure(actors.size(), edges, pathComp, pathRows, pathWords);
+    bitClosure(actors.size(), tokenFreeEdges, tokenFreeComp, tokenFreeRows, pathWords);
+}
 
-    transitive_closure(g, tc);
-    transitive_closure(g_noTokens, tc_noTokens);
-
-    graph_traits<TcGraph>::edge_iterator ei, ei_end;
-    for(tie(ei, ei_end) = edges(tc); ei != ei_end; ++ei){
-        auto src = boost::source(*ei, tc);
-        auto dst = boost::target(*ei, tc);
-
-        pathMatrix[src * actors.size() + dst].exists = 1;
-        pathMatrix[src * actors.size() + dst].initTokens = 1;
+void SDFGraph::buildAdjacency() {
+  const size_t n = actors.size();
+  succOffsets.assign(n+1, 0);
+  predOffsets.assign(n+1, 0);
+  channelOf.clear();
+  for (size_t k = 0; k < channels.size(); k++) {
+    SDFChannel* ch = channels[k];
+    channelOf.insert(make_pair(ch->source*n + ch->destination, (int)k));
+    if (ch->initTokens == 0) {
+      succOffsets[ch->source+1]++;
+      predOffsets[ch->destination+1]++;
     }
-    for(tie(ei, ei_end) = edges(tc_noTokens); ei != ei_end; ++ei){
-        auto src = boost::source(*ei, tc_noTokens);
-        auto dst = boost::target(*ei, tc_noTokens);
-
-        pathMatrix[src * actors.size() + dst].exists = 1;
-        pathMatrix[src * actors.size() + dst].initTokens = 0;
+  }
+  for (size_t i = 0; i < n; i++) {
+    succOffsets[i+1] += succOffsets[i];
+    predOffsets[i+1] += predOffsets[i];
+  }
+  succActors.resize(succOffsets[n]);
+  predActors.resize(predOffsets[n]);
+  vector<int> nextSucc(succOffsets.begin(), succOffsets.end()-1);
+  vector<int> nextPred(predOffsets.begin(), predOffsets.end()-1);
+  //channel order is kept within each actor
+  for (auto ch : channels) {
+    if (ch->initTokens == 0) {
+      succActors[nextSucc[ch->source]++] = ch->destination;
+      predActors[nextPred[ch->destination]++] = ch->source;
     }
+  }
 }
 
 string SDFGraph::printPathMatrix() const {
@@ -445,8 +760,8 @@ string SDFGraph::printPathMatrix() const {
   for (size_t ii=0; ii<actors.size(); ii++){
     str += "    ";
     for (size_t ij=0; ij<actors.size(); ij++){
-      if(pathMatrix[ii*actors.size()+ij].exists){
-        str += tools::toString(pathMatrix[ii*actors.size()+ij].initTokens);
+      if(pathExists(ii, ij)){
+        str += tools::toString(tokensOnPath(ii, ij));
         str +=  " | ";
       }else{
         str += "- | ";
@@ -629,6 +944,20 @@ int SDFGraph::getParentId(size_t p_actor) const{
   return -1;
 }
 
+size_t SDFGraph::getFirings(size_t p_actor) const{
+  if(p_actor<actors.size()){
+    return actors[p_actor]->firings;
+  }  
+  return 1;
+}
+
+vector<string> SDFGraph::getMembers(size_t p_actor) const{
+  if(p_actor<actors.size() && !actors[p_actor]->members.empty()){
+    return actors[p_actor]->members;
+  }
+  return vector<string>(1, getActorName(p_actor));
+}
+
 size_t SDFGraph::getCodeSize(size_t p_actor) const{
   if(p_actor<actors.size()){
     return actors[p_actor]->codeSize;
@@ -678,12 +1007,8 @@ SDFChannel* SDFGraph::getChannel(int ch_id) const{
 //get the list of direct predecessors of actor id
 vector<SDFActor*> SDFGraph::getPredecessors(int p_actor) const{
   vector<SDFActor*> pred;
-  
-  for (size_t k=0; k<channels.size(); k++){
-    SDFChannel* ch = channels[k];
-    if(ch->destination==p_actor && ch->initTokens==0){
-      pred.push_back(actors[ch->source]);
-    } 
+  for (int k=predOffsets[p_actor]; k<predOffsets[p_actor+1]; k++){
+    pred.push_back(actors[predActors[k]]);
   } 
   return pred;
 }
@@ -691,54 +1016,48 @@ vector<SDFActor*> SDFGraph::getPredecessors(int p_actor) const{
 //get the list of direct successors of actor id
 vector<SDFActor*> SDFGraph::getSuccessors(int p_actor) const{
   vector<SDFActor*> succ;
-  
-  for (size_t k=0; k<channels.size(); k++){
-    SDFChannel* ch = channels[k];
-    if(ch->source==p_actor && ch->initTokens==0){
-      succ.push_back(actors[ch->destination]);
-    } 
+  for (int k=succOffsets[p_actor]; k<succOffsets[p_actor+1]; k++){
+    succ.push_back(actors[succActors[k]]);
   } 
   return succ;
 }
 
+tools::ArrayView<int> SDFGraph::predecessorIds(int p_actor) const{
+  return tools::ArrayView<int>(predActors.data()+predOffsets[p_actor], predActors.data()+predOffsets[p_actor+1]);
+}
+
+tools::ArrayView<int> SDFGraph::successorIds(int p_actor) const{
+  return tools::ArrayView<int>(succActors.data()+succOffsets[p_actor], succActors.data()+succOffsets[p_actor+1]);
+}
+
 // Checks whether a channel between src and dst exists in the graph,
 // with or without initial tokens
 bool SDFGraph::channelExists(int p_src, int p_dst) const{
-    
-  for (size_t k=0; k<channels.size(); k++){
-    SDFChannel* ch = channels[k];
-    if(ch->source==p_src && ch->destination==p_dst){
-      return true;
-    } 
-  } 
-  return false;
+  return channelOf.count(p_src*actors.size() + p_dst) > 0;
 }
 
 // Gives the number of initial tokens on an edge from src to dst
 // in case there is no edge from src to dst, it returns -1
 int SDFGraph::tokensOnChannel(int p_src, int p_dst) const{
-  for (size_t k=0; k<channels.size(); k++){
-    SDFChannel* ch = channels[k];
-    if(ch->source==p_src && ch->destination==p_dst){
-      return ch->initTokens;
-    } 
-  } 
-  return -1;
+  auto it = channelOf.find(p_src*actors.size() + p_dst);
+  if(it == channelOf.end())
+    return -1;
+  return channels[it->second]->initTokens;
 }
 
 // Checks whether a path between src and dst exists in the graph
 bool SDFGraph::pathExists(int p_src, int p_dst) const{
-  return pathMatrix[p_src*actors.size()+p_dst].exists;
+  return pathBit(pathComp, pathRows, p_src, p_dst);
 }
 
 // Are there any initial tokens on the path from src to dst?
 bool SDFGraph::tokensOnPath(int p_src, int p_dst) const{
-  return pathMatrix[p_src*actors.size()+p_dst].initTokens;
+  return pathExists(p_src, p_dst) && !pathBit(tokenFreeComp, tokenFreeRows, p_src, p_dst);
 }
 
 //does actorI precede actor J in G (i.e. there is a path from i to j with no tokens)?
 bool SDFGraph::precedes(int p_actorI, int p_actorJ) const{
-  return (pathExists(p_actorI, p_actorJ) && !tokensOnPath(p_actorI, p_actorJ));  
+  return pathBit(tokenFreeComp, tokenFreeRows, p_actorI, p_actorJ);
 }
 
 //Are firings firingI and firingI independent in G?
@@ -783,12 +1102,81 @@ void SDFGraph::set_root_actors()
 {
     for(auto a : actors)
     {
-        auto preds = getPredecessors(a->id);
-        if(preds.empty())
+        if(predecessorIds(a->id).empty())
             root_actors.push_back(a);
         //if initial tokens should be added
     }
 }
+void SDFGraph::cluster(const vector<vector<int>>& groups)
+{
+    const size_t n = actors.size();
+    //group of each actor and whether it heads its group
+    vector<int> groupOf(n, -1);
+    for(size_t g = 0; g < groups.size(); g++){
+        if(groups[g].size() < 2)
+            continue;
+        for(int a : groups[g]){
+            if(groupOf[a] != -1 || actors[a]->firings != actors[groups[g][0]]->firings)
+                THROW_EXCEPTION(InvalidArgumentException, "invalid actor clusters for graph " + graphName);
+            groupOf[a] = g;
+        }
+    }
+
+    //the super-actor takes the slot of its first member, the other members are dropped
+    vector<int> newId(n, -1);
+    vector<SDFActor*> clustered;
+    for(size_t i = 0; i < n; i++){
+        if(groupOf[i] != -1 && groups[groupOf[i]][0] != (int)i)
+            continue;
+        SDFActor* a = actors[i];
+        if(groupOf[i] != -1){
+            a = new SDFActor(*actors[i]);
+            a->name.clear();
+            a->members.clear();
+            a->codeSize = 0;
+            a->dataSize = 0;
+            for(int m : groups[groupOf[i]]){
+                a->name += (a->name.empty() ? "" : "+") + actors[m]->name;
+                vector<string> names = getMembers(m);
+                a->members.insert(a->members.end(), names.begin(), names.end());
+                a->codeSize += actors[m]->codeSize;
+                a->dataSize += actors[m]->dataSize;
+            }
+        }
+        a->id = clustered.size();
+        newId[i] = a->id;
+        clustered.push_back(a);
+    }
+    for(size_t i = 0; i < n; i++){
+        if(groupOf[i] != -1){
+            newId[i] = newId[groups[groupOf[i]][0]];
+            delete actors[i];
+        }
+    }
+    actors = clustered;
+
+    vector<SDFChannel*> remaining;
+    for(auto ch : channels){
+        bool internal = ch->source != ch->destination && newId[ch->source] == newId[ch->destination];
+        if(internal && ch->initTokens == 0){
+            delete ch;
+            continue;
+        }
+        ch->source      = newId[ch->source];
+        ch->destination = newId[ch->destination];
+        ch->src_name    = actors[ch->source]->name;
+        ch->dst_name    = actors[ch->destination]->name;
+        ch->id          = remaining.size();
+        remaining.push_back(ch);
+    }
+    channels = remaining;
+
+    createPathMatrix();
+    buildAdjacency();
+    root_actors.clear();
+    set_root_actors();
+}
+
 vector<int> SDFGraph::get_root()
 {
     vector<int> roots;
@@ -29,6 +29,7 @@
 
 
 #include <unordered_map>
+#include <cstdint>
 
 #include <boost/graph/transitive_closure.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -37,6 +38,9 @@
 
 
 #include "../xml/xmldoc.hpp"
+#include "../tools/binaryio.hpp"
+#include "../tools/containertools.hpp"
+#include "sdfgraphbuilder.hpp"
 
 using namespace std;
 using boost::rational;
@@ -53,6 +57,8 @@ public:
   string parent_name; /*!< Name of the actor in the SDF from which this actor was generated. */
   size_t codeSize;    /*!< Code size of the actor. */
   size_t dataSize;    /*!< Data size of the actor. */
+  size_t firings = 1; /*!< Firings of the parent actor executed back to back by this actor (partial unfolding). */
+  vector<string> members; /*!< Names of the actors merged into this one, in execution order (empty if not clustered). */
 };
 
 /**
@@ -76,25 +82,16 @@ public:
                          that the channel originated from. */
 };
 
-/**
- * Trivial class to combine number of initial tokens with the existence of a path.
- */
-class simplePath {
-public:
-  bool exists;     /*!< Existence of the path. */
-  bool initTokens; /*!< Numbers of initial tokens on the path. */
-  simplePath():exists(0),initTokens(0) {};
-};
-
 
 /**
  * This class represents the input SDF graph.
  * It transforms the input graph in SDF3-format into the internal,
  * parallel format and provides functions for the CP model.
  * In order to allow for fairly easy exchange of the input format,
- * only the 3 transform* functions rely on the SDF3 library. Hence,
- * in order to add a new input format, a new constructor, transform,
- * transformFromSDF and transformFromHSDF need to be added.
+ * only buildDictionaries() reads the SDF3 document; the transform*
+ * functions work on the dictionaries. Hence, in order to add a new
+ * input format, a new constructor filling the dictionaries is enough
+ * (see SDFGraph(const SDFGraphBuilder&, size_t)).
  */
 class SDFGraph {
   
@@ -111,13 +108,16 @@ protected:
     map<string, int>            chan_sz;  //!< \c size[channel] dictionary
     map<string, int>            init_tok; //!< \c initial_tokens[channel] dictionary
     map<string, vector<string>> chan_con; //!< \c connections[channel]={src_act,src_prt,dst_act,dst_prt} dictionary
+    vector<string>              actors;   //!< actor names, in input order
+    vector<string>              channels; //!< channel names, in input order
     dictionaries() {};
     ~dictionaries() {};
   };
 
   dictionaries* _d;
 
-  XMLdoc& xml;
+  //! Input document, only valid while buildDictionaries() runs.
+  XMLdoc* xml;
   
   //! Name of the graph.
   string graphName;
@@ -134,20 +134,65 @@ protected:
   //! Number of "parent actors" (actors of the SDF, as opposed to
   //! HSDF).
   size_t parentActors;
+
+  //! Maximum number of copies of a parent actor (0: full expansion
+  //! by the repetition vector).
+  size_t maxUnfolding;
   
-  //! Matrix containing all existing paths in the graph
-  //! (i.e. transitive closure of the graph).
-  vector<simplePath> pathMatrix;
+  //! Transitive closure of the graph, as one bit row (pathWords 64-bit
+  //! words) per strongly connected component: a path from i to j exists
+  //! iff bit j of row pathComp[i] of pathRows is set.
+  vector<int>      pathComp;
+  vector<uint64_t> pathRows;
+  //! The same for the paths over channels without initial tokens.
+  vector<int>      tokenFreeComp;
+  vector<uint64_t> tokenFreeRows;
+  size_t           pathWords;
+
+  bool pathBit(const vector<int>& comp, const vector<uint64_t>& rows, int src, int dst) const {
+    return (rows[comp[src]*pathWords + dst/64] >> (dst%64)) & 1;
+  }
+
+  //! Direct successors (succActors[succOffsets[i]..succOffsets[i+1]-1])
+  //! and predecessors of each actor over channels without initial tokens.
+  vector<int> succOffsets, succActors;
+  vector<int> predOffsets, predActors;
+
+  //! First channel from src to dst, keyed by src*n_actors()+dst.
+  unordered_map<size_t, int> channelOf;
   
   int period_constraint;  /**< max period constraint for the sdf graph. */
   int latency_constraint; /**< max latency constraint for the sdf graph. */
 
   void buildDictionaries();
 
+  /**
+   * Transforms the graph described by the dictionaries into the internal
+   * format and builds the path matrix and adjacency, then frees the dictionaries.
+   */
+  void build();
+
   void set_root_actors();
   
   void calculateRepetitionVector(vector<rational<int>>& firing, string a);
 
+  /**
+   * Chooses the unfolding factor of each parent actor for partial expansion:
+   * the smallest number of back-to-back firings per copy that keeps the number
+   * of copies within maxUnfolding. Rates of the clustered actors are scaled
+   * in the dictionaries accordingly, so that one iteration of the unfolded
+   * graph is still one iteration of the SDF graph.
+   * @param rep_vec repetition vector of the SDF graph
+   * @return number of copies of each parent actor
+   */
+  vector<int> partialUnfolding(const vector<int>& rep_vec);
+
+  /**
+   * Whether the channels without initial tokens form a cycle,
+   * i.e. the transformed graph deadlocks.
+   */
+  bool hasTokenFreeCycle() const;
+
   /**
    * The transform function takes an input application graph g
    * and transforms it into the internal graph format (HSDF without
@@ -178,10 +223,17 @@ protected:
   void transformFromHSDF();
   
   /** 
-   * Creates a matrix (in form of a vector) with all existing paths in the graph
-   * (transitive closure of the graph)
+   * Computes the transitive closure of the graph, with and without the
+   * channels carrying initial tokens, as bit rows per strongly connected
+   * component.
    */
   void createPathMatrix();
+
+  /**
+   * Builds the successor/predecessor arrays and the channel index
+   * behind the adjacency queries.
+   */
+  void buildAdjacency();
   
   /** 
    * Prints the path matrix on the screen, for debugging purposes.
@@ -197,8 +249,37 @@ public:
 
   /**
    * Constructor. Creates an SDFGraph from the SDF3 representation of the graph.
+   * @param maxUnfolding maximum number of copies of an actor in the internal
+   *        graph; 0 expands each actor by its entry in the repetition vector.
+   */
+  SDFGraph(XMLdoc& doc, size_t maxUnfolding = 0);
+
+  /**
+   * Constructor. Creates an SDFGraph from a graph described in memory,
+   * transformed exactly like one read from SDF3.
+   * @param maxUnfolding see SDFGraph(XMLdoc&, size_t)
+   */
+  SDFGraph(const SDFGraphBuilder& graph, size_t maxUnfolding = 0);
+
+  /**
+   * Constructor. Restores a graph saved with write(), without parsing
+   * or transforming it again.
    */
-  SDFGraph(XMLdoc& doc);
+  SDFGraph(tools::BinaryReader& in);
+
+  /**
+   * Copy constructor. Copies the actors and channels, e.g. to cluster
+   * a graph while keeping the original (see ActorClustering).
+   */
+  SDFGraph(const SDFGraph& g);
+
+  SDFGraph& operator=(const SDFGraph&) = delete;
+
+  /**
+   * Saves the internal graph (actors, channels, path matrix) for a
+   * compiled problem instance.
+   */
+  void write(tools::BinaryWriter& out) const;
 
   /**
    * Destructor.
@@ -283,6 +364,22 @@ public:
    */
   int getParentId(size_t p_actor) const;
 
+  /**
+   * Gives the number of firings of the parent actor that the actor
+   * executes back to back (1 unless the graph is partially unfolded).
+   * @param p_actor Id of the (child) actor.
+   * @returns Number of firings per execution of the specified actor.
+   */
+  size_t getFirings(size_t p_actor) const;
+
+  /**
+   * Gives the names of the actors merged into the actor by cluster(),
+   * in the order in which they execute.
+   * @param p_actor Id of the actor.
+   * @returns The member names, or the name of the actor itself if it is not a cluster.
+   */
+  vector<string> getMembers(size_t p_actor) const;
+
   /**
    * Gives the code size of the actor.
    * @param p_actor Id of the actor.
@@ -345,6 +442,18 @@ public:
    * @returns List of successors.
    */
   vector<SDFActor*> getSuccessors(int p_actor) const;
+
+  /**
+   * Ids of the direct predecessors of the specified actor, as listed by
+   * getPredecessors, without copying them.
+   */
+  tools::ArrayView<int> predecessorIds(int p_actor) const;
+
+  /**
+   * Ids of the direct successors of the specified actor, as listed by
+   * getSuccessors, without copying them.
+   */
+  tools::ArrayView<int> successorIds(int p_actor) const;
   
   /**
    * Determines whether a channel (not path!), with or without initial tokens,
@@ -415,6 +524,20 @@ public:
    */
   void outputGraphAsDot(const string &dir) const;
   
+  /**
+   * Merges each group of actors into one super-actor that executes the
+   * members back to back. The members of a group must have the same number
+   * of firings and be listed in an order consistent with the channels
+   * without initial tokens between them. The super-actor takes the id slot,
+   * the parent and the firings of the first member, sums the code and data
+   * sizes, and is named after its members joined by "+". Channels without
+   * initial tokens inside a group are removed, the others are redirected to
+   * the super-actors (internal ones with initial tokens become self-loops).
+   * Actor and channel ids are renumbered.
+   * @param groups local actor ids of each group (groups of size 1 are ignored)
+   */
+  void cluster(const vector<vector<int>>& groups);
+
   vector<int> get_root();
   
   std::string getString() const;
@@ -0,0 +1,67 @@
+#include "sdfgraphbuilder.hpp"
+#include "../exceptions/runtimeexception.h"
+
+using namespace DeSyDe;
+
+SDFGraphBuilder::SDFGraphBuilder(const string& _name)
+  : name(_name), period_constraint(0), latency_constraint(0) {
+}
+
+bool SDFGraphBuilder::hasActor(const string& actor) const {
+  for (const auto& a : actors)
+    if (a.name == actor)
+      return true;
+  return false;
+}
+
+SDFGraphBuilder& SDFGraphBuilder::addActor(const string& actor, int stateSize) {
+  if (hasActor(actor))
+    THROW_EXCEPTION(InvalidArgumentException, "actor " + actor + " is already part of " + name);
+  actors.push_back(Actor{actor, stateSize});
+  return *this;
+}
+
+SDFGraphBuilder& SDFGraphBuilder::addChannel(const string& channel,
+                                             const string& src, int prod,
+                                             const string& dst, int cons,
+                                             int initTokens, int tokenSize) {
+  for (const auto& c : channels)
+    if (c.name == channel)
+      THROW_EXCEPTION(InvalidArgumentException, "channel " + channel + " is already part of " + name);
+  if (!hasActor(src) || !hasActor(dst))
+    THROW_EXCEPTION(InvalidArgumentException, "channel " + channel + " connects an unknown actor");
+  if (prod <= 0 || cons <= 0)
+    THROW_EXCEPTION(InvalidArgumentException, "channel " + channel + " has a rate below 1");
+  channels.push_back(Channel{channel, src, prod, dst, cons, initTokens, tokenSize});
+  return *this;
+}
+
+SDFGraphBuilder& SDFGraphBuilder::setPeriodConstraint(int period) {
+  period_constraint = period;
+  return *this;
+}
+
+SDFGraphBuilder& SDFGraphBuilder::setLatencyConstraint(int latency) {
+  latency_constraint = latency;
+  return *this;
+}
+
+const string& SDFGraphBuilder::getName() const {
+  return name;
+}
+
+const vector<SDFGraphBuilder::Actor>& SDFGraphBuilder::getActors() const {
+  return actors;
+}
+
+const vector<SDFGraphBuilder::Channel>& SDFGraphBuilder::getChannels() const {
+  return channels;
+}
+
+int SDFGraphBuilder::getPeriodConstraint() const {
+  return period_constraint;
+}
+
+int SDFGraphBuilder::getLatencyConstraint() const {
+  return latency_constraint;
+}
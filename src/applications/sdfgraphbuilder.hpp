@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __SDFGRAPHBUILDER__
+#define __SDFGRAPHBUILDER__
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Describes an SDF graph in memory, as an alternative to an SDF3 file.
+ * Actors are given with their state size; channels with the production
+ * and consumption rates of their end points, their initial tokens and
+ * their token size. SDFGraph(const SDFGraphBuilder&, size_t) transforms
+ * the description exactly like an SDF3 input.
+ */
+class SDFGraphBuilder {
+public:
+  /** An actor of the graph. */
+  struct Actor {
+    string name;
+    int    stateSize;
+  };
+  /** A channel from src to dst. */
+  struct Channel {
+    string name;
+    string src;
+    int    prod;
+    string dst;
+    int    cons;
+    int    initTokens;
+    int    tokenSize;
+  };
+
+  SDFGraphBuilder(const string& name);
+
+  /**
+   * Adds an actor. Throws an InvalidArgumentException if the name is taken.
+   */
+  SDFGraphBuilder& addActor(const string& name, int stateSize = 0);
+
+  /**
+   * Adds a channel between two actors added before. Throws an
+   * InvalidArgumentException if the name is taken, an end point is
+   * unknown or a rate is not positive.
+   */
+  SDFGraphBuilder& addChannel(const string& name,
+                              const string& src, int prod,
+                              const string& dst, int cons,
+                              int initTokens = 0, int tokenSize = 0);
+
+  /** Sets the period constraint (0: none, -1: optimize). */
+  SDFGraphBuilder& setPeriodConstraint(int period);
+
+  /** Sets the latency constraint (0: none, -1: optimize). */
+  SDFGraphBuilder& setLatencyConstraint(int latency);
+
+  const string& getName() const;
+  const vector<Actor>& getActors() const;
+  const vector<Channel>& getChannels() const;
+  int getPeriodConstraint() const;
+  int getLatencyConstraint() const;
+
+private:
+  string          name;
+  vector<Actor>   actors;
+  vector<Channel> channels;
+  int             period_constraint;
+  int             latency_constraint;
+
+  bool hasActor(const string& actor) const;
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include "paretoDominance.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+namespace {
+  const size_t profileKind = tools::PropStats::kind("ParetoDominance");
+}
+
+namespace {
+  /**
+   * True if a is no worse than b in every objective.
+   */
+  inline bool weaklyDominates(const vector<int>& a, const vector<int>& b){
+    for(size_t k = 0; k < a.size(); k++){
+      if(a[k] > b[k])
+        return false;
+    }
+    return true;
+  }
+}
+
+int ParetoArchive::add(const vector<int>& point){
+  std::lock_guard<std::mutex> guard(lock);
+  for(const vector<int>& p : points){
+    if(weaklyDominates(p, point))
+      return n_added;
+  }
+  vector<vector<int>> kept;
+  for(const vector<int>& p : points){
+    if(!weaklyDominates(point, p))
+      kept.push_back(p);
+  }
+  kept.push_back(point);
+  points.swap(kept);
+  return ++n_added;
+}
+
+vector<vector<int>> ParetoArchive::front() const{
+  std::lock_guard<std::mutex> guard(lock);
+  return points;
+}
+
+ParetoDominance::ParetoDominance(Space& home,
+                                 ViewArray<IntView> _x,
+                                 IntView _version,
+                                 ParetoArchive* _archive)
+  : Propagator(home), x(_x), version(_version), archive(_archive) {
+
+  x.subscribe(home, *this, Int::PC_INT_BND);
+  version.subscribe(home, *this, Int::PC_INT_BND);
+}
+
+size_t ParetoDominance::dispose(Space& home){
+  x.cancel(home, *this, Int::PC_INT_BND);
+  version.cancel(home, *this, Int::PC_INT_BND);
+  (void) Propagator::dispose(home);
+  return sizeof(*this);
+}
+
+ParetoDominance::ParetoDominance(Space& home, bool share, ParetoDominance& p)
+  : Propagator(home, share, p), archive(p.archive) {
+
+  x.update(home, share, p.x);
+  version.update(home, share, p.version);
+}
+
+Propagator* ParetoDominance::copy(Space& home, bool share){
+  tools::CloneStats::record(sizeof(*this));
+  return new (home) ParetoDominance(home, share, *this);
+}
+
+PropCost ParetoDominance::cost(const Space& home, const ModEventDelta& med) const{
+  return PropCost::linear(PropCost::HI, x.size());
+}
+
+ExecStatus ParetoDominance::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus ParetoDominance::filter(Space& home, const ModEventDelta&){
+  std::lock_guard<std::mutex> guard(archive->lock);
+  for(const vector<int>& p : archive->points){
+    int better = -1;
+    int n_better = 0;
+    for(int k = 0; k < x.size() && n_better < 2; k++){
+      if(x[k].min() < p[k]){
+        better = k;
+        n_better++;
+      }
+    }
+    if(n_better == 0)
+      return ES_FAILED;
+    if(n_better == 1)
+      GECODE_ME_CHECK(x[better].le(home, p[better]));
+  }
+  //only upper bounds were tightened, which leaves the counts above unchanged;
+  //the archive can still grow, so the propagator is never subsumed
+  return ES_FIX;
+}
+
+void paretoDominance(Space& home,
+                     const IntVarArgs& _x,
+                     IntVar _version,
+                     ParetoArchive* _archive)
+{
+  if (home.failed())
+    return;
+
+  ViewArray<Int::IntView> tmp_x(home, _x);
+  IntView tmp_version(_version);
+  if (ParetoDominance::post(home, tmp_x, tmp_version, _archive) != ES_OK) {
+    home.fail();
+  }
+}
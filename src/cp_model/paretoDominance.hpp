@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+#include <gecode/int.hh>
+#include <vector>
+#include <mutex>
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+/**
+ * The front of non-dominated objective vectors found by a PARETO search,
+ * shared by all spaces of the search (and its threads).
+ */
+class ParetoArchive {
+  friend class ParetoDominance;
+
+protected:
+  mutable std::mutex lock;
+  vector<vector<int>> points; /*!< mutually non-dominated objective vectors. */
+  int n_added;                /*!< number of points added, never decreases. */
+
+public:
+  ParetoArchive() : n_added(0) {}
+  /**
+   * Adds point to the front unless a point of the front weakly dominates it,
+   * and removes the points it dominates.
+   * @return number of points added so far
+   */
+  int add(const vector<int>& point);
+  /**
+   * Gets the current front.
+   */
+  vector<vector<int>> front() const;
+};
+
+/**
+ * Keeps the objectives x (all minimized) from being weakly dominated by any
+ * point of a ParetoArchive, i.e. for every point p some x[k] < p[k].
+ *
+ * Replaces a disjunction of reified rels per front point: a point with no
+ * possibly better objective fails the space, a point with exactly one
+ * bounds that objective. The archive grows during search, so each
+ * constrain() raises the lower bound of version to the number of points
+ * added, which wakes the propagator up to read the archive again.
+ */
+class ParetoDominance : public Propagator {
+
+protected:
+  ViewArray<IntView> x;    /*!< objectives, minimized. */
+  IntView version;         /*!< raised by constrain() whenever a point is added. */
+  ParetoArchive* archive;  /*!< front found so far, kept alive by the spaces holding it. */
+
+public:
+  ParetoDominance(Space& home,
+                  ViewArray<IntView> _x,
+                  IntView _version,
+                  ParetoArchive* _archive);
+
+  static ExecStatus post(Space& home,
+                         ViewArray<IntView> _x,
+                         IntView _version,
+                         ParetoArchive* _archive){
+    (void) new (home) ParetoDominance(home, _x, _version, _archive);
+    return ES_OK;
+  }
+
+  virtual size_t dispose(Space& home);
+
+  ParetoDominance(Space& home, bool share, ParetoDominance& p);
+
+  virtual Propagator* copy(Space& home, bool share);
+
+  virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+
+  virtual ExecStatus propagate(Space& home, const ModEventDelta&);
+
+protected:
+  /** Checks x against every point of the archive. */
+  ExecStatus filter(Space& home, const ModEventDelta& med);
+};
+
+/**
+ * Posts the Pareto dominance propagator.
+ * @param _x objectives, in the order of the points of _archive
+ * @param _version counter raised by constrain() after adding to _archive
+ * @param _archive front found so far
+ */
+extern void paretoDominance(Space& home,
+                            const IntVarArgs& _x,
+                            IntVar _version,
+                            ParetoArchive* _archive);
@@ -0,0 +1,190 @@
+#include "periodBound.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+namespace {
+  const size_t profileKind = tools::PropStats::kind("PeriodBound");
+}
+
+PeriodBound::PeriodBound(Space& home,
+                         ViewArray<IntView> _period,
+                         ViewArray<IntView> _proc,
+                         ViewArray<IntView> _proc_mode,
+                         ViewArray<IntView> _wcet,
+                         ViewArray<IntView> _wcct_b,
+                         ViewArray<IntView> _wcct_s,
+                         IntArgs _actorApp,
+                         IntArgs _ch_src,
+                         IntArgs _wcets,
+                         int _n_modes)
+  : Propagator(home), period(_period), proc(_proc), proc_mode(_proc_mode),
+    wcet(_wcet), wcct_b(_wcct_b), wcct_s(_wcct_s), actorApp(_actorApp),
+    ch_src(_ch_src), wcets(_wcets), n_modes(_n_modes) {
+
+  period.subscribe(home, *this, Int::PC_INT_BND);
+  proc.subscribe(home, *this, Int::PC_INT_VAL);
+  proc_mode.subscribe(home, *this, Int::PC_INT_VAL);
+  wcet.subscribe(home, *this, Int::PC_INT_BND);
+  wcct_b.subscribe(home, *this, Int::PC_INT_BND);
+  wcct_s.subscribe(home, *this, Int::PC_INT_BND);
+}
+
+size_t PeriodBound::dispose(Space& home){
+  period.cancel(home, *this, Int::PC_INT_BND);
+  proc.cancel(home, *this, Int::PC_INT_VAL);
+  proc_mode.cancel(home, *this, Int::PC_INT_VAL);
+  wcet.cancel(home, *this, Int::PC_INT_BND);
+  wcct_b.cancel(home, *this, Int::PC_INT_BND);
+  wcct_s.cancel(home, *this, Int::PC_INT_BND);
+  actorApp.~IntSharedArray();
+  ch_src.~IntSharedArray();
+  wcets.~IntSharedArray();
+  (void) Propagator::dispose(home);
+  return sizeof(*this);
+}
+
+PeriodBound::PeriodBound(Space& home, bool share, PeriodBound& p)
+  : Propagator(home, share, p),
+    n_modes(p.n_modes) {
+
+  period.update(home, share, p.period);
+  proc.update(home, share, p.proc);
+  proc_mode.update(home, share, p.proc_mode);
+  wcet.update(home, share, p.wcet);
+  wcct_b.update(home, share, p.wcct_b);
+  wcct_s.update(home, share, p.wcct_s);
+  actorApp.update(home, share, p.actorApp);
+  ch_src.update(home, share, p.ch_src);
+  wcets.update(home, share, p.wcets);
+}
+
+Propagator* PeriodBound::copy(Space& home, bool share){
+  tools::CloneStats::record(sizeof(*this));
+  return new (home) PeriodBound(home, share, *this);
+}
+
+PropCost PeriodBound::cost(const Space& home, const ModEventDelta& med) const{
+  return PropCost::linear(PropCost::LO, proc.size()+wcct_s.size());
+}
+
+int PeriodBound::minWcet(int i, int j) const{
+  int best = -1;
+  for(int m = 0; m < n_modes; m++){
+    if(n_modes > 1 && !proc_mode[j].in(m))
+      continue;
+    int w = wcets[(i*proc_mode.size()+j)*n_modes+m];
+    if(w > 0 && (best < 0 || w < best))
+      best = w;
+  }
+  return best;
+}
+
+ExecStatus PeriodBound::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus PeriodBound::filter(Space& home, const ModEventDelta&){
+  const int n_procs = proc_mode.size();
+  const int n_apps = period.size();
+
+  //load of the static-order and of the send schedule of each proc
+  vector<long long> compute(n_procs, 0);
+  vector<long long> comm(n_procs, 0);
+  for(int i = 0; i < proc.size(); i++){
+    if(proc[i].assigned())
+      compute[proc[i].val()] += wcet[i].min();
+  }
+  for(int k = 0; k < wcct_s.size(); k++){
+    if(proc[ch_src[k]].assigned())
+      comm[proc[ch_src[k]].val()] += (long long)wcct_b[k].min() + wcct_s[k].min();
+  }
+
+  vector<long long> bound(n_apps, 0);
+  vector<long long> appWcet(n_apps, 0);
+  vector<vector<char>> usable(n_apps, vector<char>(n_procs, 0));
+  for(int i = 0; i < proc.size(); i++){
+    int a = actorApp[i];
+    appWcet[a] += wcet[i].min();
+    for(ViewValues<IntView> j(proc[i]); j(); ++j)
+      usable[a][j.val()] = 1;
+    if(proc[i].assigned()){
+      int j = proc[i].val();
+      bound[a] = max(bound[a], max(compute[j], comm[j]));
+    }
+  }
+  for(int a = 0; a < n_apps; a++){
+    long long n_usable = count(usable[a].begin(), usable[a].end(), 1);
+    if(n_usable > 0)
+      bound[a] = max(bound[a], (appWcet[a] + n_usable - 1) / n_usable);
+    if(bound[a] > period[a].max())
+      return ES_FAILED;
+    GECODE_ME_CHECK(period[a].gq(home, (int)bound[a]));
+  }
+
+  //an actor cannot go where its WCET would push the proc over the current period bound
+  bool modified = false;
+  vector<int> values;
+  for(int i = 0; i < proc.size(); i++){
+    if(proc[i].assigned())
+      continue;
+    long long cap = period[actorApp[i]].max();
+    values.clear();
+    for(ViewValues<IntView> j(proc[i]); j(); ++j){
+      int w = minWcet(i, j.val());
+      if(w > 0 && compute[j.val()] + w > cap)
+        values.push_back(j.val());
+    }
+    for(int j : values){
+      ModEvent me = proc[i].nq(home, j);
+      GECODE_ME_CHECK(me);
+      modified = modified || me != ME_INT_NONE;
+    }
+  }
+
+  if(modified)
+    return ES_NOFIX;
+  if(proc.assigned() && proc_mode.assigned() && wcct_b.assigned() && wcct_s.assigned())
+    return home.ES_SUBSUMED(*this);
+  return ES_FIX;
+}
+
+void periodBound(Space& home,
+                 const IntVarArgs& _period,
+                 const IntVarArgs& _proc,
+                 const IntVarArgs& _proc_mode,
+                 const IntVarArgs& _wcet,
+                 const IntVarArgs& _wcct_b,
+                 const IntVarArgs& _wcct_s,
+                 const IntArgs& _actorApp,
+                 const IntArgs& _ch_src,
+                 const IntArgs& _wcets,
+                 int _n_modes)
+{
+  if (home.failed())
+    return;
+
+  if (_proc.size() != _wcet.size() || _proc.size() != _actorApp.size()) {
+    throw Gecode::Int::ArgumentSizeMismatch("PeriodBound constraint, proc & wcet & actorApp");
+  }
+  if (_wcct_b.size() != _wcct_s.size() || _wcct_s.size() != _ch_src.size()) {
+    throw Gecode::Int::ArgumentSizeMismatch("PeriodBound constraint, wcct_b & wcct_s & ch_src");
+  }
+  if (_wcets.size() != _proc.size()*_proc_mode.size()*_n_modes) {
+    throw Gecode::Int::ArgumentSizeMismatch("PeriodBound constraint, wcets");
+  }
+  ViewArray<Int::IntView> tmp_period(home, _period);
+  ViewArray<Int::IntView> tmp_proc(home, _proc);
+  ViewArray<Int::IntView> tmp_proc_mode(home, _proc_mode);
+  ViewArray<Int::IntView> tmp_wcet(home, _wcet);
+  ViewArray<Int::IntView> tmp_wcct_b(home, _wcct_b);
+  ViewArray<Int::IntView> tmp_wcct_s(home, _wcct_s);
+  if (PeriodBound::post(home, tmp_period, tmp_proc, tmp_proc_mode, tmp_wcet, tmp_wcct_b, tmp_wcct_s,
+                        _actorApp, _ch_src, _wcets, _n_modes) != ES_OK) {
+    home.fail();
+  }
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+#include <gecode/int.hh>
+#include <vector>
+#include <algorithm>
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+/**
+ * Cheap lower bound on the periods of the SDF applications from the load
+ * of the processors, for pruning before the throughput propagators have
+ * enough of the schedule to say anything.
+ *
+ * With the mapped actors (proc assigned), a processor j needs
+ *  - the sum of their WCETs for its static-order schedule, and
+ *  - the sum of blocking and transfer times (wcct_b + wcct_s) of the
+ *    channels it sends on the TDMA bus for its send schedule,
+ * in every period of the applications on j. Each application is also bounded
+ * by the average load of its actors over the processors it can still use.
+ * Against period.max() (the BAB incumbent), processors are removed from the
+ * domain of unmapped actors if their WCET there would overload the processor.
+ */
+class PeriodBound : public Propagator {
+
+protected:
+  ViewArray<IntView> period;    /*!< period of each SDF application. */
+  ViewArray<IntView> proc;      /*!< mapping of the SDF actors. */
+  ViewArray<IntView> proc_mode; /*!< mode of each processor. */
+  ViewArray<IntView> wcet;      /*!< current WCETs of the SDF actors. */
+  ViewArray<IntView> wcct_b;    /*!< blocking time of each channel. */
+  ViewArray<IntView> wcct_s;    /*!< transfer time of each channel. */
+  IntSharedArray actorApp;      /*!< application of each actor. */
+  IntSharedArray ch_src;        /*!< source actor of each channel. */
+  IntSharedArray wcets;         /*!< WCET of actor i on proc j in mode m at (i*n_procs+j)*n_modes+m, <=0 if invalid. */
+  const int n_modes;
+
+  /**
+   * Lowest WCET of actor i on proc j over the modes still possible for j.
+   * @return -1 if i cannot run on j
+   */
+  int minWcet(int i, int j) const;
+
+public:
+  PeriodBound(Space& home,
+              ViewArray<IntView> _period,
+              ViewArray<IntView> _proc,
+              ViewArray<IntView> _proc_mode,
+              ViewArray<IntView> _wcet,
+              ViewArray<IntView> _wcct_b,
+              ViewArray<IntView> _wcct_s,
+              IntArgs _actorApp,
+              IntArgs _ch_src,
+              IntArgs _wcets,
+              int _n_modes);
+
+  static ExecStatus post(Space& home,
+                         ViewArray<IntView> _period,
+                         ViewArray<IntView> _proc,
+                         ViewArray<IntView> _proc_mode,
+                         ViewArray<IntView> _wcet,
+                         ViewArray<IntView> _wcct_b,
+                         ViewArray<IntView> _wcct_s,
+                         IntArgs _actorApp,
+                         IntArgs _ch_src,
+                         IntArgs _wcets,
+                         int _n_modes){
+    (void) new (home) PeriodBound(home, _period, _proc, _proc_mode, _wcet, _wcct_b, _wcct_s,
+                                  _actorApp, _ch_src, _wcets, _n_modes);
+    return ES_OK;
+  }
+
+  virtual size_t dispose(Space& home);
+
+  PeriodBound(Space& home, bool share, PeriodBound& p);
+
+  virtual Propagator* copy(Space& home, bool share);
+
+  virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+
+  virtual ExecStatus propagate(Space& home, const ModEventDelta&);
+
+protected:
+  /** Bounds the periods by the processor loads and prunes overloading processors. */
+  ExecStatus filter(Space& home, const ModEventDelta& med);
+};
+
+/**
+ * Posts the load-based period bound.
+ * @param _wcets flattened |_proc| x |_proc_mode| x _n_modes WCET table
+ */
+extern void periodBound(Space& home,
+                        const IntVarArgs& _period,
+                        const IntVarArgs& _proc,
+                        const IntVarArgs& _proc_mode,
+                        const IntVarArgs& _wcet,
+                        const IntVarArgs& _wcct_b,
+                        const IntVarArgs& _wcct_s,
+                        const IntArgs& _actorApp,
+                        const IntArgs& _ch_src,
+                        const IntArgs& _wcets,
+                        int _n_modes);
@@ -1,10 +1,16 @@
 
 #include "schedulability.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
 
 using namespace Gecode;
 using namespace Int;
 using namespace std;
 
+namespace {
+  const size_t profileKind = tools::PropStats::kind("Schedulability");
+}
+
 
 Schedulability::Schedulability( Space& home, 
                                 ViewArray<IntView> _wcet,
@@ -25,6 +31,10 @@ Schedulability::Schedulability( Space& home,
 }
 
 size_t Schedulability::dispose(Space& home){
+  proc.cancel(home, *this, Int::PC_INT_VAL);
+  periods.~IntSharedArray();
+  priorities.~IntSharedArray();
+  deadlines.~IntSharedArray();
   home.ignore(*this, AP_DISPOSE);
   (void) Propagator::dispose(home);
   return sizeof(*this);
@@ -32,6 +42,7 @@ size_t Schedulability::dispose(Space& home){
  
 
 Propagator* Schedulability::copy(Space& home, bool share){
+  tools::CloneStats::record(sizeof(*this));
   return new (home) Schedulability(home, share, *this);
 }
 
@@ -42,22 +53,25 @@ PropCost Schedulability::cost(const Space& home, const ModEventDelta& med) const
 
 Schedulability::Schedulability(Space& home, bool share, Schedulability& p)
   : Propagator(home, share, p),
-    wcet(p.wcet),
-    proc(p.proc),
-    proc_mode(p.proc_mode),
-    periods(p.periods),
-    priorities(p.priorities),
-    deadlines(p.deadlines),
     n_actors(p.n_actors),
     n_tasks(p.n_tasks),
     calls(p.calls) {
 
   wcet.update(home, share, p.wcet);
   proc.update(home, share, p.proc);
+  proc_mode.update(home, share, p.proc_mode);
+  periods.update(home, share, p.periods);
+  priorities.update(home, share, p.priorities);
+  deadlines.update(home, share, p.deadlines);
 }
 
 
-ExecStatus Schedulability::propagate(Space& home, const ModEventDelta&){
+ExecStatus Schedulability::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus Schedulability::filter(Space& home, const ModEventDelta&){
   
   calls++;
   //cout << "propagate: " << calls << "--------------------" << endl;
@@ -81,22 +95,35 @@ ExecStatus Schedulability::propagate(Space& home, const ModEventDelta&){
   return ES_FIX;
 }
 
-int Schedulability::leveliWorkload(int taskid, int t) {
-  int procID = proc[taskid].val();
-  int W      = wcet[taskid].val();
+tools::FPSchedulabilityCache& Schedulability::cache(){
+  static thread_local tools::FPSchedulabilityCache c;
+  return c;
+}
+
+void Schedulability::tasksOnProc(int procid, vector<int>& ids, vector<tools::FPTask>& tasks)
+{
+  ids.clear();
+  tasks.clear();
   for (size_t i=n_actors; i<n_actors+n_tasks; i++)
     {
-      /**
-       * If task is mapped on my processor and it has higher priority (0 has highest)
-       * i is global task id i.e. considering both tasks and actors
-       * (i-n_actors) is the local task id: priorities and periodes need local task id
-       */  
-      if(isOnProc(i, procID) && priorities[taskid-n_actors] > priorities[i-n_actors])
+      if(isOnProc(i, procid))
         {
-          W += ceil((double)t/periods[i-n_actors]) * wcet[i].val();
+          /**
+           * (i-n_actors) is the local task id: priorities and periodes need local task id.
+           * wcet.min() is exact once the mode is fixed and a safe lower bound otherwise
+           */
+          ids.push_back(i);
+          tasks.push_back({wcet[i].min(), periods[i-n_actors], deadlines[i-n_actors], priorities[i-n_actors]});
         }
     }
-  return W;	
+}
+
+int Schedulability::leveliWorkload(int taskid, int t) {
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
+  tasksOnProc(proc[taskid].val(), ids, tasks);
+  size_t i = find(ids.begin(), ids.end(), taskid) - ids.begin();
+  return tools::leveliWorkload(tasks, i, t);
 }
 
 bool Schedulability::FPSchedulable()
@@ -104,19 +131,20 @@ bool Schedulability::FPSchedulable()
   /**
    * goes through all proccessors that mode is assigned
    * first tries utilzation bound test
-   * if it fails it tries the time demand test
+   * if it fails it tries the response time analysis
+   * verdicts are cached per task set, so only procs whose task set changed are re-tested
    */ 
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
   for (auto k=0;k < proc_mode.size();k++)
     {
       if(proc_mode[k].assigned())
         {
-          if(!utilizationBound(k))
-            {	
-              if(!timedemand(k))
-                {
-                  //cout << "proc_" << k << " is NOT schedulabale \n" ;
-                  return false;
-                }
+          tasksOnProc(k, ids, tasks);
+          if(!cache().schedulable(ids, tasks))
+            {
+              //cout << "proc_" << k << " is NOT schedulabale \n" ;
+              return false;
             }
         }
     }
@@ -124,56 +152,25 @@ bool Schedulability::FPSchedulable()
 }
 bool Schedulability::timedemand(int procid)
 {
-  bool taski;
-  for (auto i=n_actors; i<n_actors+n_tasks; i++)
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
+  tasksOnProc(procid, ids, tasks);
+  for (size_t i=0; i<tasks.size(); i++)
     {
-      if(isOnProc(i, procid))
+      if(tools::responseTime(tasks, i, tasks[i].deadline) < 0)
         {
-          taski = false;
-          for (auto t=1; t<= deadlines[i-n_actors]; t++) //This can be improved by Bini and Buttazzo's approach
-            {
-              if(leveliWorkload(i, t) <= t)
-                {
-                  taski = true;
-                  break;
-                }
-            }
-          if(!taski)
-            {
-              //cout << "task_" << i << " is NOT schedulabale \n" ;
-              return false;
-            }
+          //cout << "task_" << ids[i] << " is NOT schedulabale \n" ;
+          return false;
         }
     }	
-  //cout << "proc[" << procid << "] is schedulable based on time demand analysis" << endl;
   return true;
 }
 bool Schedulability::utilizationBound(int procid)
 {
-  int n = 0;
-  double utils = 0;
-  for (size_t i=n_actors; i<n_actors+n_tasks; i++)
-    {
-      if(isOnProc(i, procid))
-        {
-          n++;
-          utils += ((double) wcet[i].val())/ deadlines[i-n_actors];
-        }
-    }
-  if(n > 0)
-    {
-      double bound = n*(pow(2, (1.0/n)) - 1);
-      //cout << "proc[" << procid << "] bound: "<< bound << " utils: " << utils<< ", no_tasks: " << n  << endl;
-      if(utils > bound)
-        {
-          //cout << "proc[" << procid << "] is NOT schedulable based on utilization bound" << endl;
-          return false;
-        }
-    }
-  else
-    return true;/// no tasks assigned on this proc --> schedulable
-  //cout << "proc[" << procid << "] is schedulable based on utilization bound" << endl;
-  return true;
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
+  tasksOnProc(procid, ids, tasks);
+  return tools::utilizationBound(tasks);
 }
 bool Schedulability::isOnProc(int taskid, int procid)
 {
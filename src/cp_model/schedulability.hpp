@@ -31,6 +31,7 @@
 #include <chrono>
 #include <sstream>
 #include <fstream>
+#include "../tools/fpschedulability.hpp"
 
 
 using namespace Gecode;
@@ -43,15 +44,24 @@ protected:
   ViewArray<IntView> wcet; /*!< current WCETs. */
   ViewArray<IntView> proc; /*!< current mapping of actors and task. */
   ViewArray<IntView> proc_mode; /*!< current proc_modes. */
-  IntArgs periods;
-  IntArgs priorities;
-  IntArgs deadlines;
+  IntSharedArray periods;
+  IntSharedArray priorities;
+  IntSharedArray deadlines;
   const size_t n_actors;
   const size_t n_tasks;
   //for evaluation purposes
   size_t calls;
   int total_time;
   bool printDebug;
+  /**
+   * Verdicts of the FP test per processor task set, shared by all
+   * Schedulability propagators of a thread instead of being cloned.
+   */
+  static tools::FPSchedulabilityCache& cache();
+  /**
+   * Collects the tasks assigned to procid, with their entity ids.
+   */
+  void tasksOnProc(int procid, vector<int>& ids, vector<tools::FPTask>& tasks);
   /**
    * Returns the level-i workload given the current mapping
    * NOTE that the task has to be assiged to a processor before calling this
@@ -72,7 +82,8 @@ protected:
    */ 
   bool isOnProc(int taskid, int procid);
   /**
-   * @return true if tasks assigned to procid are schedulable based on the time demand test
+   * @return true if tasks assigned to procid are schedulable based on the
+   *         response time analysis (exact time demand test)
    */ 
   bool timedemand(int procid);
         
@@ -109,6 +120,10 @@ public:
   virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
 
   virtual ExecStatus propagate(Space& home, const ModEventDelta&);
+
+protected:
+  /** Fails unless the current mapping passes FPSchedulable(). */
+  ExecStatus filter(Space& home, const ModEventDelta& med);
   /**
    * Returns true if the taskset is schedulable given 
    * (1) current mapping and (2) partitioned FP algorithm
@@ -1,4 +1,5 @@
 #include "sdf_pr_online_model.hpp"
+#include "../tools/clonestats.hpp"
 
 SDFPROnlineModel::SDFPROnlineModel(Mapping* p_mapping, Config* _cfg):
     apps(p_mapping->getApplications()),
@@ -30,6 +31,7 @@ SDFPROnlineModel::SDFPROnlineModel(Mapping* p_mapping, Config* _cfg):
     wcct_b(*this, apps->n_programChannels(), 0, Int::Limits::max),
     wcct_s(*this, apps->n_programChannels(), 0, Int::Limits::max),
     wcct_r(*this, apps->n_programChannels(), 0, Int::Limits::max),
+    paretoVersion(*this, 0, Int::Limits::max),
     least_power_est(mapping->getLeastPowerConsumption()){
     LOG_DEBUG("Creating CP model");
     if(apps->n_SDFActors() > 0){
@@ -344,39 +346,40 @@ SDFPROnlineModel::SDFPROnlineModel(Mapping* p_mapping, Config* _cfg):
         cout << endl;
         //branch(*this, next, INT_VAR_NONE(), INT_VAL_MIN());
 
-        if(!heaviestFirst && (procBranchOrderSAT.size() > 0 || procBranchOrderOPT.size() > 0)){
-            //branch(*this, proc_mode, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
-            branch(*this, procBranchOrderSAT, INT_VAR_NONE(), INT_VAL_MIN());
-            branch(*this, procBranchOrderOPT, INT_VAR_NONE(), INT_VAL_MIN());
-            branch(*this, proc_mode, INT_VAR_NONE(), INT_VAL_MIN());
-        }else if(heaviestFirst && (procBranchOrderSAT.size() > 0 || procBranchOrderOPT.size() > 0)){
-            branch(*this, procBranchOrderSAT, INT_VAR_NONE(), INT_VAL_MIN());
-            branch(*this, procBranchOrderOPT, INT_VAR_NONE(), INT_VAL_MIN());
-            branch(*this, proc_mode, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
+        if(procBranchOrderSAT.size() > 0 || procBranchOrderOPT.size() > 0){
+            procBranchOrder = IntVarArray(*this, procBranchOrderSAT + procBranchOrderOPT);
+            afcModes = heaviestFirst;
         }else{
-            branch(*this, procBranchOrderOther, INT_VAR_NONE(), INT_VAL_MIN());
-            branch(*this, proc_mode, INT_VAR_NONE(), INT_VAL_MIN());
+            procBranchOrder = IntVarArray(*this, procBranchOrderOther);
+            afcModes = false;
         }
-
-        //branch(*this, rank, INT_VAR_NONE(), INT_VAL_MIN());
-        branch(*this, next, INT_VAR_NONE(), INT_VAL_MIN());
-        branch(*this, tdmaAlloc, INT_VAR_NONE(), INT_VAL_MIN());
         /**
-         * ordering of sending and receiving messages with same
-         * source (send) or destination (rec) for unresolved cases
+         * The portfolio search posts a different branching on each of its clones.
          */
-        for(size_t k = 0; k < apps->n_programChannels() + platform->nodes(); k++){
-            assign(*this, recNext[k], INT_ASSIGN_MIN());
-        }
-        branch(*this, sendNext, INT_VAR_NONE(), INT_VAL_MIN());
-
-        branch(*this, proc, INT_VAR_NONE(), INT_VAL(&valueProc));
+        if(cfg->settings().search != Config::PORTFOLIO)
+            postBranching(0, 0);
     }else{ /**< end of SDF related constraints and branching. */
         /**
          * Memory
          */
         cout << "Inserting memory constraints \n";
 #include "memory.constraints"
+        afcModes = false;
+        if(cfg->settings().search != Config::PORTFOLIO)
+            postBranching(0, 0);
+    }
+
+    /**
+     * The PARETO search keeps each solution from being dominated by the ones found before.
+     */
+    if(cfg->settings().search == Config::PARETO){
+        pareto = make_shared<ParetoArchive>();
+        paretoDominance(*this, paretoObjectives(), paretoVersion, pareto.get());
+    }
+}
+
+void SDFPROnlineModel::postBranching(int variant, unsigned int seed){
+    if(apps->n_SDFActors() <= 0){
         /**
          * Branching for the periodic tasks
          * Since the tasks are ordered from heavy to light,
@@ -384,9 +387,149 @@ SDFPROnlineModel::SDFPROnlineModel(Mapping* p_mapping, Config* _cfg):
          * We also use valueProc to select the minimu slack proccessor
          * to mimic bestfit algorithm
          */
-        branch(*this, proc, INT_VAR_NONE(), INT_VAL(&valueProc));
+        if(variant % 4 == 2){
+            Rnd r(seed);
+            branchMapping(proc, INT_VAR_NONE(), INT_VAL_RND(r));
+        }else{
+            branchMapping(proc, INT_VAR_NONE(), INT_VAL(&valueProc));
+        }
         branch(*this, proc_mode, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
+        return;
     }
+
+    switch(variant % 4){
+        case 1: /**< conflict-driven: actors and modes by accumulated failure count. */
+            branchMapping(procBranchOrder, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
+            branch(*this, proc_mode, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
+            break;
+        case 2: { /**< randomized actor and value selection. */
+            Rnd r(seed);
+            branchMapping(procBranchOrder, INT_VAR_RND(r), INT_VAL_RND(r));
+            branch(*this, proc_mode, INT_VAR_NONE(), INT_VAL_RND(r));
+            break;
+        }
+        case 3: /**< best fit: least loaded processor, fastest modes first. */
+            branchMapping(procBranchOrder, INT_VAR_NONE(), INT_VAL(&valueProc));
+            branch(*this, proc_mode, INT_VAR_NONE(), INT_VAL_MAX());
+            break;
+        default: /**< applications sorted by period slack over their WCETs. */
+            branchMapping(procBranchOrder, INT_VAR_NONE(), INT_VAL_MIN());
+            if(afcModes)
+                branch(*this, proc_mode, INT_VAR_AFC_MAX(0.99), INT_VAL_MIN());
+            else
+                branch(*this, proc_mode, INT_VAR_NONE(), INT_VAL_MIN());
+            break;
+    }
+
+    //branch(*this, rank, INT_VAR_NONE(), INT_VAL_MIN());
+    branch(*this, next, INT_VAR_NONE(), INT_VAL_MIN());
+    branch(*this, tdmaAlloc, INT_VAR_NONE(), INT_VAL_MIN());
+    /**
+     * ordering of sending and receiving messages with same
+     * source (send) or destination (rec) for unresolved cases
+     */
+    for(size_t k = 0; k < apps->n_programChannels() + platform->nodes(); k++){
+        assign(*this, recNext[k], INT_ASSIGN_MIN());
+    }
+    branch(*this, sendNext, INT_VAR_NONE(), INT_VAL_MIN());
+
+    branch(*this, proc, INT_VAR_NONE(), INT_VAL(&valueProc));
+}
+
+void SDFPROnlineModel::branchMapping(const IntVarArgs& x, IntVarBranch vars, IntValBranch vals){
+    /**
+     * LDSB prunes the values symmetric to a refuted one only if the posted
+     * constraints are symmetric, which the designs fixed by LNS and the
+     * presolver are not. The classes do not consider the WCETs of IPT tasks.
+     */
+    Symmetries syms;
+    if(cfg->settings().symmetry == Config::SYM_LDSB && apps->n_IPTTasks() == 0 &&
+       cfg->settings().search != Config::LNS && !cfg->is_presolved()){
+        for(auto& c : mapping->homogeneousModeClasses()){
+            if(c.size() > 1)
+                syms << ValueSymmetry(IntArgs(c));
+        }
+    }
+    if(syms.size() > 0)
+        branch(*this, x, vars, vals, syms);
+    else
+        branch(*this, x, vars, vals);
+}
+
+bool SDFPROnlineModel::objective(IntVar& obj) const{
+    switch(cfg->settings().criteria[0]){
+        case(Config::POWER):
+            obj = sys_power;
+            return true;
+        case(Config::THROUGHPUT):
+            for(size_t i = 0; i < apps->n_SDFApps(); i++){
+                if(apps->getPeriodConstraint(i) == -1){
+                    obj = period[i];
+                    return true;
+                }
+            }
+            return false;
+        case(Config::LATENCY):
+            for(size_t i = 0; i < apps->n_SDFApps(); i++){
+                if(apps->getLatencyConstraint(i) == -1){
+                    obj = latency[i];
+                    return true;
+                }
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+IntVarArgs SDFPROnlineModel::paretoObjectives() const{
+    IntVarArgs objs;
+    for(auto criterion : cfg->settings().criteria){
+        switch(criterion){
+            case(Config::POWER):
+                objs << sys_power;
+                break;
+            case(Config::THROUGHPUT):
+                for(size_t i = 0; i < apps->n_SDFApps(); i++){
+                    if(apps->getPeriodConstraint(i) == -1)
+                        objs << period[i];
+                }
+                break;
+            case(Config::LATENCY):
+                for(size_t i = 0; i < apps->n_SDFApps(); i++){
+                    if(apps->getLatencyConstraint(i) == -1)
+                        objs << latency[i];
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return objs;
+}
+
+vector<int> SDFPROnlineModel::paretoPoint() const{
+    IntVarArgs objs = paretoObjectives();
+    vector<int> point;
+    //latency is not branched on and may be unassigned, its lower bound is the
+    //latency of the solution
+    for(int k = 0; k < objs.size(); k++){
+        point.push_back(objs[k].min());
+    }
+    return point;
+}
+
+ParetoArchive* SDFPROnlineModel::getParetoFront() const{
+    return pareto.get();
+}
+
+void SDFPROnlineModel::shareIncumbent(std::atomic<int>* bound){
+    IntVar obj;
+    if(!objective(obj))
+        return;
+    IntVarArgs decisions(proc);
+    decisions << IntVarArgs(next);
+    sharedBound(*this, obj, decisions, bound);
 }
 
 SDFPROnlineModel::SDFPROnlineModel(bool share, SDFPROnlineModel& s):
@@ -395,7 +538,9 @@ SDFPROnlineModel::SDFPROnlineModel(bool share, SDFPROnlineModel& s):
     platform(s.platform),
     mapping(s.mapping),
     cfg(s.cfg),
-    least_power_est(s.least_power_est){
+    least_power_est(s.least_power_est),
+    afcModes(s.afcModes),
+    pareto(s.pareto){
 
     next.update(*this, share, s.next);
     rank.update(*this, share, s.rank);
@@ -422,9 +567,12 @@ SDFPROnlineModel::SDFPROnlineModel(bool share, SDFPROnlineModel& s):
     wcct_b.update(*this, share, s.wcct_b);
     wcct_s.update(*this, share, s.wcct_s);
     wcct_r.update(*this, share, s.wcct_r);
+    paretoVersion.update(*this, share, s.paretoVersion);
+    procBranchOrder.update(*this, share, s.procBranchOrder);
 }
 
 Space* SDFPROnlineModel::copy(bool share) {
+    tools::CloneStats::clone(sizeof(*this));
     return new SDFPROnlineModel(share, *this);
 }
 
@@ -506,6 +654,44 @@ vector<int> SDFPROnlineModel::getPeriodResults() {
     return periods;
 }
 
+int SDFPROnlineModel::getPowerResult() const {
+    return sys_power.min();
+}
+
+int SDFPROnlineModel::getTDMASlotsResult() const {
+    int slots = 0;
+    for(auto j = 0; j < tdmaAlloc.size(); j++){
+        slots += tdmaAlloc[j].min();
+    }
+    return slots;
+}
+
+vector<vector<int>> SDFPROnlineModel::extractDesign() const {
+    vector<vector<int>> design;
+    for(const IntVarArray* x : {&proc, &proc_mode, &tdmaAlloc, &next, &sendNext, &recNext}){
+        vector<int> values;
+        for(auto i = 0; i < x->size(); i++){
+            values.push_back((*x)[i].val());
+        }
+        design.push_back(values);
+    }
+    return design;
+}
+
+vector<int> SDFPROnlineModel::extractObjectives() const {
+    vector<int> objectives;
+    for(auto i = 0; i < period.size(); i++){
+        objectives.push_back(period[i].val());
+    }
+    //latency is not branched on, its lower bound is the latency of the solution
+    //(as in extractResult)
+    for(auto i = 0; i < latency.size(); i++){
+        objectives.push_back(latency[i].min());
+    }
+    objectives.push_back(sys_power.val());
+    return objectives;
+}
+
 int SDFPROnlineModel::valueProc(const Space& home, IntVar x, int i) {
     int min_slack_proc = x.min();
 
@@ -678,3 +864,165 @@ void SDFPROnlineModel::set_design(vector<int> _map, vector<int> _mod, vector<int
     }
     
 }
+
+vector<bool> SDFPROnlineModel::neighbourhood(Neighbourhood kind, double size, std::mt19937& rng) const
+{
+    const size_t n = apps->n_programEntities();
+    const size_t n_procs = platform->nodes();
+    const size_t target = min(n, max((size_t)2, (size_t)ceil(size * n)));
+    vector<bool> freeEntities(n, false);
+    size_t n_free = 0;
+    auto release = [&](size_t i){
+        if(i < n && !freeEntities[i]){
+            freeEntities[i] = true;
+            n_free++;
+        }
+    };
+
+    switch(kind){
+        case NB_APPLICATION: {
+            vector<size_t> order(apps->n_SDFApps());
+            iota(order.begin(), order.end(), 0);
+            shuffle(order.begin(), order.end(), rng);
+            for(size_t a : order){
+                if(n_free >= target)
+                    break;
+                for(size_t i = 0; i < apps->n_SDFActors(); i++){
+                    if(apps->getSDFGraph(i) == a)
+                        release(i);
+                }
+            }
+            break;
+        }
+        case NB_PROCESSOR: {
+            vector<int> order(n_procs);
+            iota(order.begin(), order.end(), 0);
+            shuffle(order.begin(), order.end(), rng);
+            //two processors at least, otherwise nothing can move
+            for(size_t k = 0; k < order.size() && (n_free < target || k < 2); k++){
+                for(size_t i = 0; i < n; i++){
+                    if(proc[i].val() == order[k])
+                        release(i);
+                }
+            }
+            break;
+        }
+        case NB_CRITICAL: {
+            //the application optimized by constrain(), otherwise the one with the longest period
+            int app = -1;
+            for(size_t a = 0; a < apps->n_SDFApps(); a++){
+                if(cfg->settings().criteria[0] == Config::THROUGHPUT && apps->getPeriodConstraint(a) == -1){
+                    app = a;
+                    break;
+                }
+                if(app == -1 || period[a].min() > period[app].min())
+                    app = a;
+            }
+            int critProc = -1;
+            for(size_t i = 0; i < apps->n_SDFActors() && app >= 0; i++){
+                int j = proc[i].val();
+                if(apps->getSDFGraph(i) == (size_t)app && (critProc == -1 || utilization[j].min() > utilization[critProc].min()))
+                    critProc = j;
+            }
+            for(size_t i = 0; i < apps->n_SDFActors() && critProc >= 0; i++){
+                if(proc[i].val() != critProc)
+                    continue;
+                release(i);
+                for(int p : apps->predecessorIds(i))
+                    release(p);
+                for(int p : apps->successorIds(i))
+                    release(p);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    uniform_int_distribution<size_t> pick(0, n-1);
+    while(n_free < target){
+        release(pick(rng));
+    }
+    return freeEntities;
+}
+
+bool SDFPROnlineModel::relax_design(const SDFPROnlineModel& inc, const vector<bool>& freeEntities)
+{
+    const size_t n_actors = apps->n_SDFActors();
+    const size_t n_procs = platform->nodes();
+    //with all entities free, nothing is enforced (not even on idle processors)
+    if(find(freeEntities.begin(), freeEntities.end(), false) == freeEntities.end())
+        return true;
+
+    /**
+     * A processor is open if a free entity is on it in inc. The free entities
+     * may also move to a few idle processors of inc on which one of them can
+     * run (valid WCET), the lowest ones, which the ordering symmetry breaking
+     * fills first.
+     */
+    const size_t maxIdleProcs = 2;
+    vector<bool> openProc(n_procs, false);
+    vector<bool> usedProc(n_procs, false);
+    for(size_t i = 0; i < freeEntities.size(); i++){
+        usedProc[inc.proc[i].val()] = true;
+        if(freeEntities[i])
+            openProc[inc.proc[i].val()] = true;
+    }
+    size_t n_idle = 0;
+    for(size_t j = 0; j < n_procs && n_idle < maxIdleProcs; j++){
+        if(usedProc[j])
+            continue;
+        for(size_t i = 0; i < freeEntities.size(); i++){
+            if(freeEntities[i] && mapping->getValidModes(i, j) != 0){
+                openProc[j] = true;
+                n_idle++;
+                break;
+            }
+        }
+    }
+
+    IntArgs open;
+    for(size_t j = 0; j < n_procs; j++){
+        if(openProc[j])
+            open << j;
+    }
+    IntSet openProcs(open);
+    for(size_t i = 0; i < freeEntities.size(); i++){
+        if(freeEntities[i])
+            dom(*this, proc[i], openProcs);
+        else
+            rel(*this, proc[i]==inc.proc[i].val());
+    }
+    for(size_t j = 0; j < n_procs; j++){
+        if(openProc[j])
+            continue;
+        rel(*this, proc_mode[j]==inc.proc_mode[j].val());
+        rel(*this, tdmaAlloc[j]==inc.tdmaAlloc[j].val());
+    }
+    /**
+     * The static orders of the closed processors stay, next[n+j] points to
+     * the first actor of processor j+1.
+     */
+    for(size_t i = 0; i < n_actors; i++){
+        if(!openProc[inc.proc[i].val()])
+            rel(*this, next[i]==inc.next[i].val());
+    }
+    for(size_t j = 0; j < n_procs && n_actors > 0; j++){
+        if(!openProc[(j+1) % n_procs])
+            rel(*this, next[n_actors+j]==inc.next[n_actors+j].val());
+    }
+    /**
+     * Message orders only stay for channels between closed processors.
+     */
+    vector<SDFChannel*> channels = apps->getChannels();
+    for(size_t k = 0; k < channels.size() && k < apps->n_programChannels(); k++){
+        if(!openProc[inc.proc[channels[k]->source].val()] && !openProc[inc.proc[channels[k]->destination].val()]){
+            rel(*this, sendNext[k]==inc.sendNext[k].val());
+            rel(*this, recNext[k]==inc.recNext[k].val());
+        }
+    }
+    for(size_t k = 0; k < channels.size(); k++){
+        delete channels[k];
+    }
+    return false;
+}
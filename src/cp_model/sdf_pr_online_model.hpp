@@ -30,6 +30,11 @@
  */
 #include <math.h>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <numeric>
+#include <algorithm>
 
 #include <gecode/int.hh>
 #include <gecode/set.hh>
@@ -43,6 +48,10 @@
 #include "../throughput/throughputSSE.hpp"
 #include "../throughput/throughputMCR.hpp"
 #include "schedulability.hpp"
+#include "successorChain.hpp"
+#include "periodBound.hpp"
+#include "sharedBound.hpp"
+#include "paretoDominance.hpp"
 #include "../settings/dse_settings.hpp"
 
 using namespace Gecode;
@@ -93,9 +102,19 @@ private:
     IntVarArray             wcct_b;                    /**< communication delay, block (pre-send-wait). */
     IntVarArray             wcct_s;                    /**< communication delay, send. */
     IntVarArray             wcct_r;                    /**< coummunication delay, receive */
+    IntVar                  paretoVersion;          /**< number of front points this space is constrained by (PARETO). */
+    IntVarArray             procBranchOrder;        /**< mapping variables in the order they are branched on. */
     
 
     int                        least_power_est;        /**< estimated least power consumption. */
+    bool                    afcModes;                /**< branch on the modes of the most conflicting procs first. */
+    shared_ptr<ParetoArchive> pareto;                /**< front found by the PARETO search, shared by all spaces. */
+
+    /**
+     * Branches on mapping variables x, with value symmetries between the
+     * interchangeable processors if dse.symmetry is LDSB.
+     */
+    void branchMapping(const IntVarArgs& x, IntVarBranch vars, IntValBranch vals);
   
 public:
 
@@ -142,6 +161,10 @@ public:
     {
         const SDFPROnlineModel& b = static_cast<const SDFPROnlineModel&>(_b);
 
+        if(cfg->settings().search == Config::PARETO){
+            rel(*this, paretoVersion >= pareto->add(b.paretoPoint()));
+            return;
+        }
         switch(cfg->settings().criteria[0]) //creates the model based on the first criterion
         {
             case(Config::POWER):
@@ -170,6 +193,59 @@ public:
     }
   
     vector<int> getPeriodResults();
+    /**
+     * Gets the long-run power consumption of the system in a solution.
+     */
+    int getPowerResult() const;
+    /**
+     * Gets the number of TDMA slots allocated to all processors in a solution.
+     */
+    int getTDMASlotsResult() const;
+    /**
+     * Gets the decisions of a solution in the order of the arguments of
+     * set_design: mappings, modes, TDMA slots, next, sendNext and recNext.
+     */
+    vector<vector<int>> extractDesign() const;
+    /**
+     * Gets the objectives of a solution: the periods, the latencies and the
+     * power consumption of the system.
+     */
+    vector<int> extractObjectives() const;
+
+    /**
+     * Posts the branching of the model. Variant 0 is the default branching,
+     * posted by the constructor unless the search is PORTFOLIO, in which case
+     * the portfolio posts one variant on each clone:
+     * 0: applications by period slack, INT_VAL_MIN,
+     * 1: AFC-max on mappings and modes,
+     * 2: random variable and value selection seeded with seed,
+     * 3: least loaded processor (valueProc) and fastest modes first.
+     */
+    void postBranching(int variant, unsigned int seed);
+    /**
+     * Gets the variable minimized by constrain(), false if the first
+     * criterion has no objective in this model. Latency is not branched on,
+     * so in a solution the objective value is obj.min().
+     */
+    bool objective(IntVar& obj) const;
+    /**
+     * Bounds the objective by a value shared with other searches.
+     */
+    void shareIncumbent(std::atomic<int>* bound);
+    /**
+     * Gets the objectives of the PARETO search, all minimized: the periods and
+     * latencies of the applications without a constraint on them, and the
+     * power consumption, in the order of dse.criteria.
+     */
+    IntVarArgs paretoObjectives() const;
+    /**
+     * Gets the values (lower bounds) of paretoObjectives() in a solution.
+     */
+    vector<int> paretoPoint() const;
+    /**
+     * Gets the front found so far by the PARETO search, nullptr for other searches.
+     */
+    ParetoArchive* getParetoFront() const;
     
     /**
     * Returns the processor number which task i has to be allocated.
@@ -186,6 +262,30 @@ public:
      * @param _recNext Receive Next 
      */ 
     void set_design(vector<int>,vector<int>,vector<int>,vector<int>,vector<int>,vector<int>);    
+    /**
+     * Kinds of neighbourhoods relaxed by the LNS search.
+     */
+    enum Neighbourhood {
+        NB_APPLICATION, /**< all actors of random applications. */
+        NB_PROCESSOR,   /**< all entities on random processors. */
+        NB_CRITICAL,    /**< actors on the most utilized processor of the critical application and their neighbours. */
+        NB_RANDOM,      /**< random entities. */
+        NB_KINDS
+    };
+    /**
+     * Selects the entities to relax from this (solved) design. At least
+     * size * n_programEntities() entities are selected, topped up at random.
+     */
+    vector<bool> neighbourhood(Neighbourhood kind, double size, std::mt19937& rng) const;
+    /**
+     * Enforces the design of the solved space inc except for the entities in
+     * freeEntities, and the schedules, modes and TDMA slots of the processors
+     * these are mapped on in inc and of up to two idle processors they can be
+     * moved to (valid WCET). The free entities stay on these processors. If
+     * all entities are free, all processors are open.
+     * @return true if nothing of inc was enforced
+     */
+    bool relax_design(const SDFPROnlineModel& inc, const vector<bool>& freeEntities);
 };
 
 #endif
@@ -0,0 +1,75 @@
+#include "sharedBound.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+namespace {
+  const size_t profileKind = tools::PropStats::kind("SharedBound");
+}
+
+SharedBound::SharedBound(Space& home,
+                         IntView _obj,
+                         ViewArray<IntView> _decisions,
+                         std::atomic<int>* _bound)
+  : Propagator(home), obj(_obj), decisions(_decisions), bound(_bound) {
+
+  obj.subscribe(home, *this, Int::PC_INT_BND);
+  decisions.subscribe(home, *this, Int::PC_INT_VAL);
+}
+
+size_t SharedBound::dispose(Space& home){
+  obj.cancel(home, *this, Int::PC_INT_BND);
+  decisions.cancel(home, *this, Int::PC_INT_VAL);
+  (void) Propagator::dispose(home);
+  return sizeof(*this);
+}
+
+SharedBound::SharedBound(Space& home, bool share, SharedBound& p)
+  : Propagator(home, share, p), bound(p.bound) {
+
+  obj.update(home, share, p.obj);
+  decisions.update(home, share, p.decisions);
+}
+
+Propagator* SharedBound::copy(Space& home, bool share){
+  tools::CloneStats::record(sizeof(*this));
+  return new (home) SharedBound(home, share, *this);
+}
+
+PropCost SharedBound::cost(const Space& home, const ModEventDelta& med) const{
+  return PropCost::unary(PropCost::LO);
+}
+
+ExecStatus SharedBound::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus SharedBound::filter(Space& home, const ModEventDelta&){
+  int b = bound->load(std::memory_order_relaxed);
+  if(b != numeric_limits<int>::max()){
+    GECODE_ME_CHECK(obj.le(home, b));
+  }
+  //a found solution is checked against the bound it was found with
+  if(obj.assigned())
+    return home.ES_SUBSUMED(*this);
+  return ES_FIX;
+}
+
+void sharedBound(Space& home,
+                 IntVar _obj,
+                 const IntVarArgs& _decisions,
+                 std::atomic<int>* _bound)
+{
+  if (home.failed())
+    return;
+
+  IntView tmp_obj(_obj);
+  ViewArray<Int::IntView> tmp_decisions(home, _decisions);
+  if (SharedBound::post(home, tmp_obj, tmp_decisions, _bound) != ES_OK) {
+    home.fail();
+  }
+}
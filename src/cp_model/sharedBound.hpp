@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+#include <gecode/int.hh>
+#include <atomic>
+#include <limits>
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+/**
+ * Keeps the objective of a space strictly below a bound shared between
+ * the spaces of concurrently running searches (see the PORTFOLIO search).
+ *
+ * A search only posts its own solutions through constrain(); the bound
+ * published by the other searches is read again whenever one of the
+ * decision variables gets assigned, so a worker prunes with the best
+ * incumbent found so far by any worker. The bound is owned by the
+ * caller and has to outlive all spaces holding the propagator.
+ */
+class SharedBound : public Propagator {
+
+protected:
+  IntView obj;                  /*!< objective, minimized. */
+  ViewArray<IntView> decisions; /*!< variables whose assignment triggers a re-read of the bound. */
+  std::atomic<int>* bound;      /*!< best objective value found by any search. */
+
+public:
+  SharedBound(Space& home,
+              IntView _obj,
+              ViewArray<IntView> _decisions,
+              std::atomic<int>* _bound);
+
+  static ExecStatus post(Space& home,
+                         IntView _obj,
+                         ViewArray<IntView> _decisions,
+                         std::atomic<int>* _bound){
+    (void) new (home) SharedBound(home, _obj, _decisions, _bound);
+    return ES_OK;
+  }
+
+  virtual size_t dispose(Space& home);
+
+  SharedBound(Space& home, bool share, SharedBound& p);
+
+  virtual Propagator* copy(Space& home, bool share);
+
+  virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+
+  virtual ExecStatus propagate(Space& home, const ModEventDelta&);
+
+protected:
+  /** Bounds the objective by the shared value as last read. */
+  ExecStatus filter(Space& home, const ModEventDelta& med);
+};
+
+/**
+ * Posts the shared-bound propagator.
+ * @param _obj objective variable
+ * @param _decisions branching variables
+ * @param _bound incumbent shared by the searches, initially
+ *        std::numeric_limits<int>::max()
+ */
+extern void sharedBound(Space& home,
+                        IntVar _obj,
+                        const IntVarArgs& _decisions,
+                        std::atomic<int>* _bound);
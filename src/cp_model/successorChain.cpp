@@ -0,0 +1,308 @@
+#include "successorChain.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+namespace {
+  const size_t profileKind = tools::PropStats::kind("SuccessorChain");
+}
+
+namespace {
+  /**
+   * Returns true if the modification failed, otherwise records in
+   * modified whether a domain changed.
+   */
+  inline bool failedOrModified(ModEvent me, bool& modified){
+    if(me_failed(me))
+      return true;
+    if(me != ME_INT_NONE)
+      modified = true;
+    return false;
+  }
+}
+
+SuccessorChain::SuccessorChain(Space& home,
+                               ViewArray<IntView> _next,
+                               ViewArray<IntView> _rank,
+                               ViewArray<IntView> _proc,
+                               IntArgs _before,
+                               int _n_procs)
+  : Propagator(home), next(_next), rank(_rank), proc(_proc),
+    before(_before), n_actors(_rank.size()), n_procs(_n_procs) {
+
+  next.subscribe(home, *this, Int::PC_INT_DOM);
+  rank.subscribe(home, *this, Int::PC_INT_BND);
+  proc.subscribe(home, *this, Int::PC_INT_DOM);
+}
+
+size_t SuccessorChain::dispose(Space& home){
+  next.cancel(home, *this, Int::PC_INT_DOM);
+  rank.cancel(home, *this, Int::PC_INT_BND);
+  proc.cancel(home, *this, Int::PC_INT_DOM);
+  before.~IntSharedArray();
+  (void) Propagator::dispose(home);
+  return sizeof(*this);
+}
+
+SuccessorChain::SuccessorChain(Space& home, bool share, SuccessorChain& p)
+  : Propagator(home, share, p),
+    n_actors(p.n_actors),
+    n_procs(p.n_procs) {
+
+  next.update(home, share, p.next);
+  rank.update(home, share, p.rank);
+  proc.update(home, share, p.proc);
+  before.update(home, share, p.before);
+}
+
+Propagator* SuccessorChain::copy(Space& home, bool share){
+  tools::CloneStats::record(sizeof(*this));
+  return new (home) SuccessorChain(home, share, *this);
+}
+
+PropCost SuccessorChain::cost(const Space& home, const ModEventDelta& med) const{
+  return PropCost::quadratic(PropCost::HI, n_actors);
+}
+
+ExecStatus SuccessorChain::filterSuccessors(Space& home, bool& modified){
+  vector<int> values;
+  for(int i = 0; i < n_actors; i++){
+    if(next[i].assigned() && next[i].val() < n_actors){
+      int j = next[i].val();
+      //an actor and its successor share the processor...
+      for(int k = 0; k < 2; k++){
+        IntView& a = k == 0 ? proc[i] : proc[j];
+        IntView& b = k == 0 ? proc[j] : proc[i];
+        values.clear();
+        for(ViewValues<IntView> v(a); v(); ++v){
+          if(!b.in(v.val()))
+            values.push_back(v.val());
+        }
+        for(int val : values){
+          if(failedOrModified(a.nq(home, val), modified))
+            return ES_FAILED;
+        }
+      }
+      //...and the successor has the higher rank
+      if(failedOrModified(rank[j].gq(home, rank[i].min()+1), modified))
+        return ES_FAILED;
+      if(failedOrModified(rank[i].lq(home, rank[j].max()-1), modified))
+        return ES_FAILED;
+    }else if(!next[i].assigned()){
+      values.clear();
+      for(ViewValues<IntView> v(next[i]); v(); ++v){
+        int j = v.val();
+        if(j >= n_actors)
+          break;
+        if(j == i || precedes(j, i) || rank[j].max() <= rank[i].min()){
+          values.push_back(j);
+          continue;
+        }
+        bool sharedProc = false;
+        for(ViewValues<IntView> p(proc[i]); p() && !sharedProc; ++p){
+          sharedProc = proc[j].in(p.val());
+        }
+        if(!sharedProc)
+          values.push_back(j);
+      }
+      for(int val : values){
+        if(failedOrModified(next[i].nq(home, val), modified))
+          return ES_FAILED;
+      }
+    }
+  }
+  return ES_OK;
+}
+
+ExecStatus SuccessorChain::filterProcessors(Space& home, bool& modified){
+  vector<int> values;
+  for(int i = 0; i < n_actors; i++){
+    //next[i]==n+j only if i can run on proc j
+    values.clear();
+    for(int j = 0; j < n_procs; j++){
+      if(next[i].in(n_actors+j) && !proc[i].in(j))
+        values.push_back(n_actors+j);
+    }
+    for(int val : values){
+      if(failedOrModified(next[i].nq(home, val), modified))
+        return ES_FAILED;
+    }
+    //if i is the last actor on some proc, it is on one of those procs
+    if(next[i].min() >= n_actors){
+      values.clear();
+      for(ViewValues<IntView> p(proc[i]); p(); ++p){
+        if(!next[i].in(n_actors+p.val()))
+          values.push_back(p.val());
+      }
+      for(int val : values){
+        if(failedOrModified(proc[i].nq(home, val), modified))
+          return ES_FAILED;
+      }
+    }
+  }
+
+  for(int i = 0; i < n_actors; i++){
+    if(!proc[i].assigned())
+      continue;
+    bool last = next[i].min() >= n_actors;
+    for(int j = 0; j < n_actors; j++){
+      if(j == i || !proc[j].assigned() || proc[j].val() != proc[i].val())
+        continue;
+      //no two actors on the same proc share a rank
+      if(rank[i].assigned()){
+        if(failedOrModified(rank[j].nq(home, rank[i].val()), modified))
+          return ES_FAILED;
+      }
+      //the last actor on a proc has the highest rank on that proc
+      if(last){
+        if(failedOrModified(rank[i].gq(home, rank[j].min()+1), modified))
+          return ES_FAILED;
+        if(failedOrModified(rank[j].lq(home, rank[i].max()-1), modified))
+          return ES_FAILED;
+      }
+      //a same-proc predecessor rules out i being last and j being first
+      if(precedes(i, j)){
+        if(failedOrModified(next[i].le(home, n_actors), modified))
+          return ES_FAILED;
+        for(int k = n_actors; k < next.size(); k++){
+          if(failedOrModified(next[k].nq(home, j), modified))
+            return ES_FAILED;
+        }
+      }
+    }
+  }
+  return ES_OK;
+}
+
+SuccessorChain::Workspace& SuccessorChain::workspace(){
+  static thread_local Workspace w;
+  return w;
+}
+
+ExecStatus SuccessorChain::filterChains(Space& home, bool& modified){
+  Workspace& w = workspace();
+  vector<int>& pred = w.pred;
+  pred.assign(n_actors, -1);
+  for(int i = 0; i < n_actors; i++){
+    if(next[i].assigned() && next[i].val() < n_actors){
+      if(pred[next[i].val()] != -1)
+        return ES_FAILED;
+      pred[next[i].val()] = i;
+    }
+  }
+
+  //walk the segments of assigned successors, starting from their heads
+  vector<int>& segOf = w.segOf;
+  vector<int>& order = w.order;
+  vector<int>& segFirst = w.segFirst;
+  segOf.assign(n_actors, -1);
+  order.clear();
+  segFirst.clear();
+  for(int h = 0; h < n_actors; h++){
+    if(pred[h] != -1)
+      continue;
+    segFirst.push_back(order.size());
+    int x = h;
+    while(true){
+      segOf[x] = segFirst.size()-1;
+      order.push_back(x);
+      if(!next[x].assigned() || next[x].val() >= n_actors)
+        break;
+      x = next[x].val();
+    }
+  }
+  const size_t n_segments = segFirst.size();
+  segFirst.push_back(order.size());
+
+  //within a segment, no actor may come before one it must follow,
+  //and the row of s in succ collects all actors that must follow some actor of s
+  const size_t words = (n_actors + 63) / 64;
+  vector<uint64_t>& succ = w.succ;
+  succ.assign(n_segments * words, 0);
+  for(size_t s = 0; s < n_segments; s++){
+    uint64_t* row = &succ[s * words];
+    for(int a = segFirst[s]; a < segFirst[s+1]; a++){
+      for(int b = a+1; b < segFirst[s+1]; b++){
+        if(precedes(order[b], order[a]))
+          return ES_FAILED;
+      }
+      for(int j = 0; j < n_actors; j++){
+        if(precedes(order[a], j))
+          row[j / 64] |= uint64_t(1) << (j % 64);
+      }
+    }
+  }
+
+  //linking tail t to head h puts all of seg(t) before all of seg(h)
+  vector<int>& values = w.values;
+  for(size_t s = 0; s < n_segments; s++){
+    int t = order[segFirst[s+1]-1];
+    if(next[t].assigned())
+      continue;
+    values.clear();
+    for(ViewValues<IntView> v(next[t]); v(); ++v){
+      int h = v.val();
+      if(h >= n_actors)
+        break;
+      if(segOf[h] < 0 || pred[h] != -1 || segOf[h] == (int)s)
+        continue;
+      const uint64_t* after = &succ[segOf[h] * words];
+      for(int a = segFirst[s]; a < segFirst[s+1]; a++){
+        int b = order[a];
+        if(after[b / 64] >> (b % 64) & 1){
+          values.push_back(h);
+          break;
+        }
+      }
+    }
+    for(int val : values){
+      if(failedOrModified(next[t].nq(home, val), modified))
+        return ES_FAILED;
+    }
+  }
+  return ES_OK;
+}
+
+ExecStatus SuccessorChain::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus SuccessorChain::filter(Space& home, const ModEventDelta&){
+  bool modified = false;
+  GECODE_ES_CHECK(filterSuccessors(home, modified));
+  GECODE_ES_CHECK(filterProcessors(home, modified));
+  GECODE_ES_CHECK(filterChains(home, modified));
+
+  if(modified)
+    return ES_NOFIX;
+  if(next.assigned() && rank.assigned() && proc.assigned())
+    return home.ES_SUBSUMED(*this);
+  return ES_FIX;
+}
+
+void successorChain(Space& home,
+                    const IntVarArgs& _next,
+                    const IntVarArgs& _rank,
+                    const IntVarArgs& _proc,
+                    const IntArgs& _before)
+{
+  if (home.failed())
+    return;
+
+  if (_rank.size() != _proc.size()) {
+    throw Gecode::Int::ArgumentSizeMismatch("SuccessorChain constraint, rank & proc");
+  }
+  if (_next.size() < _rank.size() || _before.size() != _rank.size()*_rank.size()) {
+    throw Gecode::Int::ArgumentSizeMismatch("SuccessorChain constraint, next & before");
+  }
+  ViewArray<Int::IntView> tmp_next(home, _next);
+  ViewArray<Int::IntView> tmp_rank(home, _rank);
+  ViewArray<Int::IntView> tmp_proc(home, _proc);
+  if (SuccessorChain::post(home, tmp_next, tmp_rank, tmp_proc, _before, _next.size()-_rank.size()) != ES_OK) {
+    home.fail();
+  }
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+#include <gecode/int.hh>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+using namespace Gecode;
+using namespace Int;
+using namespace std;
+
+/**
+ * Global propagator over the static-order variables of the SDF actors.
+ *
+ * next[0..n-1] are the successors of the actors, next[n..n+p-1] the dummy
+ * nodes closing the circuit (next[i]==n+j means i is the last actor on proc j).
+ * The propagator replaces the reified decomposition in scheduling.constraints
+ * (selected with dse.sched_prop=CHAIN) and enforces:
+ *  - an actor successor runs on the same processor and has a higher rank,
+ *  - n+j is only a successor of actors that may run on proc j,
+ *  - the last actor of a processor has the highest rank on it and no
+ *    two actors on one processor share a rank,
+ *  - chains of assigned successors respect the precedence (path) matrix, and
+ *    two chains are only linked if no precedence runs from the later chain
+ *    into the earlier one.
+ * Filtering is quadratic in the number of actors per propagation.
+ */
+class SuccessorChain : public Propagator {
+
+protected:
+  ViewArray<IntView> next; /*!< successors of actors and dummy nodes. */
+  ViewArray<IntView> rank; /*!< rank of each actor in the static order. */
+  ViewArray<IntView> proc; /*!< mapping of the actors. */
+  IntSharedArray before;   /*!< n x n, before[i*n+j]==1 iff i must precede j on a shared proc. */
+  const int n_actors;
+  const int n_procs;
+
+  bool precedes(int i, int j) const { return before[i*n_actors+j] != 0; }
+  //scratch data of filterChains, kept once per thread instead of per propagation
+  class Workspace{
+    public:
+      vector<int> pred;       //assigned actor predecessor, -1 if none
+      vector<int> segOf;      //segment of each actor
+      vector<int> order;      //the actors of all segments, segment by segment
+      vector<int> segFirst;   //order[segFirst[s]..segFirst[s+1]-1] are the actors of segment s
+      vector<uint64_t> succ;  //per segment, bit j is set if j must follow an actor of it
+      vector<int> values;
+  };
+  static Workspace& workspace();
+  /**
+   * Same-processor and rank consistency of each (possible) actor successor.
+   */
+  ExecStatus filterSuccessors(Space& home, bool& modified);
+  /**
+   * Consistency between the dummy successors and the processor of an actor,
+   * and the rank properties per processor.
+   */
+  ExecStatus filterProcessors(Space& home, bool& modified);
+  /**
+   * Precedence filtering over the chain segments formed by assigned successors.
+   */
+  ExecStatus filterChains(Space& home, bool& modified);
+
+public:
+  SuccessorChain(Space& home,
+                 ViewArray<IntView> _next,
+                 ViewArray<IntView> _rank,
+                 ViewArray<IntView> _proc,
+                 IntArgs _before,
+                 int _n_procs);
+
+  static ExecStatus post(Space& home,
+                         ViewArray<IntView> _next,
+                         ViewArray<IntView> _rank,
+                         ViewArray<IntView> _proc,
+                         IntArgs _before,
+                         int _n_procs){
+    (void) new (home) SuccessorChain(home, _next, _rank, _proc, _before, _n_procs);
+    return ES_OK;
+  }
+
+  virtual size_t dispose(Space& home);
+
+  SuccessorChain(Space& home, bool share, SuccessorChain& p);
+
+  virtual Propagator* copy(Space& home, bool share);
+
+  virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+
+  virtual ExecStatus propagate(Space& home, const ModEventDelta&);
+
+protected:
+  /** Runs filterSuccessors, filterProcessors and filterChains. */
+  ExecStatus filter(Space& home, const ModEventDelta& med);
+};
+
+/**
+ * Posts the successor-chain propagator.
+ * @param _next successors, size |_rank| + number of procs
+ * @param _rank rank of each actor
+ * @param _proc mapping of each actor, same size as _rank
+ * @param _before flattened |_rank| x |_rank| precedence matrix (0/1)
+ */
+extern void successorChain(Space& home,
+                           const IntVarArgs& _next,
+                           const IntVarArgs& _rank,
+                           const IntVarArgs& _proc,
+                           const IntArgs& _before);
@@ -0,0 +1,201 @@
+#include "decomposition.hpp"
+#include "modelsearch.hpp"
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+
+Decomposition::Decomposition(Mapping* _mapping, const vector<Mapping::WCETEntry>& _wcets, Config& _cfg)
+  : mapping(_mapping), wcets(_wcets), cfg(_cfg) {
+  partition();
+}
+
+Decomposition::~Decomposition() {
+  for (size_t g = 0; g < groups.size(); g++) {
+    delete groupMappings[g];
+    delete groupApps[g];
+  }
+}
+
+const vector<vector<size_t>>& Decomposition::getGroups() const {
+  return groups;
+}
+
+void Decomposition::partition() {
+  Applications* apps = mapping->getApplications();
+  Platform* platform = mapping->getPlatform();
+  const size_t n_apps = apps->n_SDFApps();
+
+  //union-find over the applications, joined if they can share a processor
+  vector<size_t> root(n_apps);
+  iota(root.begin(), root.end(), 0);
+  auto find = [&root](size_t a) {
+    while (root[a] != a)
+      a = root[a] = root[root[a]];
+    return a;
+  };
+  if (apps->n_IPTTasks() > 0) {
+    for (size_t a = 1; a < n_apps; a++)
+      root[a] = 0;
+  } else {
+    vector<int> appOnProc(platform->nodes(), -1);
+    for (size_t i = 0; i < apps->n_SDFActors(); i++) {
+      size_t a = apps->getSDFGraph(i);
+      for (size_t j = 0; j < platform->nodes(); j++) {
+        if (mapping->getValidModes(i, j) == 0)
+          continue;
+        if (appOnProc[j] == -1)
+          appOnProc[j] = a;
+        else
+          root[find(a)] = find(appOnProc[j]);
+      }
+    }
+  }
+
+  vector<int> groupOf(n_apps, -1);
+  for (size_t a = 0; a < n_apps; a++) {
+    size_t r = find(a);
+    if (groupOf[r] == -1) {
+      groupOf[r] = groups.size();
+      groups.push_back(vector<size_t>());
+    }
+    groups[groupOf[r]].push_back(a);
+  }
+}
+
+void Decomposition::run() {
+  const size_t n_groups = groups.size();
+  vector<SDFPROnlineModel*> models;
+  //the inputs are read and the models built sequentially, only the searches run concurrently
+  for (size_t g = 0; g < n_groups; g++) {
+    cout << "Group " << g << ":";
+    for (size_t a : groups[g])
+      cout << " " << mapping->getApplications()->getGraphName(a);
+    cout << endl;
+    groupApps.push_back(new Applications(mapping->getApplications(), groups[g]));
+    groupMappings.push_back(new Mapping(groupApps[g], mapping->getPlatform(), wcets));
+    models.push_back(new SDFPROnlineModel(groupMappings[g], &cfg));
+    if (cfg.settings().search == Config::PORTFOLIO)
+      models[g]->postBranching(0, 0);
+  }
+
+  fronts.assign(n_groups, vector<Point>());
+  stats.assign(n_groups, Search::Statistics());
+  proved.assign(n_groups, 0);
+  auto t_start = std::chrono::high_resolution_clock::now();
+  vector<thread> threads;
+  for (size_t g = 0; g < n_groups; g++)
+    threads.push_back(thread(&Decomposition::solveGroup, this, g, models[g]));
+  for (auto& t : threads)
+    t.join();
+  auto durAll_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::high_resolution_clock::now() - t_start).count();
+
+  vector<Point> front = compose();
+  cout << "Composed " << front.size() << " non-dominated designs from " << n_groups
+       << " groups in " << durAll_ms << " ms" << endl;
+
+  ofstream out(cfg.settings().output_path + "out/decomposed.txt");
+  ofstream outCSV(cfg.settings().output_path + "out/decomposed.csv");
+  Applications* apps = mapping->getApplications();
+  for (size_t g = 0; g < n_groups; g++) {
+    out << "*** Group " << g << ":";
+    for (size_t a : groups[g])
+      out << " " << apps->getGraphName(a);
+    out << "\n" << fronts[g].size() << " non-dominated solutions" << (proved[g] ? " (search space exhausted)" : "")
+        << ", search nodes: " << stats[g].node << ", fail: " << stats[g].fail << ", propagate: "
+        << stats[g].propagate << ", depth: " << stats[g].depth << ", nogoods: " << stats[g].nogood << " ***\n";
+  }
+  out << "\n";
+  for (size_t a = 0; a < apps->n_SDFApps(); a++)
+    outCSV << "period_" << apps->getGraphName(a) << ",";
+  outCSV << "sys_power,tdma_slots" << endl;
+  for (size_t k = 0; k < front.size(); k++) {
+    const Point& p = front[k];
+    out << "*** Design " << k << ": periods:";
+    for (int period : p.periods) {
+      out << " " << period;
+      outCSV << period << ",";
+    }
+    out << ", sys power: " << p.energy << ", TDMA slots: " << p.slots << " ***\n";
+    outCSV << p.energy << "," << p.slots << endl;
+    for (size_t g = 0; g < n_groups; g++)
+      out << "Group " << g << ":\n" << fronts[g][p.parts[g]].design;
+    out << "\n";
+  }
+  out << "=====\n" << front.size() << " designs composed after " << durAll_ms << " ms\n";
+  out.close();
+  outCSV.close();
+  cout << "Output file name: " << cfg.settings().output_path + "out/decomposed.txt" << " end of exploration." << endl;
+}
+
+void Decomposition::solveGroup(size_t g, SDFPROnlineModel* model) {
+  auto collect = [&](SDFPROnlineModel* s) {
+    Point p;
+    p.periods.assign(mapping->getApplications()->n_SDFApps(), 0);
+    vector<int> periods = s->getPeriodResults();
+    for (size_t a = 0; a < groups[g].size(); a++)
+      p.periods[groups[g][a]] = periods[a];
+    p.energy = s->getPowerResult();
+    p.slots = s->getTDMASlotsResult();
+    ostringstream design;
+    s->print(design);
+    p.design = design.str();
+    addNonDominated(fronts[g], p, true);
+    delete s;
+  };
+
+  proved[g] = searchModel(model, cfg, collect, &stats[g]);
+}
+
+vector<Decomposition::Point> Decomposition::compose() const {
+  Point empty;
+  empty.periods.assign(mapping->getApplications()->n_SDFApps(), 0);
+  empty.energy = 0;
+  empty.slots = 0;
+  vector<Point> front(1, empty);
+  //slots stay a criterion until the last group, as fewer slots leave more room for the others
+  for (size_t g = 0; g < groups.size(); g++) {
+    const bool last = g+1 == groups.size();
+    vector<Point> composed;
+    for (const Point& f : front) {
+      for (size_t k = 0; k < fronts[g].size(); k++) {
+        const Point& q = fronts[g][k];
+        if (f.slots + q.slots > mapping->getPlatform()->tdmaSlots())
+          continue;
+        Point c = f;
+        for (size_t a = 0; a < c.periods.size(); a++)
+          c.periods[a] += q.periods[a];
+        c.energy += q.energy;
+        c.slots += q.slots;
+        c.parts.push_back(k);
+        addNonDominated(composed, c, !last);
+      }
+    }
+    front.swap(composed);
+  }
+  return front;
+}
+
+bool Decomposition::weaklyDominates(const Point& a, const Point& b, bool withSlots) {
+  if (a.energy > b.energy || (withSlots && a.slots > b.slots))
+    return false;
+  for (size_t i = 0; i < a.periods.size(); i++) {
+    if (a.periods[i] > b.periods[i])
+      return false;
+  }
+  return true;
+}
+
+void Decomposition::addNonDominated(vector<Point>& front, const Point& p, bool withSlots) {
+  for (const Point& q : front) {
+    if (weaklyDominates(q, p, withSlots))
+      return;
+  }
+  front.erase(remove_if(front.begin(), front.end(), [&](const Point& q) {
+    return weaklyDominates(p, q, withSlots);
+  }), front.end());
+  front.push_back(p);
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <string>
+#include <gecode/gist.hh>
+#include "../settings/config.hpp"
+#include "../system/mapping.hpp"
+#include "../cp_model/sdf_pr_online_model.hpp"
+
+using namespace std;
+using namespace Gecode;
+
+/**
+ * Decomposed exploration of independent applications (dse.decompose).
+ *
+ * Two SDF applications interfere only through the processors both of them
+ * can be mapped to (the WCETs pin an actor to the processors with a valid
+ * WCET). The applications are partitioned into groups closed under sharing a
+ * processor, and each group is explored by its own model on its own thread.
+ * The non-dominated solutions of the groups are then composed into a global
+ * front: the periods stay per application, the power consumptions add up and
+ * the TDMA slots of a composition must fit in the TDMA round of the platform.
+ *
+ * With IPT tasks, which may run on any processor, all applications form a
+ * single group.
+ */
+class Decomposition {
+public:
+  Decomposition(Mapping* _mapping, const vector<Mapping::WCETEntry>& _wcets, Config& _cfg);
+  ~Decomposition();
+
+  /**
+   * Gets the groups of independent applications, each a list of SDF
+   * application ids.
+   */
+  const vector<vector<size_t>>& getGroups() const;
+  /**
+   * Explores all groups concurrently and writes the composed front to
+   * out/decomposed.txt and out/decomposed.csv.
+   */
+  void run();
+
+private:
+  /**
+   * A non-dominated solution, of one group or composed of all groups.
+   */
+  struct Point {
+    vector<int> periods;  /**< period of each application, 0 for applications outside the group. */
+    int energy;           /**< long-run power consumption. */
+    int slots;            /**< TDMA slots allocated. */
+    vector<size_t> parts; /**< composed points: index of the point of each group. */
+    string design;        /**< group points: the printed solution. */
+  };
+
+  Mapping* mapping;  /**< Mapping of all applications. */
+  const vector<Mapping::WCETEntry>& wcets; /**< WCET entries, applied again for the mapping of each group. */
+  Config& cfg;
+  vector<vector<size_t>> groups;
+  vector<Applications*> groupApps;
+  vector<Mapping*> groupMappings;
+  vector<vector<Point>> fronts;      /**< non-dominated solutions of each group. */
+  vector<Search::Statistics> stats;  /**< search statistics of each group. */
+  vector<char> proved;               /**< whether the search of a group exhausted its space. */
+
+  /**
+   * Partitions the SDF applications into groups that share no processor.
+   */
+  void partition();
+  /**
+   * Explores the model of group g, collecting its non-dominated solutions.
+   */
+  void solveGroup(size_t g, SDFPROnlineModel* model);
+  /**
+   * Composes the fronts of the groups into a front over all applications.
+   */
+  vector<Point> compose() const;
+  /**
+   * True if a is no worse than b in all periods, the energy and, if
+   * withSlots, the TDMA slots.
+   */
+  static bool weaklyDominates(const Point& a, const Point& b, bool withSlots);
+  /**
+   * Adds p to front unless it is weakly dominated, removing the points p dominates.
+   */
+  static void addNonDominated(vector<Point>& front, const Point& p, bool withSlots);
+};
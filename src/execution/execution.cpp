@@ -40,8 +40,17 @@
 #include <gecode/gist.hh>
 #include "../settings/config.hpp"
 #include "../system/mapping.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/solutionlog.hpp"
+#include "../tools/propstats.hpp"
+#include "../presolving/actorClustering.hpp"
 #include <chrono>
 #include <fstream> 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <limits>
+#include <random>
 
 using namespace std;
 using namespace Gecode;
@@ -50,17 +59,34 @@ template<class CPModelTemplate>
 class Execution {
 public:
   Execution(CPModelTemplate* _model, Config& _cfg) :
-      model(_model), cfg(_cfg) {
+      model(_model), cfg(_cfg), unclustered(nullptr), clustering(nullptr) {
     geSearchOptions.threads = 0.0;
     if(cfg.settings().timeout_first > 0){
       Search::TimeStop* stop = new Search::TimeStop(cfg.settings().timeout_first);
       geSearchOptions.stop = stop;
     }
+    tools::PropStats::enable(cfg.settings().prop_profile);
   }
   ;
   ~Execution() {
     delete geSearchOptions.stop;
   }
+
+  /**
+   * Prints the solutions of a model of clustered applications (see
+   * ActorClustering) as solutions of the unclustered applications: each
+   * design is expanded and enforced on a clone of _unclustered, which is
+   * solved for the message orders and all other variables. Neither is owned.
+   */
+  void expandClusters(CPModelTemplate* _unclustered, const ActorClustering* _clustering) {
+    //only stable spaces can be cloned
+    if(_unclustered->status() == SS_FAILED){
+      cout << "The unclustered model has no solution, the solutions are printed clustered." << endl;
+      return;
+    }
+    unclustered = _unclustered;
+    clustering = _clustering;
+  }
   /**
    * This funtion executes the CP model.
    * The CP model has to implement the following functions:
@@ -104,6 +130,23 @@ public:
       loopSolutions<RBS<BAB, CPModelTemplate>>(&e);
       break;
     }
+    case (Config::PARETO): {
+      cout << "BAB engine, Pareto front ... \n";
+      BAB<CPModelTemplate> e(model, geSearchOptions);
+      loopSolutions<BAB<CPModelTemplate>>(&e);
+      printParetoFront();
+      break;
+    }
+    case (Config::LNS): {
+      cout << "LNS engine, optimizing ... \n";
+      runLNS();
+      break;
+    }
+    case (Config::PORTFOLIO): {
+      cout << "Portfolio of " << cfg.settings().portfolio_workers << " BAB engines, optimizing ... \n";
+      runPortfolio();
+      break;
+    }
     default:
       cout << "unknown search type !!!" << endl;
       throw 42;
@@ -114,15 +157,120 @@ public:
   }
   ;
 
+  /**
+   * Renders the binary solution log of a previous run (output-file-type BIN)
+   * into the TXT and CSV outputs. Each logged design is enforced on a clone
+   * of the model, which is then solved to get all its other variables.
+   */
+  int Render() {
+    tools::SolutionLogReader log(cfg.settings().output_path+"out/out.bin");
+    if(!log.good()){
+      cout << "No solution log found at " << cfg.settings().output_path+"out/out.bin" << endl;
+      return 0;
+    }
+    if(model->status() == SS_FAILED){
+      cout << "The model has no solution, nothing to render." << endl;
+      return 0;
+    }
+    openOutputs();
+    out << "\n \n*** \n";
+    tools::SolutionRecord r;
+    unsigned long rendered = 0;
+    while(log.next(r)){
+      CPModelTemplate* s = solveDesign(model, r.design);
+      if(s == nullptr){
+        cout << "Solution " << r.number << " of the log does not solve the model, skipped." << endl;
+        continue;
+      }
+      Search::Statistics stats;
+      stats.node = r.node;
+      stats.fail = r.fail;
+      stats.propagate = r.propagate;
+      stats.depth = r.depth;
+      stats.nogood = r.nogood;
+      nodes = r.number;
+      t_start = runTimer::time_point();
+      t_endAll = t_start + std::chrono::milliseconds(r.time_ms);
+      writeSolution(stats, s);
+      delete s;
+      rendered++;
+    }
+    closeOutputs();
+    cout << rendered << " solutions rendered." << endl;
+    return 1;
+  }
+
 private:
   CPModelTemplate* model; /**< Pointer to the constraint model class. */
   Config& cfg; /**< pointer to the config class. */
   int nodes; /**< Number of nodes. */
   Search::Options geSearchOptions; /**< Gecode search option object. */
   ofstream out, outCSV, outMOSTCSV, outMappingCSV; /**< Output file streams: .txt and .csv. */
+  CPModelTemplate* unclustered; /**< Model of the unclustered applications, if model is clustered. */
+  const ActorClustering* clustering; /**< Clustering of the applications of model, or nullptr. */
   typedef std::chrono::high_resolution_clock runTimer; /**< Timer type. */
   runTimer::time_point t_start, t_endAll; /**< Timer objects for start and end of experiment. */
 
+  /**
+   * One search of the portfolio and its statistics.
+   */
+  struct PortfolioWorker {
+    int variant;              /**< branching variant, see CPModelTemplate::postBranching. */
+    bool restarts;            /**< luby restarts (RBS) or plain BAB. */
+    unsigned long solutions;  /**< solutions found by this worker. */
+    bool proved;              /**< search space exhausted, i.e. the incumbent is optimal. */
+    Search::Statistics stats;
+  };
+
+  /**
+   * Stops a portfolio search once another one has finished, or on time-out.
+   */
+  class PortfolioStop : public Search::Stop {
+  public:
+    PortfolioStop(const std::atomic<bool>& _done, unsigned long int timeout) :
+        done(_done), time(timeout > 0 ? new Search::TimeStop(timeout) : nullptr) {
+    }
+    ~PortfolioStop() {
+      delete time;
+    }
+    virtual bool stop(const Search::Statistics& s, const Search::Options& o) {
+      return done.load() || (time != nullptr && time->stop(s, o));
+    }
+  private:
+    const std::atomic<bool>& done;
+    Search::TimeStop* time;
+  };
+
+  /**
+   * Stops the search of an LNS neighbourhood on its fail limit, or on time-out.
+   */
+  class LNSStop : public Search::Stop {
+  public:
+    LNSStop(unsigned long int _fails, Search::Stop* _time) :
+        fails(_fails), time(_time) {
+    }
+    virtual bool stop(const Search::Statistics& s, const Search::Options& o) {
+      return (fails > 0 && s.fail > fails) || (time != nullptr && time->stop(s, o));
+    }
+  private:
+    unsigned long int fails;
+    Search::Stop* time; /**< Time-out of the whole search, not owned. */
+  };
+
+  tools::SolutionLogWriter solutionLog; /**< Binary log written instead of the outputs (output-file-type BIN). */
+
+  /**
+   * Whether solutions go to the binary log; when rendering the log, BIN
+   * produces all outputs.
+   */
+  bool binaryLog() const {
+    return cfg.settings().out_file_type == Config::BIN && !cfg.settings().render;
+  }
+
+  std::mutex portfolioMutex; /**< Guards the output and the best solution of the portfolio. */
+  CPModelTemplate* portfolioBest; /**< Best solution found by the portfolio. */
+  Search::Statistics portfolioBestStats; /**< Statistics of the worker that found portfolioBest. */
+
   void printMOSTCSV(Mapping* solution, int n, int split) {
     //N_TASKS;N_EDGES;N_PES;N_SLOTS;N_SCHEDS;MAP_PE1;MAP_PE2;FREQ_PE1;FREQ_PE2;MEM_PE1;MEM_PE2;SLOTS_PE1;SLOTS_PE2;MAP_T1;MAP_T2;MAP_T3;TASK_SCHED;COMM_SCHED;cluster;
     Applications* program = solution->getApplications();
@@ -291,15 +439,73 @@ private:
    * Prints the solutions in the ofstreams (out and outCSV)
    */
   template<class SearchEngine> void printSolution(SearchEngine *e, CPModelTemplate* s) {
-    cout << nodes << " designs found out of " << e->statistics().node << " nodes so far" << endl;
+    printSolution(e->statistics(), s);
+  }
+  ;
+
+  /**
+   * Prints a solution with the statistics of the search that found it,
+   * expanded to the unclustered applications if the model is clustered
+   */
+  void printSolution(const Search::Statistics& stats, CPModelTemplate* s) {
+    if(clustering == nullptr){
+      writeSolution(stats, s);
+      return;
+    }
+    CPModelTemplate* expanded = solveDesign(unclustered, clustering->expand(s->extractDesign()));
+    if(expanded == nullptr){
+      cout << "Solution " << nodes << " cannot be expanded to the unclustered applications, printed clustered." << endl;
+      writeSolution(stats, s);
+      return;
+    }
+    writeSolution(stats, expanded);
+    delete expanded;
+  }
+
+  /**
+   * Enforces a design, as given by extractDesign, on a clone of root and
+   * solves it for all other variables.
+   * @return the solution, or nullptr if the design does not solve root
+   */
+  CPModelTemplate* solveDesign(CPModelTemplate* root, const vector<vector<int>>& design) {
+    CPModelTemplate* s = (CPModelTemplate*) root->clone();
+    s->set_design(design[0], design[1], design[2], design[3], design[4], design[5]);
+    if(cfg.settings().search == Config::PORTFOLIO)
+      s->postBranching(0, 0);
+    Search::Options o;
+    DFS<CPModelTemplate> e(s, o);
+    delete s;
+    return e.next();
+  }
+
+  /**
+   * Writes a solution to the outputs
+   */
+  void writeSolution(const Search::Statistics& stats, CPModelTemplate* s) {
+    cout << nodes << " designs found out of " << stats.node << " nodes so far" << endl;
     auto durAll = t_endAll - t_start;
     auto durAll_ms = std::chrono::duration_cast<std::chrono::milliseconds>(durAll).count();
-    out << "*** Solution number: " << nodes << ", after " << durAll_ms << " ms" << ", search nodes: " << e->statistics().node << ", fail: "
-        << e->statistics().fail << ", propagate: " << e->statistics().propagate << ", depth: " << e->statistics().depth << ", nogoods: "
-        << e->statistics().nogood << " ***\n";
+    if(binaryLog()){
+      tools::SolutionRecord r;
+      r.number = nodes;
+      r.time_ms = durAll_ms;
+      r.node = stats.node;
+      r.fail = stats.fail;
+      r.propagate = stats.propagate;
+      r.depth = stats.depth;
+      r.nogood = stats.nogood;
+      r.design = s->extractDesign();
+      r.objectives = s->extractObjectives();
+      solutionLog.write(r);
+      return;
+    }
+    out << "*** Solution number: " << nodes << ", after " << durAll_ms << " ms" << ", search nodes: " << stats.node << ", fail: "
+        << stats.fail << ", propagate: " << stats.propagate << ", depth: " << stats.depth << ", nogoods: "
+        << stats.nogood << " ***\n";
     s->print(out);
     /// Printing CSV format output
     if(cfg.settings().out_file_type == Config::ALL_OUT ||
+       cfg.settings().out_file_type == Config::BIN ||
        cfg.settings().out_file_type == Config::CSV){    
         outCSV << nodes << "," << durAll_ms << ",";
         s->printCSV(outCSV);
@@ -309,6 +515,7 @@ private:
      * Calling printcsv for the MOST tool
      */
     if(cfg.settings().out_file_type == Config::ALL_OUT ||
+       cfg.settings().out_file_type == Config::BIN ||
        cfg.settings().out_file_type == Config::CSV_MOST){
         Mapping* mapping = s->extractResult();
         const int split = -1;
@@ -322,15 +529,13 @@ private:
    */
   template<class SearchEngine> void loopSolutions(SearchEngine *e) {
     nodes = 0;
-    out.open(cfg.settings().output_path+"out/out.txt");
-    outCSV.open(cfg.settings().output_path+"out/out.csv");
-    outMOSTCSV.open(cfg.settings().output_path+"out/out-MOST.csv");    
-    outMappingCSV.open(cfg.settings().output_path+"out/out_mapping.csv");
+    openOutputs();
     LOG_INFO("started searching for " + cfg.get_search_type() + " solutions ");
     LOG_INFO("Printing frequency: " + cfg.get_out_freq());
     out << "\n \n*** \n";    
     
     CPModelTemplate * prev_sol = nullptr;
+    tools::CloneStats::reset();
     t_start = runTimer::now();
     while(CPModelTemplate * s = e->next()){
       nodes++;
@@ -373,6 +578,7 @@ private:
     }
     out << " =====\n" << nodes << " solutions found\n" << "search nodes: " << e->statistics().node << ", fail: " << e->statistics().fail << ", propagate: "
         << e->statistics().propagate << ", depth: " << e->statistics().depth << ", nogoods: " << e->statistics().nogood << " ***\n";
+    printCloneStats(durAll_ms);
 
     if(cfg.settings().out_print_freq == Config::LAST && nodes > 0){
            printSolution(e, prev_sol);
@@ -381,10 +587,296 @@ private:
        }
        delete prev_sol;
 
+    closeOutputs();
+  }
+
+  void openOutputs() {
+    out.open(cfg.settings().output_path+"out/out.txt");
+    outCSV.open(cfg.settings().output_path+"out/out.csv");
+    outMOSTCSV.open(cfg.settings().output_path+"out/out-MOST.csv");    
+    outMappingCSV.open(cfg.settings().output_path+"out/out_mapping.csv");
+    if(binaryLog())
+      solutionLog.open(cfg.settings().output_path+"out/out.bin");
+    tools::PropStats::reset();
+  }
+
+  void closeOutputs() {
     out.close();
     outCSV.close();
     outMOSTCSV.close();
     outMappingCSV.close();
+    solutionLog.close();
+    if(tools::PropStats::enabled() && !cfg.settings().render){
+      ofstream outProp(cfg.settings().output_path+"out/propagators.json");
+      tools::PropStats::writeJSON(outProp);
+      outProp.close();
+    }
+  }
+
+  /**
+   * Writes the objectives of the final front of the PARETO search, one
+   * design per line, in the order of CPModelTemplate::paretoObjectives.
+   * Designs streamed earlier may have been dominated by later ones.
+   */
+  void printParetoFront() {
+    vector<vector<int>> front = model->getParetoFront()->front();
+    ofstream outPareto(cfg.settings().output_path+"out/pareto.csv");
+    for(const auto& point : front){
+      for(size_t k = 0; k < point.size(); k++)
+        outPareto << (k > 0 ? "," : "") << point[k];
+      outPareto << "\n";
+    }
+    outPareto.close();
+    cout << "Pareto front of " << front.size() << " designs" << endl;
+  }
+
+  void printCloneStats(long long durAll_ms) {
+    unsigned long clones = tools::CloneStats::clones();
+    out << "clones: " << clones << ", clone bytes: " << tools::CloneStats::bytes();
+    if(clones > 0)
+      out << " (" << tools::CloneStats::bytes() / clones << " per clone)";
+    if(durAll_ms > 0)
+      out << ", clones/s: " << (clones * 1000) / durAll_ms;
+    out << "\n";
+  }
+
+  /**
+   * Races differently configured BAB searches on clones of the model, one
+   * thread each. The workers share the best objective value found so far
+   * (see SharedBound), and the first worker exhausting its search proves
+   * the incumbent optimal and stops the others.
+   */
+  void runPortfolio() {
+    static const char* variantNames[] = {"slack order", "AFC", "random", "best fit"};
+    const size_t n_workers = max<size_t>(1, cfg.settings().portfolio_workers);
+    std::atomic<int> incumbent(numeric_limits<int>::max());
+    std::atomic<bool> done(false);
+    vector<PortfolioWorker> workers(n_workers);
+
+    nodes = 0;
+    portfolioBest = nullptr;
+    openOutputs();
+    LOG_INFO("started searching for " + cfg.get_search_type() + " solutions ");
+    LOG_INFO("Printing frequency: " + cfg.get_out_freq());
+    out << "\n \n*** \n";
+
+    tools::CloneStats::reset();
+    t_start = runTimer::now();
+    if(model->status() != SS_FAILED){
+      vector<CPModelTemplate*> roots;
+      for(size_t k = 0; k < n_workers; k++){
+        PortfolioWorker& w = workers[k];
+        w.variant = k % 4;
+        /// AFC and random branchings restart, the others do not; flipped for the next round of variants
+        w.restarts = (w.variant == 1 || w.variant == 2) != ((k / 4) % 2 == 1);
+        w.solutions = 0;
+        w.proved = false;
+        CPModelTemplate* root = static_cast<CPModelTemplate*>(model->clone(false));
+        root->postBranching(w.variant, k + 1);
+        root->shareIncumbent(&incumbent);
+        roots.push_back(root);
+      }
+      vector<std::thread> threads;
+      for(size_t k = 0; k < n_workers; k++){
+        threads.push_back(std::thread([this, &roots, &workers, &incumbent, &done, k]() {
+          raceWorker(roots[k], workers[k], incumbent, done);
+        }));
+      }
+      for(auto& t : threads){
+        t.join();
+      }
+    }
+
+    cout << endl;
+    auto durAll = runTimer::now() - t_start;
+    auto durAll_s = std::chrono::duration_cast<std::chrono::seconds>(durAll).count();
+    auto durAll_ms = std::chrono::duration_cast<std::chrono::milliseconds>(durAll).count();
+    out << "===== portfolio search ended after: " << durAll_s << " s (" << durAll_ms << " ms)";
+    if(!done.load() && model->status() != SS_FAILED){
+      out << " due to time-out!";
+    }
+    out << " =====\n" << nodes << " solutions found\n";
+    for(size_t k = 0; k < n_workers; k++){
+      const PortfolioWorker& w = workers[k];
+      out << "worker " << k << " (" << variantNames[w.variant] << ", " << (w.restarts ? "luby restarts" : "no restarts")
+          << "): " << w.solutions << " solutions, search nodes: " << w.stats.node << ", fail: " << w.stats.fail << ", propagate: "
+          << w.stats.propagate << ", depth: " << w.stats.depth << ", nogoods: " << w.stats.nogood
+          << (w.proved ? ", proved optimal" : ", stopped") << "\n";
+    }
+    printCloneStats(durAll_ms);
+
+    if(cfg.settings().out_print_freq == Config::LAST && portfolioBest != nullptr){
+      printSolution(portfolioBestStats, portfolioBest);
+    }
+    delete portfolioBest;
+    portfolioBest = nullptr;
+
+    closeOutputs();
+  }
+
+  /**
+   * Large neighbourhood search. Starting from a first solution, it repeatedly
+   * relaxes a neighbourhood of the incumbent (see CPModelTemplate::neighbourhood,
+   * the kinds are tried in turn), fixes the rest with relax_design and
+   * re-optimizes the subproblem with BAB under dse.lns_fail_limit failures.
+   * The relaxed fraction of the entities grows when a neighbourhood is
+   * exhausted without improvement and shrinks when the fail limit is hit.
+   * The search runs until time-out, or until a relaxation that fixes nothing
+   * of the incumbent is exhausted, which proves the incumbent optimal.
+   */
+  void runLNS() {
+    static const char* kindNames[] = {"application", "processor", "critical", "random"};
+    const int n_kinds = CPModelTemplate::NB_KINDS;
+    const double growth = 1.5;
+    double size = 0.1; /**< fraction of the entities to relax. */
+    vector<unsigned long> tried(n_kinds, 0), improved(n_kinds, 0);
+    unsigned long iterations = 0;
+    std::random_device rd;
+    std::mt19937 rng(rd());
+
+    nodes = 0;
+    openOutputs();
+    LOG_INFO("started searching for " + cfg.get_search_type() + " solutions ");
+    LOG_INFO("Printing frequency: " + cfg.get_out_freq());
+    out << "\n \n*** \n";
+
+    tools::CloneStats::reset();
+    t_start = runTimer::now();
+    Search::Statistics total;
+    CPModelTemplate* incumbent = nullptr;
+    bool proved = model->status() == SS_FAILED;
+    bool timedOut = false;
+    if(!proved){
+      DFS<CPModelTemplate> e(model, geSearchOptions);
+      incumbent = e.next();
+      total += e.statistics();
+      proved = incumbent == nullptr && !e.stopped();
+      timedOut = e.stopped();
+    }
+    if(incumbent != nullptr){
+      nodes++;
+      t_endAll = runTimer::now();
+      if(cfg.settings().out_print_freq == Config::ALL_SOL)
+        printSolution(total, incumbent);
+    }
+
+    LNSStop stop(cfg.settings().lns_fail_limit, geSearchOptions.stop);
+    Search::Options o = geSearchOptions;
+    o.stop = &stop;
+    while(incumbent != nullptr && !proved && !timedOut){
+      const int kind = iterations % n_kinds;
+      iterations++;
+      tried[kind]++;
+      vector<bool> freeEntities = incumbent->neighbourhood((typename CPModelTemplate::Neighbourhood) kind, size, rng);
+      CPModelTemplate* sub = static_cast<CPModelTemplate*>(model->clone());
+      const bool fullRelaxation = sub->relax_design(*incumbent, freeEntities);
+      sub->constrain(*incumbent);
+
+      BAB<CPModelTemplate> e(sub, o);
+      delete sub;
+      CPModelTemplate* better = nullptr;
+      while(CPModelTemplate * s = e.next()){
+        delete better;
+        better = s;
+      }
+      total += e.statistics();
+      timedOut = geSearchOptions.stop != nullptr && geSearchOptions.stop->stop(total, o);
+
+      if(better != nullptr){
+        improved[kind]++;
+        delete incumbent;
+        incumbent = better;
+        nodes++;
+        t_endAll = runTimer::now();
+        if(cfg.settings().out_print_freq == Config::ALL_SOL){
+          cout << nodes << " solutions found so far." << endl;
+          printSolution(total, incumbent);
+        }
+      }else if(!e.stopped()){
+        /// no better design in the neighbourhood
+        proved = fullRelaxation;
+        size = min(1.0, size * growth);
+      }else{
+        size = size / growth;
+      }
+    }
+
+    cout << endl;
+    auto durAll = runTimer::now() - t_start;
+    auto durAll_s = std::chrono::duration_cast<std::chrono::seconds>(durAll).count();
+    auto durAll_ms = std::chrono::duration_cast<std::chrono::milliseconds>(durAll).count();
+    out << "===== LNS search ended after: " << durAll_s << " s (" << durAll_ms << " ms)";
+    if(!proved){
+      out << " due to time-out!";
+    }
+    out << " =====\n" << nodes << " solutions found\n" << "search nodes: " << total.node << ", fail: " << total.fail << ", propagate: "
+        << total.propagate << ", depth: " << total.depth << ", nogoods: " << total.nogood << " ***\n";
+    out << "LNS iterations: " << iterations << ", final neighbourhood size: " << size << "\n";
+    for(int k = 0; k < n_kinds; k++){
+      out << "  " << kindNames[k] << " neighbourhoods: " << tried[k] << ", improving: " << improved[k] << "\n";
+    }
+    printCloneStats(durAll_ms);
+
+    if(cfg.settings().out_print_freq == Config::LAST && incumbent != nullptr){
+      printSolution(total, incumbent);
+    }
+    delete incumbent;
+
+    closeOutputs();
+  }
+
+  /**
+   * Runs one search of the portfolio on root and deletes root.
+   */
+  void raceWorker(CPModelTemplate* root, PortfolioWorker& w, std::atomic<int>& incumbent, std::atomic<bool>& done) {
+    Search::Options o;
+    o.threads = 1;
+    PortfolioStop stop(done, cfg.settings().timeout_first);
+    o.stop = &stop;
+    if(w.restarts){
+      o.cutoff = Search::Cutoff::luby(max(cfg.settings().luby_scale, (unsigned long int) Search::Config::slubyscale));
+      RBS<BAB, CPModelTemplate> e(root, o);
+      raceSolutions(&e, w, incumbent);
+    }else{
+      BAB<CPModelTemplate> e(root, o);
+      raceSolutions(&e, w, incumbent);
+    }
+    delete root;
+    if(w.proved)
+      done = true;
+  }
+
+  /**
+   * Publishes the solutions of one portfolio search to the shared incumbent
+   * and prints the ones improving on all solutions printed so far.
+   */
+  template<class SearchEngine> void raceSolutions(SearchEngine *e, PortfolioWorker& w, std::atomic<int>& incumbent) {
+    while(CPModelTemplate * s = e->next()){
+      w.solutions++;
+      IntVar obj;
+      bool hasObjective = s->objective(obj);
+      if(hasObjective){
+        int cur = incumbent.load();
+        while(obj.min() < cur && !incumbent.compare_exchange_weak(cur, obj.min()));
+      }
+      std::lock_guard<std::mutex> lock(portfolioMutex);
+      IntVar bestObj;
+      if(hasObjective && portfolioBest != nullptr && portfolioBest->objective(bestObj) && obj.min() >= bestObj.min()){
+        delete s;
+        continue;
+      }
+      nodes++;
+      t_endAll = runTimer::now();
+      if(cfg.settings().out_print_freq == Config::ALL_SOL){
+        cout << nodes << " solutions found so far." << endl;
+        printSolution(e, s);
+      }
+      delete portfolioBest;
+      portfolioBest = s;
+      portfolioBestStats = e->statistics();
+    }
+    w.stats = e->statistics();
+    w.proved = !e->stopped();
   }
 
 };
@@ -0,0 +1,38 @@
+#include "modelsearch.hpp"
+
+bool searchModel(SDFPROnlineModel* model, Config& cfg,
+                 const function<void(SDFPROnlineModel*)>& collect,
+                 Search::Statistics* stats) {
+  if (model->status() == SS_FAILED) {
+    delete model;
+    return true;
+  }
+
+  Search::Options o;
+  o.threads = 1;
+  if (cfg.settings().timeout_all > 0)
+    o.stop = new Search::TimeStop(cfg.settings().timeout_all);
+
+  bool proved;
+  if (cfg.doOptimize()) {
+    BAB<SDFPROnlineModel> e(model, o);
+    while (SDFPROnlineModel* s = e.next())
+      collect(s);
+    if (stats)
+      *stats = e.statistics();
+    proved = !e.stopped();
+  } else {
+    DFS<SDFPROnlineModel> e(model, o);
+    while (SDFPROnlineModel* s = e.next()) {
+      collect(s);
+      if (cfg.settings().search == Config::FIRST)
+        break;
+    }
+    if (stats)
+      *stats = e.statistics();
+    proved = !e.stopped() && cfg.settings().search != Config::FIRST;
+  }
+  delete o.stop;
+  delete model;
+  return proved;
+}
@@ -1,4 +1,6 @@
 #include "individual.hpp"
+#include <numeric>
+#include <tuple>
 Individual::Individual(shared_ptr<Mapping> _mapping, shared_ptr<Applications> _application, 
                     bool _multi_obj, vector<float> _o_w, vector<int> _penalty):
                     mapping(_mapping),
@@ -377,7 +379,7 @@ bool Individual::cross_proc_deadlock(int app_id, Position &p)
         for(auto n : next)
             next_in_sched.insert(n); 
         ///# add successors of a to can_fire set
-        vector<int> succ = applications->getSuccessors(a);
+        tools::ArrayView<int> succ = applications->successorIds(a);
         can_fire.insert(succ.begin(), succ.end());
         intersect_can_sched.clear();
         set_intersection(can_fire.begin(),can_fire.end(), next_in_sched.begin(), next_in_sched.end(),
@@ -437,10 +439,9 @@ bool Individual::cross_proc_deadlock(Position &p)
         int proc_a = p.proc_mappings[a].value();
         next_in_sched.insert(p.proc_sched[proc_a].get_next(a));     
         ///# add successors of a to can_fire set
-        vector<int> succ = applications->getSuccessors(a);
-        for(auto s : succ)
+        for(auto s : applications->successorIds(a))
         {
-            vector<int> pred = applications->getPredecessors(s);   
+            tools::ArrayView<int> pred = applications->predecessorIds(s);
             bool ready = true;
             for(auto p : pred)         
             {
@@ -745,11 +746,61 @@ void Individual::init_random()
        std::uniform_int_distribution<int> uni_dist(0,no_proc_modes-1);
        current_position.proc_modes[i] = uni_dist(mersenne_engine);       
     }
+    canonicalise(current_position);
         
     build_schedules(current_position);
     current_position.fitness.resize(no_entities + 1,0);///energy + memory violations + throughputs    
     repair(current_position);         
 }
+void Individual::canonicalise(Position& p)
+{
+    /// -# perm[j] is the new label of processor j
+    vector<int> perm(no_processors);
+    std::iota(perm.begin(), perm.end(), 0);
+    for(auto c : mapping->homogeneousModeClasses())
+    {
+        if(c.size() < 2)
+            continue;
+        /// -# used processors by their lowest actor, then the unused ones by decreasing TDMA slots
+        vector<tuple<int,int,int>> keys;
+        for(auto j : c)
+        {
+            int lowest = no_actors;
+            for(size_t i=0;i<no_actors;i++)
+            {
+                if(p.proc_mappings[i].value() == j)
+                {
+                    lowest = i;
+                    break;
+                }
+            }
+            keys.push_back(make_tuple(lowest, lowest < (int) no_actors ? 0 : -p.tdmaAlloc[j], j));
+        }
+        std::sort(keys.begin(), keys.end());
+        for(size_t k=0;k<c.size();k++)
+            perm[get<2>(keys[k])] = c[k];
+    }
+    vector<int> proc_modes(no_processors), tdmaAlloc(no_processors), proc_group(p.proc_group);
+    for(size_t j=0;j<no_processors;j++)
+    {
+        proc_modes[perm[j]] = p.proc_modes[j];
+        tdmaAlloc[perm[j]] = p.tdmaAlloc[j];
+        if(j < p.proc_group.size())
+            proc_group[perm[j]] = p.proc_group[j];
+    }
+    p.proc_modes = proc_modes;
+    p.tdmaAlloc = tdmaAlloc;
+    p.proc_group = proc_group;
+    for(auto& d : p.proc_mappings)
+    {
+        int value = perm[d.value()];
+        set<int> domain;
+        for(auto v : d.domain)
+            domain.insert(perm[v]);
+        d.domain = domain;
+        d.set_index(std::distance(domain.begin(), domain.find(value)));
+    }
+}
 void Individual::repair_comappings(Position& p)
 {
     vector<set<int>> domain_sets;
@@ -114,6 +114,7 @@ protected:
     vector<int> penalty;/*!< Scheduling violation penalty values.*/
     
     void init_random();/*!< Randomly initializes the individual.*/
+    void canonicalise(Position&);/*!< Relabels interchangeable processors in the order of their lowest mapped actor, as the CP symmetry breaking.*/
     void build_schedules(Position&);/*!< builds proc_sched, send_sched and rec_sched based on the mappings.*/        
     void repair_tdma(Position&);/*!< Repairs the \c tdmaAlloc vector in \ref Position.*/
     void repair_sched(Position&);/*!< Repairs the \c proc_sched in \ref Position.*/
@@ -152,6 +152,31 @@ void search()
    out_tex.close();
    
 }
+/**
+ * Gets the designs found by the search without violations: the pareto 
+ * front, or the long term memory in case of single objective.
+ */ 
+vector<DesignPoint> get_designs() const
+{
+    vector<DesignPoint> designs;
+    if(population.empty())
+        return designs;
+    const vector<Position>& found = cfg.settings().multi_obj ? par_f.pareto : long_term_memory.mem;
+    for(auto p : found)
+    {
+        if(p.cnt_violations != 0 || p.penalty != 0)
+            continue;
+        DesignPoint d;
+        d.proc_mappings = p.get_proc_mappings();
+        d.proc_modes = p.proc_modes;
+        d.next = population[0]->get_next(p.proc_sched, applications->n_SDFActors());
+        d.sendNext = population[0]->get_next(p.send_sched, applications->n_SDFchannels());
+        d.recNext = population[0]->get_next(p.rec_sched, applications->n_SDFchannels());
+        d.tdmaAlloc = p.tdmaAlloc;
+        designs.push_back(d);
+    }
+    return designs;
+}
 
 
 protected:    
@@ -28,7 +28,7 @@
 # MODULE PATH AND FILES
 #=======================
 
-CPP_FILES := platform.cpp
+CPP_FILES := platform.cpp platformbuilder.cpp
 
 
 
@@ -10,11 +10,13 @@ Platform::Platform(size_t p_nodes, int p_cycle, size_t p_memSize, int p_buffer,
   }
 
   interconnect = Interconnect(p_type, p_dps, p_tdma, p_roundLength, p_nodes, 1);
+  tabulateBlockingTimes();
 }
 
 Platform::Platform(std::vector<PE*> p_nodes, enum InterconnectType p_type, int p_dps, int p_tdma, int p_roundLength){
   compNodes = p_nodes;
   interconnect = Interconnect(p_type, p_dps, p_tdma, p_roundLength, (int)p_nodes.size(), 1);
+  tabulateBlockingTimes();
 }
 
 Platform::Platform(std::vector<PE*> p_nodes, enum InterconnectType p_type, int p_dps, int p_tdma, int p_roundLength, int p_col, int p_row){
@@ -24,6 +26,7 @@ Platform::Platform(std::vector<PE*> p_nodes, enum InterconnectType p_type, int p
   }else{
     interconnect = Interconnect(p_type, p_dps, p_tdma, p_roundLength, (int)p_nodes.size(), 1);
   }
+  tabulateBlockingTimes();
 }
 
 Platform::Platform(XMLdoc& xml)
@@ -36,6 +39,7 @@ Platform::Platform(XMLdoc& xml)
 	load_xml(xml);
     ///Assigning default interconnect
     interconnect = Interconnect(TDMA_BUS, 32, (int) compNodes.size(), 1, (int)compNodes.size(), 1);    
+    tabulateBlockingTimes();
 }
 void Platform::load_xml(XMLdoc& xml)
 {
@@ -72,6 +76,59 @@ void Platform::load_xml(XMLdoc& xml)
 		}
 	}	
 }
+Platform::Platform(tools::BinaryReader& in)
+{
+  uint64_t n = in.get<uint64_t>();
+  for (uint64_t i=0; i<n && in.good(); i++){
+    PE* pe = new PE();
+    pe->name          = in.getString();
+    pe->type          = in.getString();
+    pe->model         = in.getString();
+    pe->n_types       = in.get<int32_t>();
+    pe->cycle_length  = in.getVector<double>();
+    pe->memorySize    = in.getVector<int>();
+    pe->powerCons     = in.getVector<int>();
+    pe->areaCost      = in.getVector<int>();
+    pe->monetaryCost  = in.getVector<int>();
+    pe->NI_bufferSize = in.get<int32_t>();
+    compNodes.push_back(pe);
+  }
+  interconnect.type         = in.get<InterconnectType>();
+  interconnect.dataPerSlot  = in.get<int32_t>();
+  interconnect.dataPerRound = in.get<int32_t>();
+  interconnect.tdmaSlots    = in.get<int32_t>();
+  interconnect.roundLength  = in.get<int32_t>();
+  interconnect.columns      = in.get<int32_t>();
+  interconnect.rows         = in.get<int32_t>();
+  if (!in.good())
+    THROW_EXCEPTION(InvalidFormatException, "compiled platform is truncated");
+  tabulateBlockingTimes();
+}
+
+void Platform::write(tools::BinaryWriter& out) const
+{
+  out.put<uint64_t>(compNodes.size());
+  for (auto pe : compNodes){
+    out.putString(pe->name);
+    out.putString(pe->type);
+    out.putString(pe->model);
+    out.put<int32_t>(pe->n_types);
+    out.putVector(pe->cycle_length);
+    out.putVector(pe->memorySize);
+    out.putVector(pe->powerCons);
+    out.putVector(pe->areaCost);
+    out.putVector(pe->monetaryCost);
+    out.put<int32_t>(pe->NI_bufferSize);
+  }
+  out.put<InterconnectType>(interconnect.type);
+  out.put<int32_t>(interconnect.dataPerSlot);
+  out.put<int32_t>(interconnect.dataPerRound);
+  out.put<int32_t>(interconnect.tdmaSlots);
+  out.put<int32_t>(interconnect.roundLength);
+  out.put<int32_t>(interconnect.columns);
+  out.put<int32_t>(interconnect.rows);
+}
+
 Platform::~Platform(){
   //compNodes (they were potentially created with 'new'')
   for (size_t i=0; i<compNodes.size(); i++){
@@ -106,38 +163,44 @@ double Platform::speedUp(int node, int mode) const {
 //maximum communication time (=blocking+sending) on the TDM bus for a token of size tokSize
 //for different TDM slot allocations (index of vector = number of slots
 //for use with the element constraint in the model
-const vector<int> Platform::maxCommTimes(int tokSize) const{
+//maximum communication time (=blocking+sending) or transfer time on the TDM
+//bus for a token of size tokSize with slots allocated TDM slots (slots > 0)
+int Platform::tdmaTime(int tokSize, int slots, bool blocking) const{
   double slotLength = (double)interconnect.roundLength/interconnect.tdmaSlots;
   double slotsNeeded = ((double)tokSize/interconnect.dataPerSlot);
   double activeSendingTime = slotsNeeded * slotLength;
 
-  std::vector<int> sendingTimes;
-  sendingTimes.push_back(-1); //for tdma_alloc=0, sendingTime = -1 (used in CP model)
-  for (auto i=1; i<=interconnect.tdmaSlots; i++){ //max sendingTime depends on allocated TDM slots
-    double initBlock = interconnect.roundLength - (i-1)*slotLength;
-    int roundsNeeded = ceil(slotsNeeded/i);
-    double slotDelay = (roundsNeeded-1) * (interconnect.roundLength - (i*slotLength));
-    //cout << "tdmAlloc = " << i << " , commTime = " << initBlock+activeSendingTime+slotDelay << endl;
-
-    sendingTimes.push_back(ceil(initBlock+activeSendingTime+slotDelay));
-  }
-  return sendingTimes;
+  double initBlock = blocking ? interconnect.roundLength - (slots-1)*slotLength : 0;
+  int roundsNeeded = ceil(slotsNeeded/slots);
+  double slotDelay = (roundsNeeded-1) * (interconnect.roundLength - (slots*slotLength));
+  //cout << "tdmAlloc = " << slots << " , commTime = " << initBlock+activeSendingTime+slotDelay << endl;
+  return ceil(initBlock+activeSendingTime+slotDelay);
 }
 
-//maximum blocking time on the TDM bus for a token
-//for different TDM slot allocations (index of vector = number of slots
-//for use with the element constraint in the model
-const vector<int> Platform::maxBlockingTimes() const{
+void Platform::tabulateBlockingTimes(){
   double slotLength = (double)interconnect.roundLength/interconnect.tdmaSlots;
 
   //cout << "TMDA slot length = " << slotLength << endl;
 
-  std::vector<int> blockingTimes;
-  blockingTimes.push_back(0); //for tdma_alloc=0, blockingTime = 0 (used in CP model)
+  blockingTimes.assign(1, 0); //for tdma_alloc=0, blockingTime = 0 (used in CP model)
   for (auto i=1; i<=interconnect.tdmaSlots; i++){ //max blocking depends on allocated TDM slots
     double initBlock = interconnect.roundLength - (i-1)*slotLength;
     blockingTimes.push_back(ceil(initBlock));
   }
+}
+
+const vector<int> Platform::maxCommTimes(int tokSize) const{
+  std::vector<int> sendingTimes;
+  sendingTimes.push_back(-1); //for tdma_alloc=0, sendingTime = -1 (used in CP model)
+  for (auto i=1; i<=interconnect.tdmaSlots; i++) //max sendingTime depends on allocated TDM slots
+    sendingTimes.push_back(tdmaTime(tokSize, i, true));
+  return sendingTimes;
+}
+
+//maximum blocking time on the TDM bus for a token
+//for different TDM slot allocations (index of vector = number of slots
+//for use with the element constraint in the model
+const vector<int>& Platform::maxBlockingTimes() const{
   return blockingTimes;
 }
 
@@ -145,24 +208,24 @@ const vector<int> Platform::maxBlockingTimes() const{
 //for different TDM slot allocations (index of vector = number of slots
 //for use with the element constraint in the model
 const vector<int> Platform::maxTransferTimes(int tokSize) const{
-  double slotLength = (double)interconnect.roundLength/interconnect.tdmaSlots;
-  double slotsNeeded = ((double)tokSize/interconnect.dataPerSlot);
-  double activeSendingTime = slotsNeeded * slotLength;
-
-//  cout << "token size = " << tokSize << endl;
-//  cout << "TMDA slot length = " << slotLength << endl;
-//  cout << "TMDA slots needed = " << slotsNeeded << endl;
-//  cout << "active transfer time = " << activeSendingTime << endl;
-
   std::vector<int> transferTimes;
   transferTimes.push_back(0); //for tdma_alloc=0, transerTime = -1 (used in CP model)
-  for (auto i=1; i<=interconnect.tdmaSlots; i++){ //max sendingTime depends on allocated TDM slots
-    int roundsNeeded = ceil(slotsNeeded/i);
-    double slotDelay = (roundsNeeded-1) * (interconnect.roundLength - (i*slotLength));
+  for (auto i=1; i<=interconnect.tdmaSlots; i++) //max sendingTime depends on allocated TDM slots
+    transferTimes.push_back(tdmaTime(tokSize, i, false));
+  return transferTimes;
+}
 
-    transferTimes.push_back(ceil(activeSendingTime+slotDelay));
+void Platform::tdmaTables(const vector<int>& tokSizes, vector<int>& transfer, vector<int>& comm) const{
+  transfer.clear();
+  comm.clear();
+  for (int tokSize : tokSizes){
+    transfer.push_back(0);
+    comm.push_back(-1);
+    for (auto i=1; i<=interconnect.tdmaSlots; i++){
+      transfer.push_back(tdmaTime(tokSize, i, false));
+      comm.push_back(tdmaTime(tokSize, i, true));
+    }
   }
-  return transferTimes;
 }
 
 
@@ -34,6 +34,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "../xml/xmldoc.hpp"
+#include "../tools/binaryio.hpp"
 
 using namespace std;
 
@@ -198,6 +199,12 @@ protected:
 
   std::vector<PE*> compNodes;
   Interconnect interconnect;
+  std::vector<int> blockingTimes; /*!< maxBlockingTimes(), computed once the interconnect is set. */
+
+  void tabulateBlockingTimes();
+
+  // Worst-case communication (blocking=true) or transfer time of a token of size tokSize with slots > 0 TDM slots
+  int tdmaTime(int tokSize, int slots, bool blocking) const;
 
 public:
 
@@ -205,6 +212,9 @@ public:
   
   Platform(XMLdoc& doc);
 
+  // Restores a platform saved with write()
+  Platform(tools::BinaryReader& in);
+
   Platform(size_t p_nodes, int p_cycle, size_t p_memSize, int p_buffer, enum InterconnectType p_type, int p_dps, int p_tdma, int p_roundLength);
   
   Platform(std::vector<PE*> p_nodes, InterconnectType p_type, int p_dps, int p_tdma, int p_roundLength);
@@ -217,6 +227,8 @@ public:
   ~Platform();
 
    void load_xml(XMLdoc& xml);
+  // Saves the nodes and the interconnect for a compiled problem instance
+  void write(tools::BinaryWriter& out) const;
   // Gives the number of nodes
   size_t nodes() const;
   
@@ -258,13 +270,17 @@ public:
   //maximum blocking time on the TDM bus for a token
   //for different TDM slot allocations (index of vector = number of slots
   //for use with the element constraint in the model
-  const vector<int> maxBlockingTimes() const;
+  const vector<int>& maxBlockingTimes() const;
   
   //maximum transer time on the TDM bus for a token of size tokSize
   //for different TDM slot allocations (index of vector = number of slots
   //for use with the element constraint in the model
   const vector<int> maxTransferTimes(int tokSize) const;
 
+  //maxTransferTimes and maxCommTimes of each of the token sizes, one after the other
+  //in one flat table each (tdmaSlots()+1 entries per token size)
+  void tdmaTables(const vector<int>& tokSizes, vector<int>& transfer, vector<int>& comm) const;
+
   // True, if none of the procs has alternative modes
   bool isFixed() const;
 
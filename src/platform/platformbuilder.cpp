@@ -0,0 +1,42 @@
+#include "platformbuilder.hpp"
+#include "../exceptions/runtimeexception.h"
+
+using namespace std;
+
+PlatformBuilder::PlatformBuilder()
+  : type(TDMA_BUS), dataPerSlot(32), tdmaSlots(0), roundLength(1), columns(0), rows(0) {
+}
+
+PlatformBuilder& PlatformBuilder::addProcessors(const string& model, int number, const vector<Mode>& modes) {
+  if (modes.empty())
+    THROW_EXCEPTION(InvalidArgumentException, "processor model " + model + " has no mode");
+  processors.push_back(Processors{model, number, modes});
+  return *this;
+}
+
+PlatformBuilder& PlatformBuilder::setInterconnect(InterconnectType _type, int _dataPerSlot, int _tdmaSlots,
+                                                  int _roundLength, int _columns, int _rows) {
+  type        = _type;
+  dataPerSlot = _dataPerSlot;
+  tdmaSlots   = _tdmaSlots;
+  roundLength = _roundLength;
+  columns     = _columns;
+  rows        = _rows;
+  return *this;
+}
+
+Platform* PlatformBuilder::build() const {
+  vector<PE*> nodes;
+  for (const auto& group : processors) {
+    for (int i = 0; i < group.number; i++) {
+      PE* pe = new PE(group.model, i);
+      for (const auto& m : group.modes)
+        pe->AddMode(m.cycle, m.memory, m.power, m.area, m.monetary);
+      nodes.push_back(pe);
+    }
+  }
+  int slots = tdmaSlots > 0 ? tdmaSlots : (int)nodes.size();
+  if (type == NOC)
+    return new Platform(nodes, type, dataPerSlot, slots, roundLength, columns, rows);
+  return new Platform(nodes, type, dataPerSlot, slots, roundLength);
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __PLATFORMBUILDER__
+#define __PLATFORMBUILDER__
+
+#include <string>
+#include <vector>
+
+#include "platform.hpp"
+
+using namespace std;
+
+/**
+ * Describes a platform in memory, as an alternative to a platform XML
+ * file: groups of identical processors of one model with their modes,
+ * and the interconnect. build() creates the processors exactly as
+ * Platform(XMLdoc&) does, named <model>_<i>.
+ */
+class PlatformBuilder {
+public:
+  /** An operational mode of a processor model. */
+  struct Mode {
+    double cycle;
+    int    memory;
+    int    power;
+    int    area;
+    int    monetary;
+  };
+
+  PlatformBuilder();
+
+  /**
+   * Adds number processors of the given model, each with all modes.
+   * Throws an InvalidArgumentException if modes is empty.
+   */
+  PlatformBuilder& addProcessors(const string& model, int number, const vector<Mode>& modes);
+
+  /**
+   * Sets the interconnect. By default, the platform has a TDMA bus with
+   * 32 data per slot, one slot per processor and a round length of 1,
+   * like a platform read from XML.
+   * @param tdmaSlots 0: one slot per processor
+   */
+  PlatformBuilder& setInterconnect(InterconnectType type, int dataPerSlot, int tdmaSlots,
+                                   int roundLength, int columns = 0, int rows = 0);
+
+  /** Creates the platform, owned by the caller. */
+  Platform* build() const;
+
+private:
+  struct Processors {
+    string       model;
+    int          number;
+    vector<Mode> modes;
+  };
+  vector<Processors> processors;
+  InterconnectType   type;
+  int                dataPerSlot;
+  int                tdmaSlots;
+  int                roundLength;
+  int                columns;
+  int                rows;
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "actorClustering.hpp"
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <limits>
+
+ActorClustering::ActorClustering(Mapping* _mapping, Config& _cfg) :
+    mapping(_mapping), cfg(_cfg) {
+}
+
+bool ActorClustering::merge(size_t src, size_t dst, const vector<SDFChannel*>& channels) const {
+  Platform* platform = mapping->getPlatform();
+  const vector<int> blocking = platform->maxBlockingTimes();
+  vector<int> comm(blocking.begin(), blocking.end());
+  for (auto ch : channels) {
+    const vector<int> transfer = platform->maxTransferTimes(ch->messageSize);
+    for (size_t s = 1; s < comm.size(); s++)
+      comm[s] += transfer[s];
+  }
+  //index 0 (no slots) is not a valid allocation for a message on the bus
+  int minComm = *min_element(comm.begin()+1, comm.end());
+
+  //the super-actor can only run where both members can
+  for (size_t j = 0; j < platform->nodes(); j++) {
+    if (mapping->getValidModes(src, j) != mapping->getValidModes(dst, j))
+      return false;
+  }
+  vector<vector<int>> wcetSrc = mapping->getWCETs(src);
+  vector<vector<int>> wcetDst = mapping->getWCETs(dst);
+  for (size_t j = 0; j < wcetSrc.size(); j++) {
+    for (size_t k = 0; k < wcetSrc[j].size(); k++) {
+      if (wcetSrc[j][k] > 0 && wcetSrc[j][k] + wcetDst[j][k] > minComm)
+        return false;
+    }
+  }
+  return true;
+}
+
+size_t ActorClustering::memory(size_t id) const {
+  Applications* apps = mapping->getApplications();
+  return apps->getCodeSize(id) + apps->getDataSize(id);
+}
+
+bool ActorClustering::apply(vector<SDFGraph*>& sdfs) {
+  Applications* apps = mapping->getApplications();
+  Platform* platform = mapping->getPlatform();
+  if (platform->getInterconnectType() != TDMA_BUS || platform->tdmaSlots() < 1) {
+    cout << "Actor clustering needs a TDMA bus, skipped." << endl;
+    return false;
+  }
+  auto start = chrono::high_resolution_clock::now();
+
+  const size_t n = apps->n_SDFActors();
+  const size_t n_channels = apps->n_SDFchannels();
+  size_t maxMemory = 0;
+  for (size_t j = 0; j < platform->nodes(); j++) {
+    for (size_t k = 0; k < platform->getModes(j); k++)
+      maxMemory = max(maxMemory, platform->memorySize(j, k));
+  }
+
+  //distinct neighbours of each actor, self-loops aside
+  vector<SDFChannel*> channels = apps->getChannels();
+  vector<vector<size_t>> out(n), in(n);
+  for (auto ch : channels) {
+    size_t src = ch->source, dst = ch->destination;
+    if (src == dst)
+      continue;
+    if (find(out[src].begin(), out[src].end(), dst) == out[src].end())
+      out[src].push_back(dst);
+    if (find(in[dst].begin(), in[dst].end(), src) == in[dst].end())
+      in[dst].push_back(src);
+  }
+
+  //next[a] == b if a and b are merged
+  vector<int> next(n, -1);
+  vector<bool> linked(n, false);
+  for (size_t a = 0; a < n; a++) {
+    if (out[a].size() != 1)
+      continue;
+    size_t b = out[a][0];
+    if (in[b].size() != 1 || apps->getFirings(a) != apps->getFirings(b))
+      continue;
+    vector<SDFChannel*> link;
+    bool tokens = false;
+    for (auto ch : channels) {
+      if (ch->source == (int)a && ch->destination == (int)b) {
+        link.push_back(ch);
+        tokens |= ch->initTokens > 0;
+      }
+    }
+    if (!tokens && merge(a, b, link)) {
+      next[a] = b;
+      linked[b] = true;
+    }
+  }
+  for (auto ch : channels)
+    delete ch;
+
+  //split the chains where they exceed the memory of every processor
+  vector<size_t> offsets(1, 0);
+  for (auto sdf : sdfs)
+    offsets.push_back(offsets.back() + sdf->n_actors());
+  vector<vector<vector<int>>> groups(sdfs.size());
+  size_t merged = 0;
+  for (size_t a = 0; a < n; a++) {
+    if (linked[a] || next[a] == -1)
+      continue;
+    size_t g = apps->getSDFGraph(a);
+    vector<int> chain;
+    size_t mem = 0;
+    for (int b = a; b != -1; b = next[b]) {
+      if (!chain.empty() && mem + memory(b) > maxMemory) {
+        if (chain.size() > 1)
+          groups[g].push_back(chain);
+        chain.clear();
+        mem = 0;
+      }
+      chain.push_back(b - offsets[g]);
+      mem += memory(b);
+    }
+    if (chain.size() > 1)
+      groups[g].push_back(chain);
+  }
+  //the clustered actors are numbered as SDFGraph::cluster does
+  members.clear();
+  for (size_t g = 0; g < sdfs.size(); g++) {
+    vector<int> groupOf(sdfs[g]->n_actors(), -1);
+    for (size_t k = 0; k < groups[g].size(); k++) {
+      for (int a : groups[g][k])
+        groupOf[a] = k;
+    }
+    for (size_t i = 0; i < groupOf.size(); i++) {
+      if (groupOf[i] == -1) {
+        members.push_back(vector<int>(1, offsets[g] + i));
+      } else if (groups[g][groupOf[i]][0] == (int)i) {
+        members.push_back(vector<int>());
+        for (int a : groups[g][groupOf[i]])
+          members.back().push_back(offsets[g] + a);
+      }
+    }
+  }
+  for (size_t g = 0; g < sdfs.size(); g++) {
+    for (auto& chain : groups[g])
+      merged += chain.size() - 1;
+    if (!groups[g].empty())
+      sdfs[g]->cluster(groups[g]);
+  }
+
+  auto dur = chrono::duration_cast<chrono::milliseconds>(chrono::high_resolution_clock::now() - start);
+  size_t clusteredChannels = 0;
+  for (auto sdf : sdfs)
+    clusteredChannels += sdf->n_channels();
+  cout << "Actor clustering: " << n << " actors, " << n_channels << " channels -> "
+       << n - merged << " actors, " << clusteredChannels << " channels (reduction ratio "
+       << (n > 0 ? (double)(n - merged) / n : 1.0) << ") in " << dur.count() << " ms" << endl;
+
+  if (merged == 0)
+    return false;
+  writeClusters(sdfs);
+  return true;
+}
+
+void ActorClustering::writeClusters(const vector<SDFGraph*>& sdfs) const {
+  string path = cfg.settings().output_path + "out/clusters.txt";
+  ofstream out(path.c_str());
+  out << "# graph actor_id super-actor: members in execution order" << endl;
+  for (auto sdf : sdfs) {
+    for (int i = 0; i < sdf->n_actors(); i++) {
+      vector<string> members = sdf->getMembers(i);
+      if (members.size() < 2)
+        continue;
+      out << sdf->getName() << " " << i << " " << sdf->getActorName(i) << ":";
+      for (auto& m : members)
+        out << " " << m;
+      out << endl;
+    }
+  }
+  LOG_INFO("Actor clusters written to " + path);
+}
+
+vector<vector<int>> ActorClustering::expand(const vector<vector<int>>& design) const {
+  const int n = mapping->getApplications()->n_SDFActors();
+  const int n_clustered = members.size();
+  const int n_procs = mapping->getPlatform()->nodes();
+  //node y of the clustered static order in the unclustered one
+  auto node = [&](int y) { return y < n_clustered ? members[y][0] : n + y - n_clustered; };
+
+  //the other program entities follow the actors
+  vector<int> proc(design[0].size() + n - n_clustered);
+  for (int x = 0; x < n_clustered; x++) {
+    for (int a : members[x])
+      proc[a] = design[0][x];
+  }
+  for (size_t t = n_clustered; t < design[0].size(); t++)
+    proc[n + t - n_clustered] = design[0][t];
+
+  vector<int> next(n + n_procs);
+  for (int x = 0; x < n_clustered; x++) {
+    for (size_t k = 0; k + 1 < members[x].size(); k++)
+      next[members[x][k]] = members[x][k+1];
+    next[members[x].back()] = node(design[3][x]);
+  }
+  for (int j = 0; j < n_procs; j++)
+    next[n + j] = node(design[3][n_clustered + j]);
+
+  return {proc, design[1], design[2], next, vector<int>(), vector<int>()};
+}
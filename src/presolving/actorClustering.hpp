@@ -0,0 +1,66 @@
+#ifndef __ACTORCLUSTERING__
+#define __ACTORCLUSTERING__
+
+#include <vector>
+#include <string>
+
+#include "../applications/sdfgraph.hpp"
+#include "../system/mapping.hpp"
+#include "../settings/config.hpp"
+
+using namespace std;
+
+/**
+ * Presolving stage merging chains of actors into super-actors (presolver.clustering).
+ *
+ * A channel a->b is merged if b is the only actor a sends to, a the only actor
+ * b receives from (self-loops aside), none of the channels between them carries
+ * initial tokens, and sending them over the TDMA bus takes at least as long as
+ * executing a and b one after the other, for every number of slots and on every
+ * processor and mode. The merged chains must fit into the largest memory of the
+ * platform and have the same number of firings per actor.
+ *
+ * The super-actors execute their members back to back (see SDFGraph::cluster),
+ * so the exploration runs on the smaller graphs unchanged. The members of each
+ * super-actor are listed in out/clusters.txt: they run on the processor of the
+ * super-actor, in the listed order, at its position in the static order, which
+ * is how expand() maps the designs back to the unclustered graphs.
+ */
+class ActorClustering {
+public:
+
+  ActorClustering(Mapping* _mapping, Config& _cfg);
+
+  /**
+   * Clusters the SDF graphs in place.
+   * @param sdfs copies of the graphs of the applications of the mapping, in
+   *        the same order
+   * @return whether any actor was merged; if so, the applications and the
+   *         mapping of the exploration have to be built from sdfs.
+   */
+  bool apply(vector<SDFGraph*>& sdfs);
+
+  /**
+   * Expands a design of the clustered applications, given as by
+   * SDFPROnlineModel::extractDesign, to the applications of the mapping:
+   * the processors, modes, TDMA slots and static orders of all actors.
+   * The message orders are left empty, for the unclustered model to complete.
+   */
+  vector<vector<int>> expand(const vector<vector<int>>& design) const;
+
+private:
+  Mapping* mapping; /**< Mapping of the unclustered applications. */
+  Config&  cfg;     /**< Settings, for the output path. */
+  vector<vector<int>> members; /**< Unclustered actors of each clustered actor, in execution order. */
+
+  /** Whether the channels src->dst are never worth the communication. */
+  bool merge(size_t src, size_t dst, const vector<SDFChannel*>& channels) const;
+
+  /** Sum of the code and data sizes of actor id. */
+  size_t memory(size_t id) const;
+
+  /** Writes the members of each super-actor to out/clusters.txt. */
+  void writeClusters(const vector<SDFGraph*>& sdfs) const;
+};
+
+#endif
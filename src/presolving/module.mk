@@ -28,7 +28,7 @@
 # MODULE PATH AND FILES
 #=======================
 
-CPP_FILES := oneProcMappings.cpp presolver.cpp
+CPP_FILES := oneProcMappings.cpp presolver.cpp presolverCache.cpp actorClustering.cpp
 
 
 
@@ -41,8 +41,12 @@
 #include "../system/mapping.hpp"
 #include "../cp_model/sdf_pr_online_model.hpp"
 #include "oneProcMappings.hpp"
+#include "presolverCache.hpp"
 #include <chrono>
+#include <atomic>
 #include <fstream>
+#include <limits>
+#include <thread>
 
 using namespace std;
 using namespace Gecode;
@@ -52,6 +56,7 @@ public:
   Presolver(Config& _cfg) : settings(_cfg) {
     geSearchOptions.threads = 0.0;
     results = make_shared<Config::PresolverResults>();
+    complete = false;
   }
   ;
   ~Presolver() {
@@ -63,6 +68,14 @@ public:
    */
   Space* presolve(Mapping* map) {
 
+    PresolverCache cache(settings);
+    if(settings.settings().pre_cache && cache.load(*results)){
+      cout << "Presolver results loaded from the cache (" << results->oneProcMappings.size()
+           << " isolated mappings)." << endl;
+      settings.setPresolverResults(results);
+      return new SDFPROnlineModel(map, &settings);
+    }
+
     OneProcModel* pre_model = new OneProcModel(map, settings);
 
     switch (settings.settings().pre_search) {
@@ -85,12 +98,16 @@ public:
       cout << "DFS engine ...\n";
       DFS<OneProcModel> e(pre_model, geSearchOptions);
       loopSolutions<DFS<OneProcModel>>(&e, map);
+      if(settings.settings().pre_cache && complete)
+        cache.store(*results);
       break;
     }
     case (Config::OPTIMIZE): {
       cout << "BAB engine, optimizing ... \n";
       BAB<OneProcModel> e(pre_model, geSearchOptions);
       loopSolutions<BAB<OneProcModel>>(&e, map);
+      if(settings.settings().pre_cache && complete)
+        cache.store(*results);
       break;
     }
 //    case (Config::OPTIMIZE_IT): {
@@ -125,6 +142,7 @@ private:
   typedef std::chrono::high_resolution_clock runTimer; /**< Timer type. */
   runTimer::time_point t_start, t_endAll; /**< Timer objects for start and end of experiment. */
   shared_ptr<Config::PresolverResults> results;
+  bool complete; /**< Whether no search was stopped, only complete results are cached. */
 
   /**
    * Prints the solutions in the ofstream (out)
@@ -145,6 +163,7 @@ private:
   template<class SearchEngine> void loopSolutions(SearchEngine *e, Mapping* map) {
     DSESettings* dseSettings = new DSESettings(settings);
     nodes = 0;
+    complete = false;
     int fullNodes = 0;
     out.open(settings.settings().output_path + "/out/" + "presolver_results.txt");
     outFull.open(dseSettings->getOutputsPath(".txt"));
@@ -172,29 +191,13 @@ private:
       }
 
       printSolution(e, (OneProcModel*)s);
-      results->it_mapping = nodes-1;
       results->oneProcMappings.push_back(((OneProcModel*)s)->getResult());
       delete s;
-
-      settings.setPresolverResults(results);
-      SDFPROnlineModel* full_model = new SDFPROnlineModel(map, &settings);
-      DFS<SDFPROnlineModel> ef(full_model, geSearchOptions);
-      if(SDFPROnlineModel * sf = ef.next()){
-        fullNodes++;
-        outFull << "Pre-solution " << nodes << "----------" << endl;
-        sf->print(outFull);
-        outFull << "------------------------------" << endl << endl;
-        Mapping* mapRes = sf->extractResult();
-        settings.getPresolverResults()->periods.push_back(mapRes->getPeriods());
-        settings.getPresolverResults()->sys_energys.push_back(mapRes->getSysEnergy());
-        delete sf;
-      }else{
-        outFull << "------------------------------" << endl << endl;
-        outFull << "Presolver mapping " << nodes << " does not give a solution." << endl;
-        outFull << "------------------------------" << endl << endl;
-      }
-      delete full_model;
     }
+    settings.setPresolverResults(results);
+    bool checked = true;
+    fullNodes = checkMappings(map, checked);
+    complete = checked && !e->stopped();
     outFull << "~~~~~ *** END OF PRESOLVER SOLUTIONS *** ~~~~~" << endl;
     cout << endl;
     auto durAll = runTimer::now() - t_start;
@@ -225,6 +228,78 @@ private:
     delete dseSettings;
   }
 
+  /**
+   * Searches a first solution of the full model under each isolated mapping,
+   * in batches of one search per core. The models are built and their results
+   * extracted one after another, because both go through the shared Mapping;
+   * only the searches run in parallel. Each model is only bounded by the
+   * results of the earlier batches, so the searches of a batch share their
+   * objective values instead (see SharedBound): a search has to improve on
+   * the best first solution found by the other searches of its batch so far.
+   * @param finished set to false if one of the searches was stopped
+   * @return the number of isolated mappings that have a solution.
+   */
+  int checkMappings(Mapping* map, bool& finished) {
+    const size_t n_mappings = results->oneProcMappings.size();
+    const size_t n_workers = max<size_t>(1, thread::hardware_concurrency());
+    Search::Options workerOptions = geSearchOptions;
+    workerOptions.threads = 1;
+    int fullNodes = 0;
+
+    for(size_t first = 0; first < n_mappings; first += n_workers){
+      size_t n_batch = min(n_workers, n_mappings - first);
+      std::atomic<int> incumbent(numeric_limits<int>::max());
+      vector<SDFPROnlineModel*> batch;
+      for(size_t i = 0; i < n_batch; i++){
+        results->it_mapping = first + i;
+        SDFPROnlineModel* full_model = new SDFPROnlineModel(map, &settings);
+        if(settings.settings().search == Config::PORTFOLIO)
+          full_model->postBranching(0, 0);
+        full_model->shareIncumbent(&incumbent);
+        batch.push_back(full_model);
+      }
+
+      vector<SDFPROnlineModel*> solutions(n_batch, nullptr);
+      vector<char> stopped(n_batch, 0);
+      vector<thread> workers;
+      for(size_t i = 0; i < n_batch; i++){
+        workers.push_back(thread([&batch, &solutions, &stopped, &workerOptions, &incumbent, i](){
+          DFS<SDFPROnlineModel> ef(batch[i], workerOptions);
+          solutions[i] = ef.next();
+          stopped[i] = ef.stopped();
+          IntVar obj;
+          if(solutions[i] != nullptr && solutions[i]->objective(obj)){
+            int cur = incumbent.load();
+            while(obj.min() < cur && !incumbent.compare_exchange_weak(cur, obj.min()));
+          }
+        }));
+      }
+      for(auto& w : workers)
+        w.join();
+
+      for(size_t i = 0; i < n_batch; i++){
+        if(stopped[i])
+          finished = false;
+        if(SDFPROnlineModel * sf = solutions[i]){
+          fullNodes++;
+          outFull << "Pre-solution " << first+i+1 << "----------" << endl;
+          sf->print(outFull);
+          outFull << "------------------------------" << endl << endl;
+          Mapping* mapRes = sf->extractResult();
+          results->periods.push_back(mapRes->getPeriods());
+          results->sys_energys.push_back(mapRes->getSysEnergy());
+          delete sf;
+        }else{
+          outFull << "------------------------------" << endl << endl;
+          outFull << "Presolver mapping " << first+i+1 << " does not give a solution." << endl;
+          outFull << "------------------------------" << endl << endl;
+        }
+        delete batch[i];
+      }
+    }
+    return fullNodes;
+  }
+
 };
 
 #endif
@@ -0,0 +1,108 @@
+#include "presolverCache.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+  /** 64-bit FNV-1a, stable across runs and builds (unlike std::hash). */
+  uint64_t fnv1a(const string& data, uint64_t h) {
+    for (unsigned char c : data) {
+      h ^= c;
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+}
+
+PresolverCache::PresolverCache(Config& cfg) :
+    path(cfg.settings().output_path + "out/presolver_cache.txt") {
+  vector<string> inputs = cfg.settings().inputs_paths;
+  sort(inputs.begin(), inputs.end());
+  uint64_t h = 14695981039346656037ULL;
+  for (const string& in : inputs) {
+    ifstream file(in.c_str(), ios::binary);
+    stringstream content;
+    content << file.rdbuf();
+    h = fnv1a(in, h);
+    h = fnv1a(content.str(), h);
+  }
+  stringstream settings;
+  settings << cfg.settings().pre_search << " " << cfg.settings().search << " "
+           << cfg.settings().th_prop << " " << cfg.settings().sched_prop << " "
+           << cfg.settings().symmetry << " " << cfg.settings().max_unfolding << " "
+           << cfg.settings().pre_clustering;
+  for (auto c : cfg.settings().criteria)
+    settings << " " << c;
+  h = fnv1a(settings.str(), h);
+
+  stringstream hex;
+  hex << std::hex << setw(16) << setfill('0') << h;
+  key = hex.str();
+}
+
+bool PresolverCache::load(Config::PresolverResults& res) const {
+  ifstream in(path.c_str());
+  string word, fileKey;
+  if (!(in >> word >> fileKey) || word != "key" || fileKey != key)
+    return false;
+
+  Config::PresolverResults cached;
+  size_t n, m;
+  if (!(in >> word >> n) || word != "mappings")
+    return false;
+  cached.oneProcMappings.resize(n);
+  for (auto& mapping : cached.oneProcMappings) {
+    in >> m;
+    for (size_t i = 0; i < m && in; i++) {
+      int proc, mode;
+      in >> proc >> mode;
+      mapping.push_back(make_tuple(proc, mode));
+    }
+  }
+  if (!(in >> word >> n) || word != "periods")
+    return false;
+  cached.periods.resize(n);
+  for (auto& periods : cached.periods) {
+    in >> m;
+    periods.resize(m);
+    for (auto& p : periods)
+      in >> p;
+  }
+  if (!(in >> word >> n) || word != "energies")
+    return false;
+  cached.sys_energys.resize(n);
+  for (auto& e : cached.sys_energys)
+    in >> e;
+  if (!in)
+    return false;
+
+  cached.it_mapping = cached.oneProcMappings.size();
+  res = cached;
+  return true;
+}
+
+void PresolverCache::store(const Config::PresolverResults& res) const {
+  ofstream out(path.c_str());
+  out << "key " << key << "\n";
+  out << "mappings " << res.oneProcMappings.size() << "\n";
+  for (const auto& mapping : res.oneProcMappings) {
+    out << mapping.size();
+    for (const auto& pm : mapping)
+      out << " " << get<0>(pm) << " " << get<1>(pm);
+    out << "\n";
+  }
+  out << "periods " << res.periods.size() << "\n";
+  for (const auto& periods : res.periods) {
+    out << periods.size();
+    for (int p : periods)
+      out << " " << p;
+    out << "\n";
+  }
+  out << "energies " << res.sys_energys.size() << "\n";
+  for (int e : res.sys_energys)
+    out << e << " ";
+  out << "\n";
+  out.close();
+}
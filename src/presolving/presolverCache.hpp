@@ -0,0 +1,40 @@
+#ifndef __PRESOLVERCACHE__
+#define __PRESOLVERCACHE__
+
+#include <string>
+#include <vector>
+#include <tuple>
+
+#include "../settings/config.hpp"
+
+using namespace std;
+
+/**
+ * On-disk cache of the presolver results (out/presolver_cache.txt).
+ *
+ * The results are stored together with a key hashing the contents of all
+ * input files and the settings that change the presolver outcome, and are
+ * only loaded while that key is unchanged. The constraint models themselves
+ * are not part of the key: the cache has to be removed (or presolver.cache
+ * disabled) after changing them.
+ */
+class PresolverCache {
+public:
+
+  PresolverCache(Config& _cfg);
+
+  /**
+   * Loads the cached results into res.
+   * @return false if there is no cache, or it belongs to other inputs.
+   */
+  bool load(Config::PresolverResults& res) const;
+
+  /** Stores res for the current inputs, replacing any previous cache. */
+  void store(const Config::PresolverResults& res) const;
+
+private:
+  string path; /**< Path of the cache file. */
+  string key;  /**< Hash of the input files and the presolver settings. */
+};
+
+#endif
@@ -78,6 +78,20 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
       ("dump-cfg",
           po::value<string>()->implicit_value("config.cfg"),
           "creates a default configuration file and exits the program.")
+      ("render",
+          "renders the binary solution log out/out.bin of a previous run into the "
+          "TXT and CSV outputs instead of searching.")
+      ("compile",
+          "builds the applications, platform and WCETs from the inputs and saves them to "
+          "out/instance.dsy, which later runs can take as their only input instead of the XML "
+          "files (the unfolding and clustering settings are fixed at compile time).")
+      ("evaluate",
+          po::value<string>(),
+          "evaluates the designs in the given binary solution log (out/out.bin) or CSV file "
+          "(one design per line, in the order of the solution log: mapping of all actors and "
+          "tasks, processor modes, TDMA slots, next, sendNext and recNext; rows of only mapping "
+          "and modes are checked for schedulability) on all cores and writes the periods, "
+          "energy, memory slack and schedulability to out/evaluated.csv instead of searching.")
       ("output,o",
           po::value<string>()->default_value(".")->notifier(
               boost::bind(&Config::setOutputPaths, this, _1)),
@@ -95,7 +109,7 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
           po::value<string>()->default_value(string("ALL_OUT"))->notifier(
               boost::bind(&Config::setOutputFileType, this, _1)),
           "Output file type.\n"
-          "Valid options ALL, CSV, TXT, XML. ")
+          "Valid options ALL, CSV, TXT, XML, BIN (binary solution log out/out.bin, see --render). ")
       ("output-print-frequency",
           po::value<string>()->default_value(string("ALL_SOL"))->notifier(
               boost::bind(&Config::setOutputPrintFrequency, this, _1)),
@@ -113,7 +127,7 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
           po::value<string>()->default_value(string("NONESEARCH"))->notifier(
               boost::bind(&Config::setSearch, this, _1)),
           "Search type.\n"
-          "Valid options NONESEARCH, FIRST, ALL, OPTIMIZE, OPTIMIZE_IT, GIST_ALL, GIST_OPT, PSO, GA. ")
+          "Valid options NONESEARCH, FIRST, ALL, OPTIMIZE, OPTIMIZE_IT, GIST_ALL, GIST_OPT, PSO, GA, PORTFOLIO, LNS, PARETO. ")
       ("dse.criteria",
           po::value<vector<string>>()->multitoken()->default_value({"NONE",""},
               "NONE ")->notifier(boost::bind(&Config::setCriteria, this, _1)),
@@ -128,11 +142,45 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
           po::value<unsigned long int>()->default_value(0)->notifier(
               boost::bind(&Config::setLubyScale, this, _1)),
           "Luby scale")      
+      ("dse.portfolio_workers",
+          po::value<size_t>()->default_value(4)->notifier(
+              boost::bind(&Config::setPortfolioWorkers, this, _1)),
+          "Number of differently configured searches raced by the PORTFOLIO search.")
+      ("dse.lns_fail_limit",
+          po::value<unsigned long int>()->default_value(1000)->notifier(
+              boost::bind(&Config::setLNSFailLimit, this, _1)),
+          "Number of failures after which an LNS neighbourhood is given up.")
+      ("dse.decompose",
+          po::value<bool>()->default_value(false)->notifier(
+              boost::bind(&Config::setDecompose, this, _1)),
+          "Whether applications that share no processor are explored separately and their "
+          "solutions composed.")
+      ("dse.max_unfolding",
+          po::value<size_t>()->default_value(0)->notifier(
+              boost::bind(&Config::setMaxUnfolding, this, _1)),
+          "Maximum number of copies of an SDF actor in the internal graph. Actors with a larger "
+          "repetition count execute several firings per copy. 0 expands every actor fully.")
+      ("dse.prop_profile",
+          po::value<bool>()->default_value(false)->notifier(
+              boost::bind(&Config::setPropProfile, this, _1)),
+          "Whether the calls of the custom propagators are profiled and reported in "
+          "out/propagators.json.")
       ("dse.th_prop",
           po::value<string>()->default_value(string("MCR"))->notifier(
               boost::bind(&Config::setThPropagator, this, _1)),
           "Throughput propagator type.\n"
-          "Valid options SSE, MCR. ");
+          "Valid options SSE, MCR, MCR_BOUND (MCR bounding the period from partial schedules). ")
+      ("dse.sched_prop",
+          po::value<string>()->default_value(string("DECOMP"))->notifier(
+              boost::bind(&Config::setSchedPropagator, this, _1)),
+          "Scheduling (next/rank) constraint type.\n"
+          "Valid options DECOMP, CHAIN. ")
+      ("dse.symmetry",
+          po::value<string>()->default_value(string("ORDER"))->notifier(
+              boost::bind(&Config::setSymmetryBreaking, this, _1)),
+          "Symmetry breaking between interchangeable processors.\n"
+          "Valid options ORDER (first actors of the processors ordered), PRECEDENCE (value precedence "
+          "per processor class), LDSB (lightweight dynamic symmetry breaking in the branching). ");
 
   po::options_description presolver("Presolver options");
   presolver.add_options()
@@ -145,7 +193,20 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
                po::value<string>()->default_value(string("ALL"))->notifier(
                   boost::bind(&Config::setPresolverSearch, this, _1)),
              "Search type.\n"
-             "Valid options NONESEARCH, FIRST, ALL, OPTIMIZE, OPTIMIZE_IT, GIST_ALL, GIST_OPT, PSO, GA. ");
+             "Valid options NONESEARCH, FIRST, ALL, OPTIMIZE, OPTIMIZE_IT, GIST_ALL, GIST_OPT, PSO, GA. ")
+    ("presolver.cache",
+               po::value<bool>()->default_value(false)->notifier(
+                  boost::bind(&Config::setPresolverCache, this, _1)),
+             "Whether the presolver results are kept in out/presolver_cache.txt and reused as long "
+             "as the input files and the search settings are unchanged. Results of a presolving "
+             "stopped before its end are not kept.")
+    ("presolver.clustering",
+               po::value<bool>()->default_value(false)->notifier(
+                  boost::bind(&Config::setPresolverClustering, this, _1)),
+             "Whether chains of actors whose communication costs more than their execution are "
+             "merged into super-actors before the exploration (listed in out/clusters.txt). "
+             "Heuristic: excludes the solutions that pipeline a merged chain over several processors. "
+             "Ignored by the GA and PSO searches and by dse.decompose.");
 
   po::options_description meta("Metaheuristic options");
   meta.add_options()
@@ -201,7 +262,7 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
 
   if (vm.count("help")) {
     std::cout << help_intro << std::endl;
-    std::cout << "Usage: adse [options] input-path|input-file.xml..." << std::endl;
+    std::cout << "Usage: adse [options] input-path|input-file.xml...|instance.dsy" << std::endl;
     std::cout << visible_options << std::endl;
     return 1;
   }
@@ -237,6 +298,9 @@ int Config::parse(int argc, const char** argv) throw (IOException, InvalidArgume
   } catch (po::error& ex) {
     THROW_EXCEPTION(IOException,"CLI",ex.what());
   }
+  settings_.render = vm.count("render") > 0;
+  settings_.compile = vm.count("compile") > 0;
+  settings_.evaluate_path = vm.count("evaluate") ? vm["evaluate"].as<string>() : "";
 
   if (loaded_cfg_file)
     LOG_DEBUG("Loaded initial configuration from \'" + conf_path + "\'");
@@ -267,10 +331,19 @@ string Config::printSettings() {
       + "\n* model : " + tools::toString(settings_.model)
       + "\n* search : " + tools::toString(settings_.search)
       + "\n* propagator : " + tools::toString(settings_.th_prop)
+      + "\n* sched_prop : " + tools::toString(settings_.sched_prop)
+      + "\n* symmetry : " + tools::toString(settings_.symmetry)
       + "\n* criteria : " + tools::toString(settings_.criteria)
       + "\n* timeout : " + tools::toString(settings_.timeout_first)
       + " | " + tools::toString(settings_.timeout_all)
-      + "\n* luby_scale : " + tools::toString(settings_.luby_scale);
+      + "\n* luby_scale : " + tools::toString(settings_.luby_scale)
+      + "\n* portfolio_workers : " + tools::toString(settings_.portfolio_workers)
+      + "\n* lns_fail_limit : " + tools::toString(settings_.lns_fail_limit)
+      + "\n* decompose : " + tools::toString(settings_.decompose)
+      + "\n* max_unfolding : " + tools::toString(settings_.max_unfolding)
+      + "\n* prop_profile : " + tools::toString(settings_.prop_profile)
+      + "\n* presolver cache : " + tools::toString(settings_.pre_cache)
+      + "\n* presolver clustering : " + tools::toString(settings_.pre_clustering);
 }
 
 void Config::dumpConfigFile(string path, po::options_description opts) throw (IOException){
@@ -280,6 +353,9 @@ void Config::dumpConfigFile(string path, po::options_description opts) throw (IO
     if (o->long_name() == "version")  continue;
     if (o->long_name() == "config")   continue;
     if (o->long_name() == "dump-cfg") continue;
+    if (o->long_name() == "render")   continue;
+    if (o->long_name() == "compile")  continue;
+    if (o->long_name() == "evaluate") continue;
     //std::cout << o->format_parameter() << ":" << o->description() << "\n";
     string section, description;
     vector<string> variables;
@@ -337,6 +413,7 @@ void Config::dumpConfigFile(string path, po::options_description opts) throw (IO
 void Config::setInputPaths(const vector<string> & paths) throw (IOException) {
   for (auto p : paths) {
     tools::append(settings_.inputs_paths, tools::getFileNames(p, ".xml"));
+    tools::append(settings_.inputs_paths, tools::getFileNames(p, ".dsy"));
   }
 }
 
@@ -395,6 +472,9 @@ Config::SearchTypes stringToSearch (const string &str) throw (InvalidFormatExcep
   else if (str == "GIST_OPT")    return Config::GIST_OPT;
   else if (str == "PSO")    return Config::PSO;
   else if (str == "GA")    return Config::GA;
+  else if (str == "PORTFOLIO") return Config::PORTFOLIO;
+  else if (str == "LNS")         return Config::LNS;
+  else if (str == "PARETO")      return Config::PARETO;
   else THROW_EXCEPTION(InvalidFormatException, str, "invalid option");
 }
 
@@ -405,12 +485,34 @@ void Config::setSearch(const string &str) throw (InvalidFormatException) {
 Config::ThroughputPropagator stringToPropagator(const string &str) throw (InvalidFormatException) {
   if (str == "SSE")            return Config::SSE;
   else if (str == "MCR")      return Config::MCR;
+  else if (str == "MCR_BOUND") return Config::MCR_BOUND;
   else THROW_EXCEPTION(InvalidFormatException, str, "invalid option");
 }
 
 void Config::setThPropagator(const string &str) throw (InvalidFormatException) {
   settings_.th_prop = stringToPropagator(str);
 }
+
+Config::SchedulingPropagator stringToSchedPropagator(const string &str) throw (InvalidFormatException) {
+  if (str == "DECOMP")         return Config::DECOMP;
+  else if (str == "CHAIN")    return Config::CHAIN;
+  else THROW_EXCEPTION(InvalidFormatException, str, "invalid option");
+}
+
+void Config::setSchedPropagator(const string &str) throw (InvalidFormatException) {
+  settings_.sched_prop = stringToSchedPropagator(str);
+}
+
+Config::SymmetryBreaking stringToSymmetryBreaking(const string &str) throw (InvalidFormatException) {
+  if (str == "ORDER")              return Config::SYM_ORDER;
+  else if (str == "PRECEDENCE")    return Config::SYM_PRECEDENCE;
+  else if (str == "LDSB")          return Config::SYM_LDSB;
+  else THROW_EXCEPTION(InvalidFormatException, str, "invalid option");
+}
+
+void Config::setSymmetryBreaking(const string &str) throw (InvalidFormatException) {
+  settings_.symmetry = stringToSymmetryBreaking(str);
+}
 Config::OptCriterion stringToCriterion(const string &str) throw (InvalidFormatException) {
   if (str == "NONE")            return Config::NONE;
   else if (str == "POWER")      return Config::POWER;
@@ -427,6 +529,7 @@ Config::OutputFileType stringToOutputFileType(const string &str) throw (InvalidF
   else if (str == "CSV_MOST")    return Config::CSV_MOST;
   else if (str == "TXT")         return Config::TXT;
   else if (str == "XML")         return Config::XML;
+  else if (str == "BIN")         return Config::BIN;
   else THROW_EXCEPTION(InvalidFormatException, str, "invalid option");
 }
 void Config::setOutputFileType(const string &str) throw (InvalidFormatException) {
@@ -460,6 +563,9 @@ string searchTypeToString(Config::SearchTypes freq) throw (InvalidFormatExceptio
   else if (freq == Config::GIST_OPT)    return "GIST_OPT";
   else if (freq == Config::PSO)         return "PSO";
   else if (freq == Config::GA)          return "GA";
+  else if (freq == Config::PORTFOLIO)   return "PORTFOLIO";
+  else if (freq == Config::LNS)         return "LNS";
+  else if (freq == Config::PARETO)      return "PARETO";
   else THROW_EXCEPTION(InvalidFormatException, "searchTypeToString", "invalid option");
 }
 string Config::get_search_type() const {
@@ -496,6 +602,26 @@ void Config::setLubyScale(unsigned long int scale) throw () {
   settings_.luby_scale = scale;
 }
 
+void Config::setPortfolioWorkers(size_t workers) throw () {
+  settings_.portfolio_workers = workers;
+}
+
+void Config::setLNSFailLimit(unsigned long int limit) throw () {
+  settings_.lns_fail_limit = limit;
+}
+
+void Config::setDecompose(bool decompose) throw () {
+  settings_.decompose = decompose;
+}
+
+void Config::setMaxUnfolding(size_t unfolding) throw () {
+  settings_.max_unfolding = unfolding;
+}
+
+void Config::setPropProfile(bool profile) throw () {
+  settings_.prop_profile = profile;
+}
+
 void Config::setPresolverModel(const vector<string> &str) throw (InvalidFormatException) {
   for (string s : str)
     if (s.length() != 0)
@@ -506,6 +632,14 @@ void Config::setPresolverSearch(const string &str) throw (InvalidFormatException
   settings_.pre_search = stringToSearch(str);
 }
 
+void Config::setPresolverCache(bool cache) throw () {
+  settings_.pre_cache = cache;
+}
+
+void Config::setPresolverClustering(bool clustering) throw () {
+  settings_.pre_clustering = clustering;
+}
+
 void Config::setPresolverResults(shared_ptr<Config::PresolverResults> _p){
   pre_results = _p;
 }
@@ -542,7 +676,9 @@ shared_ptr<Config::PresolverResults> Config::getPresolverResults(){
   return pre_results;
 }
 bool Config::doOptimize() const {
-  if (settings().search == Config::OPTIMIZE || settings().search == Config::OPTIMIZE_IT || settings().search == Config::GIST_OPT) {
+  if (settings().search == Config::OPTIMIZE || settings().search == Config::OPTIMIZE_IT || settings().search == Config::GIST_OPT ||
+      settings().search == Config::PORTFOLIO || settings().search == Config::LNS ||
+      settings().search == Config::PARETO) {
     return true;
   }
   return false;
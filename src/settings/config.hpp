@@ -62,14 +62,25 @@ public:
   };
   enum ThroughputPropagator {
     SSE,
-    MCR
+    MCR,
+    MCR_BOUND
+  };
+  enum SchedulingPropagator {
+    DECOMP,
+    CHAIN
+  };
+  enum SymmetryBreaking {
+    SYM_ORDER,
+    SYM_PRECEDENCE,
+    SYM_LDSB
   };
   enum OutputFileType {
       ALL_OUT,
       TXT,
       CSV,
       CSV_MOST,
-      XML
+      XML,
+      BIN
   };
   enum OutputPrintFrequency {
       ALL_SOL,
@@ -89,7 +100,10 @@ public:
     GIST_ALL,
     GIST_OPT,
     PSO, 
-    GA
+    GA,
+    PORTFOLIO,
+    LNS,
+    PARETO
   };
   enum OptCriterion {
     NONE,
@@ -105,14 +119,26 @@ public:
     std::vector<PresolverModels> pre_models;
     SearchTypes               search;
     SearchTypes               pre_search;
+    bool                      pre_cache;
+    bool                      pre_clustering;
     std::vector<OptCriterion> criteria;
     unsigned long int         timeout_first;
     unsigned long int         timeout_all;
 
     unsigned long int luby_scale;
+    size_t                    portfolio_workers;
+    unsigned long int         lns_fail_limit;
+    bool                      decompose;
+    size_t                    max_unfolding;
+    bool                      prop_profile;
     ThroughputPropagator      th_prop;
+    SchedulingPropagator      sched_prop;
+    SymmetryBreaking          symmetry;
     OutputFileType            out_file_type;
     OutputPrintFrequency      out_print_freq;
+    bool                      render;
+    bool                      compile;
+    std::string               evaluate_path; /**< designs to evaluate (--evaluate), empty if none. */
     
    size_t generation;
    size_t restart_generation;
@@ -183,10 +209,19 @@ private:
   void setSearch(const std::string &) throw (InvalidFormatException);
   void setCriteria(const std::vector<std::string> &) throw (InvalidFormatException);
   void setThPropagator(const std::string &) throw (InvalidFormatException);
+  void setSchedPropagator(const std::string &) throw (InvalidFormatException);
+  void setSymmetryBreaking(const std::string &) throw (InvalidFormatException);
   void setTimeout(const std::vector<unsigned long int> &) throw (IllegalStateException);
   void setLubyScale(unsigned long int) throw ();
+  void setPortfolioWorkers(size_t) throw ();
+  void setLNSFailLimit(unsigned long int) throw ();
+  void setDecompose(bool) throw ();
+  void setMaxUnfolding(size_t) throw ();
+  void setPropProfile(bool) throw ();
   void setPresolverModel(const std::vector<std::string> &) throw (InvalidFormatException);
   void setPresolverSearch(const std::string &) throw (InvalidFormatException);
+  void setPresolverCache(bool) throw ();
+  void setPresolverClustering(bool) throw ();
   void setOutputFileType(const std::string &) throw (InvalidFormatException);
   void setOutputPrintFrequency(const std::string &) throw (InvalidFormatException);  
   void setNoGenerations(size_t) throw (InvalidFormatException);
@@ -886,9 +886,9 @@ void Design::init_vectors(){
         int proc_src_i = proc_mappings[src_i];
         int proc_dest_i = proc_mappings[dest_i];    
         if(proc_src_i != proc_dest_i){
-             sendingTime.push_back(mapping->wcTransferTimes(i)[tdmaAlloc[proc_src_i]]);
+             sendingTime.push_back(mapping->wcTransferTime(i, tdmaAlloc[proc_src_i]));
              /// sendingLatency
-             sendingLatency.push_back(mapping->wcBlockingTimes()[tdmaAlloc[proc_src_i]]);    
+             sendingLatency.push_back(mapping->wcBlockingTime(tdmaAlloc[proc_src_i]));    
              /// memCons
              memCons[proc_src_i] += applications->getChannel(i)->messageSize;
              memCons[proc_dest_i] += applications->getChannel(i)->messageSize;
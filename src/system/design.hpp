@@ -23,6 +23,8 @@
  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  * POSSIBILITY OF SUCH DAMAGE.
  */
+#ifndef __DESIGN__
+#define __DESIGN__
 
 #include <vector>
 #include <algorithm>
@@ -53,6 +55,27 @@ using actor_prop_des = b::property<vertex_actorida_t, int>;
 using chan_prop_des  = b::property<b::edge_weight_t, int, b::property<b::edge_weight2_t, int> >;
 using boost_msag_des = b::adjacency_list<b::vecS, b::vecS, b::directedS, actor_prop_des, chan_prop_des>;
 
+/**
+ * A candidate design, given by the same vectors as a Design.
+ */
+struct DesignPoint {
+  vector<int> proc_mappings; /*!< processor of each actor. */
+  vector<int> proc_modes;    /*!< mode of each processor. */
+  vector<int> next;          /*!< static order successors of the actors. */
+  vector<int> sendNext;      /*!< order of the sent messages. */
+  vector<int> recNext;       /*!< order of the received messages. */
+  vector<int> tdmaAlloc;     /*!< TDMA slots of each processor. */
+};
+
+/**
+ * The performance of a design.
+ */
+struct DesignResult {
+  vector<int> periods;      /*!< period of each SDF application. */
+  int         energy;
+  vector<int> memorySlack;  /*!< unused memory on each processor. */
+};
+
 /**
  * This class is used for storing a particular design (i.e. solution).
  * We use this class to perform performance analysis on complete designs.
@@ -138,3 +161,5 @@ private:
     void calc_energy();
     void printThroughputGraphAsDot(const string &dir) const;
 };
+
+#endif
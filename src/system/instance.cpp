@@ -0,0 +1,69 @@
+#include "instance.hpp"
+
+using namespace std;
+
+namespace {
+  const char magic[8] = {'D', 'S', 'Y', 'D', 'I', 'N', 'S', 'T'};
+}
+
+const uint32_t CompiledInstance::formatVersion;
+
+CompiledInstance::CompiledInstance() : taskset(nullptr), platform(nullptr) {
+}
+
+void CompiledInstance::write(const string& path) const {
+  tools::BinaryWriter out(path);
+  for (char c : magic)
+    out.put<char>(c);
+  out.put<uint32_t>(formatVersion);
+
+  out.put<uint64_t>(sdfs.size());
+  for (auto sdf : sdfs)
+    sdf->write(out);
+  if (taskset) {
+    taskset->write(out);
+  } else {
+    TaskSet().write(out);
+  }
+  platform->write(out);
+  out.put<uint64_t>(wcets.size());
+  for (const auto& w : wcets) {
+    out.putString(w.taskType);
+    out.putString(w.procModel);
+    out.put<int32_t>(w.wcet);
+  }
+
+  if (!out.good())
+    THROW_EXCEPTION(IOException, path, "could not write the compiled instance");
+}
+
+void CompiledInstance::read(const string& path) {
+  tools::BinaryReader in(path);
+  if (!in.good())
+    THROW_EXCEPTION(IOException, path, "could not open the compiled instance");
+  for (char c : magic) {
+    if (in.get<char>() != c)
+      THROW_EXCEPTION(InvalidFormatException, path + " is not a compiled instance");
+  }
+  uint32_t version = in.get<uint32_t>();
+  if (version != formatVersion)
+    THROW_EXCEPTION(InvalidFormatException, path + " has format version " + tools::toString(version)
+                    + ", expected " + tools::toString(formatVersion) + ": compile it again");
+
+  uint64_t n = in.get<uint64_t>();
+  for (uint64_t i = 0; i < n && in.good(); i++)
+    sdfs.push_back(new SDFGraph(in));
+  taskset = new TaskSet(in);
+  platform = new Platform(in);
+  n = in.get<uint64_t>();
+  for (uint64_t i = 0; i < n && in.good(); i++) {
+    Mapping::WCETEntry w;
+    w.taskType  = in.getString();
+    w.procModel = in.getString();
+    w.wcet      = in.get<int32_t>();
+    wcets.push_back(w);
+  }
+
+  if (!in.good())
+    THROW_EXCEPTION(InvalidFormatException, path + " is truncated");
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2013-2016, Nima Khalilzad   <nkhal@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __INSTANCE__
+#define __INSTANCE__
+
+#include <vector>
+#include <string>
+
+#include "mapping.hpp"
+#include "../applications/sdfgraph.hpp"
+#include "../platform/platform.hpp"
+#include "../tools/binaryio.hpp"
+
+using namespace std;
+
+/**
+ * The inputs of a run, as built from the XML files: the internal SDF graphs
+ * (after unfolding and clustering, with their path matrices and design
+ * constraints), the periodic tasks, the platform and the WCET entries.
+ *
+ * adse --compile saves them to out/instance.dsy; a later run given that file
+ * as input reads them back from a memory map instead of parsing and
+ * transforming the XML files. The file starts with a magic string and a
+ * format version, and is rejected if either does not match this build.
+ */
+class CompiledInstance {
+public:
+  static const uint32_t formatVersion = 1;
+
+  vector<SDFGraph*>          sdfs;
+  TaskSet*                   taskset;
+  Platform*                  platform;
+  vector<Mapping::WCETEntry> wcets;
+
+  CompiledInstance();
+
+  /** Writes the instance to path. */
+  void write(const string& path) const;
+
+  /** Reads the instance from path, a file written by write(). */
+  void read(const string& path);
+};
+
+#endif
@@ -2,7 +2,11 @@
 
 using namespace std;
 
-Mapping::Mapping(Applications* p_program, Platform* p_target, XMLdoc& xml) {
+Mapping::Mapping(Applications* p_program, Platform* p_target, XMLdoc& xml)
+  : Mapping(p_program, p_target, readWCETs(xml)) {
+}
+
+Mapping::Mapping(Applications* p_program, Platform* p_target, const vector<WCETEntry>& entries) {
   program = p_program;
   target = p_target;
   n_apps = program->n_SDFApps() + program->n_IPTTasks();
@@ -20,15 +24,27 @@ Mapping::Mapping(Applications* p_program, Platform* p_target, XMLdoc& xml) {
   sys_energy = 0;
   sys_cost = 0;
 
-  //initialize vector of vectors of vectors for WCETs (combination of entity, proc & mode)
-  wcets.insert(wcets.end(), program->n_programEntities(), //[Nima] n_SDFActors-->n_programEntities
-               vector<vector<int>>(p_target->nodes(),
-                                   vector<int>(p_target->getMaxModes(), std::numeric_limits<int>::max() - 1)));
-  
-  //prepare WCETs
-  for (size_t i=0; i<program->n_programEntities(); i++){ //all entities
-    for (size_t j=0; j<target->nodes(); j++){  //all processors
-      wcets[i][j].resize(target->getModes(j));
+  //initialize the WCET table (combination of entity, proc & mode), one row per entity
+  //[Nima] n_SDFActors-->n_programEntities
+  if (target->getMaxModes() > 64)
+    THROW_EXCEPTION(InvalidArgumentException, "more than 64 modes on a processor\n");
+  wcetOffset.assign(1, 0);
+  for (size_t j=0; j<target->nodes(); j++)
+    wcetOffset.push_back(wcetOffset.back() + target->getModes(j));
+  const size_t lineInts = tools::cacheLine / sizeof(int);
+  wcetStride = max<size_t>(1, (wcetOffset.back() + lineInts - 1) / lineInts) * lineInts;
+  wcetTable.assign(program->n_programEntities() * wcetStride, std::numeric_limits<int>::max() - 1);
+  minWCET.assign(program->n_programEntities(), 0);
+  maxWCET.assign(program->n_programEntities(), 0);
+  validModes.assign(program->n_programEntities() * target->nodes(), 0);
+
+  memCode.resize(program->n_programEntities() * target->nodes());
+  memData.resize(program->n_programEntities() * target->nodes());
+  for (size_t i=0; i<program->n_programEntities(); i++){
+    for (size_t j=0; j<target->nodes(); j++){
+      //TODO: get this from a file
+      memCode[i*target->nodes()+j] = program->getCodeSize(i);
+      memData[i*target->nodes()+j] = program->getDataSize(i);
     }
   }
 
@@ -42,9 +58,28 @@ Mapping::Mapping(Applications* p_program, Platform* p_target, XMLdoc& xml) {
 
   maxIterationsTransPhEntity.assign(p_program->n_programEntities(), 1);
   maxIterationsTransPhChannel.assign(p_program->n_programChannels(), 1);
+
+  //initialize the TDMA tables, one row of transfer and communication times per token size
+  commStride = target->tdmaSlots() + 1;
+  commClass.assign(program->n_SDFchannels(), 0);
+  vector<int> tokSizes;
+  unordered_map<int, size_t> tokSizeClass;
+  vector<SDFChannel*> channels = program->getChannels();
+  for (size_t i = 0; i < program->n_SDFchannels(); i++) {
+    int tokSize = channels[i]->messageSize;
+    auto it = tokSizeClass.find(tokSize);
+    if (it == tokSizeClass.end()) {
+      it = tokSizeClass.insert(make_pair(tokSize, tokSizes.size())).first;
+      tokSizes.push_back(tokSize);
+    }
+    commClass[i] = it->second;
+  }
+  for (size_t i = 0; i < channels.size(); i++)
+    delete channels[i];
+  target->tdmaTables(tokSizes, transferTable, commTable);
   
   ///Load WCETs
-  load_wcets(xml);
+  load_wcets(entries);
 }
 
 /*Mapping::Mapping(Applications* p_program, Platform* p_target, 
@@ -68,32 +103,60 @@ Mapping::~Mapping() {
   //delete program;
   //delete target;
 }
-void Mapping::load_wcets(XMLdoc& xml)
+vector<Mapping::WCETEntry> Mapping::readWCETs(XMLdoc& xml)
 {
     const char* my_xpathString = "///WCETs/mapping";
 	LOG_DEBUG("running xpathString  " + tools::toString(my_xpathString) + " on WCET file ...");
 	auto xml_mappings = xml.xpathNodes(my_xpathString);
+	vector<WCETEntry> entries;
 	for (const auto& map : xml_mappings)
 	{
 		string task_type = xml.getProp(map, "task_type");
 		string proc_type = xml.getProp(map, "processor");
 		string task_wcet = xml.getProp(map, "wcet");
-        setWCETs(task_type, proc_type, atoi(task_wcet.c_str()));
+        entries.push_back(WCETEntry{task_type, proc_type, atoi(task_wcet.c_str())});
         
 		LOG_DEBUG("Reading mapping for task type: " + task_type + "...");		
 		
 	}	
-    for (size_t i=0; i < wcets.size(); i++)
+	return entries;
+}
+void Mapping::load_wcets(const vector<WCETEntry>& entries)
+{
+    for (const auto& entry : entries)
+        setWCETs(entry.taskType, entry.procModel, entry.wcet);
+    for (size_t i=0; i < program->n_programEntities(); i++)
+    {
+        const int* row = wcetRow(i);
+        for (size_t c=0; c < wcetColumns(); c++)
+        {
+            if(row[c] >= std::numeric_limits<int>::max() - 1)
+            THROW_EXCEPTION(InvalidArgumentException,"wcet is not specified for task "+program->getName(i)+"\n");
+        }
+    }
+}
+
+void Mapping::summarizeWCETs(size_t entity)
+{
+    int minW = std::numeric_limits<int>::max();
+    int maxW = 0;
+    for (size_t j=0; j < target->nodes(); j++)
     {
-        for (const auto& task_proc_wcets: wcets[i])
+        const int* w = wcetsOn(entity, j);
+        uint64_t valid = 0;
+        for (size_t k=0; k < target->getModes(j); k++)
         {
-            for (const auto& task_proc_mode_wcet: task_proc_wcets)
+            if (w[k] > 0)
             {
-                if(task_proc_mode_wcet >= std::numeric_limits<int>::max() - 1)
-                THROW_EXCEPTION(InvalidArgumentException,"wcet is not specified for task "+program->getName(i)+"\n");
+                valid |= uint64_t(1) << k;
+                minW = min(minW, w[k]);
+                maxW = max(maxW, w[k]);
             }
         }
+        validModes[entity*target->nodes() + j] = valid;
     }
+    minWCET[entity] = minW;
+    maxWCET[entity] = maxW;
 }
 Applications* Mapping::getApplications() const {
   return program;
@@ -120,8 +183,8 @@ bool Mapping::homogeneousPlatform() {
     return false;
 
   for (size_t i = 0; i < program->n_SDFActors(); i++) {
-    vector<int> wcets_i = getWCETsModes(i); //fixed
-    for (unsigned j = 1; j < wcets_i.size(); j++) {
+    const int* wcets_i = wcetRow(i); //fixed
+    for (unsigned j = 1; j < wcetColumns(); j++) {
       if (wcets_i[j - 1] != wcets_i[j])
         return false;
     }
@@ -133,7 +196,7 @@ bool Mapping::homogeneousNodes(int nodeI, int nodeJ) {
     return false;
   }
   for (size_t i = 0; i < program->n_SDFActors(); i++) {
-    vector<int> wcets_i = getWCETsModes(i);//fixed
+    const int* wcets_i = wcetRow(i);//fixed
     if (wcets_i[nodeI] != wcets_i[nodeJ])
       return false;
   }
@@ -151,7 +214,10 @@ bool Mapping::homogeneousModeNodes(int nodeI, int nodeJ) {
         return false;
     }
     for(size_t i = 0; i < program->n_SDFActors(); i++){
-        vector<vector<int>> wcets_i = getWCETs(i); //getWCETsModes(i);//fixed
+        size_t modesI = target->getModes(nodeI);
+        size_t modesJ = target->getModes(nodeJ);
+        const int* wcetsI = wcetsOn(i, nodeI);
+        const int* wcetsJ = wcetsOn(i, nodeJ);
 
         /*cout << "  Actor " << i << endl;
         cout << "    ";
@@ -165,12 +231,12 @@ bool Mapping::homogeneousModeNodes(int nodeI, int nodeJ) {
         }
         cout << endl;*/
 
-        if(wcets_i[nodeI].size() != wcets_i[nodeJ].size()){
+        if(modesI != modesJ){
             //cout << "~~~~~~~~~~~~~~~~" << endl;
             return false;
         }else{ //same number of modes
-            for(size_t j = 0; j < wcets_i[nodeI].size(); j++){
-                if(wcets_i[nodeI][j] != wcets_i[nodeJ][j]){
+            for(size_t j = 0; j < modesI; j++){
+                if(wcetsI[j] != wcetsJ[j]){
                     //cout << "~~~~~~~~~~~~~~~~" << endl;
                     return false;
                 }
@@ -181,6 +247,23 @@ bool Mapping::homogeneousModeNodes(int nodeI, int nodeJ) {
     return true;
 }
 
+vector<vector<int>> Mapping::homogeneousModeClasses() {
+  vector<vector<int>> classes;
+  for (size_t j = 0; j < target->nodes(); j++) {
+    bool found = false;
+    for (auto& c : classes) {
+      if (homogeneousModeNodes(c[0], j)) {
+        c.push_back(j);
+        found = true;
+        break;
+      }
+    }
+    if (!found)
+      classes.push_back({(int) j});
+  }
+  return classes;
+}
+
 //void Mapping::setWCETs(string name, vector<int> _wcets) {
 //	//[Nima] n_SDFActors changed to n_programEntities()
 //	for (size_t i = 0; i < program->n_programEntities(); i++) {
@@ -193,17 +276,25 @@ bool Mapping::homogeneousModeNodes(int nodeI, int nodeJ) {
 //fixed
 void Mapping::setWCETs(string taskType, string procModel, int _wcet) {
   for (size_t i = 0; i < program->n_programEntities(); i++) {      
-    if (taskType.compare(program->getType(i)) == 0) {
+    vector<string> types = program->getTypes(i);
+    int matches = count(types.begin(), types.end(), taskType);
+    if (matches > 0) {
       for (size_t j = 0; j < target->nodes(); j++) {
         if (procModel.compare(target->getProcModel(j)) == 0) {
-          if (wcets[i].size() <= j) {
-            THROW_EXCEPTION(InvalidArgumentException,"wcet out of bound\n");
-          }
+          int* w = &wcetTable[i*wcetStride + wcetOffset[j]];
           for (size_t k=0; k<target->getModes(j); k++){
-            wcets[i][j][k] = ceil(target->speedUp(j,k) *_wcet);
+            //a partially unfolded actor executes several firings back to back
+            int wcet = matches * program->getFirings(i) * ceil(target->speedUp(j,k) *_wcet);
+            //a clustered actor executes all its members, and cannot run
+            //where one of them cannot (negative WCET)
+            if (types.size() > 1 && w[k] < std::numeric_limits<int>::max() - 1)
+              w[k] = (w[k] < 0 || wcet < 0) ? -1 : w[k] + wcet;
+            else
+              w[k] = wcet;
           }
         }
       }
+      summarizeWCETs(i);
     }
   }
 }
@@ -230,27 +321,25 @@ void Mapping::setWCETs(vector<char*> elements, vector<char*> values) {
 
 //fixed
 vector<int> Mapping::getWCETsModes(unsigned actorId) const {
-  //flatten the vector of vectors (wcets[actorId]) into one vector
-  vector<int> _wcets;
-  for(const auto &v: wcets[actorId])
-  {
-    _wcets.insert(_wcets.end(), v.begin(), v.end());
-  }
-  return _wcets;
+  const int* row = wcetRow(actorId);
+  return vector<int>(row, row + wcetColumns());
 }
 
 //fixed
 vector<int> Mapping::getWCETsSingleMode(unsigned actorId) const {
   vector<int> _wcets;
   for (size_t i = 0; i < target->nodes(); i++) {
-    _wcets.push_back(wcets[actorId][i][0]);
+    _wcets.push_back(getWCET(actorId, i, 0));
   }
   return _wcets;
 }
 
 //fixed
 vector<vector<int>> Mapping::getWCETs(unsigned actorId) const {
-  return wcets[actorId];
+  vector<vector<int>> _wcets;
+  for (size_t j = 0; j < target->nodes(); j++)
+    _wcets.push_back(getWCETs(actorId, j));
+  return _wcets;
 }
 
 //fixed
@@ -269,39 +358,27 @@ vector<int> Mapping::getWCETs(unsigned actorId, unsigned proc) const {
     }
 
     return _wcets*/;
-  return wcets[actorId][proc];
+  const int* w = wcetsOn(actorId, proc);
+  return vector<int>(w, w + target->getModes(proc));
 }
 
 //checked
 int Mapping::getMinWCET(unsigned actorId) const {
-  int wcet = getValidWCETs(actorId, 0)[0];
-  for (size_t i = 0; i < target->nodes(); i++) {
-    vector<int> tmp_wcets = getValidWCETs(actorId, i);
-    if (wcet > *min_element(tmp_wcets.begin(), tmp_wcets.end()))
-      wcet = *min_element(tmp_wcets.begin(), tmp_wcets.end());
-  }
-
-  return wcet;
+  return minWCET[actorId];
 }
 
 //checked
 int Mapping::getMaxWCET(unsigned actorId) const {
-  int wcet = 0;
-  for (size_t i = 0; i < target->nodes(); i++) {
-    vector<int> tmp_wcets = getValidWCETs(actorId, i);
-    if (wcet < *max_element(tmp_wcets.begin(), tmp_wcets.end()))
-      wcet = *max_element(tmp_wcets.begin(), tmp_wcets.end());
-  }
-
-  return wcet;
+  return maxWCET[actorId];
 }
 
 //fixed
 vector<int> Mapping::getValidWCETs(unsigned actorId, unsigned proc) const {
   vector<int> _wcets;
-  for (size_t i = 0; i<wcets[actorId][proc].size(); i++){
-    if (wcets[actorId][proc][i] > 0)
-      _wcets.push_back(wcets[actorId][proc][i]);
+  const int* w = wcetsOn(actorId, proc);
+  for (size_t i = 0; i<target->getModes(proc); i++){
+    if (w[i] > 0)
+      _wcets.push_back(w[i]);
   }
 
   return _wcets;
@@ -322,9 +399,9 @@ vector<int> Mapping::sortedByWCETs(size_t app) const {
   for (size_t i = 0; i < program->n_SDFActors(); i++) {
     if (program->getSDFGraph(i) == app) {
       div_t tmpI;
-      vector<int> wcets = getWCETsModes(i);
-      tmpI.quot = *max_element(wcets.begin(), wcets.end());
-      for (unsigned w = 0; w < wcets.size(); w++) {
+      const int* wcets = wcetRow(i);
+      tmpI.quot = *max_element(wcets, wcets + wcetColumns());
+      for (unsigned w = 0; w < wcetColumns(); w++) {
         if (wcets[w] != -1) {
           if (tmpI.quot > wcets[w])
             tmpI.quot = wcets[w];
@@ -348,9 +425,9 @@ vector<int> Mapping::sortedByWCETs() {
   vector<div_t> tmp;
   for (size_t i = 0; i < program->n_SDFActors(); i++) {
     div_t tmpI;
-    vector<int> wcets = getWCETsModes(i);
-    tmpI.quot = *max_element(wcets.begin(), wcets.end());
-    for (unsigned w = 0; w < wcets.size(); w++) {
+    const int* wcets = wcetRow(i);
+    tmpI.quot = *max_element(wcets, wcets + wcetColumns());
+    for (unsigned w = 0; w < wcetColumns(); w++) {
       if (wcets[w] != -1) {
         if (tmpI.quot > wcets[w])
           tmpI.quot = wcets[w];
@@ -460,10 +537,6 @@ int Mapping::getInitLatency(int app) const {
 
 // Gives the memory consumption of the specified actor on the specified node
 //TODO: get this from a file
-int Mapping::memConsCode(int actor, int node) {
-  return program->getCodeSize(actor);
-}
-
 // Gives the memory consumptions of the specified actor on all nodes
 const vector<int> Mapping::memConsCode(int actor) {
   vector<int> mem;
@@ -473,11 +546,6 @@ const vector<int> Mapping::memConsCode(int actor) {
   return mem;
 }
 // Gives the memory consumption of the specified actor on the specified node
-//TODO: get this from a file
-int Mapping::memConsData(int actor, int node) {
-  return program->getDataSize(actor);
-}
-
 // Gives the memory consumptions of the specified actor on all nodes
 const vector<int> Mapping::memConsData(int actor) {
   vector<int> mem;
@@ -493,23 +561,25 @@ int Mapping::wcCommTime(int channel) {
   /*int maxTime=program->getTokenSize(channel)/target->bandwidthPerSlot().quot;
     if((program->getTokenSize(channel)%target->bandwidthPerSlot().quot)>0) maxTime++;
     return maxTime;*/
-  return target->maxCommTimes(program->getTokenSize(channel))[1];
+  return wcCommTime(channel, 1);
 }
 
 // Gives a vector with communication times for the channel, depending on allocated TDMA slots
 const vector<int> Mapping::wcCommTimes(int channel) {
-  return target->maxCommTimes(program->getTokenSize(channel));
+  const int* row = &commTable[commClass[channel]*commStride];
+  return vector<int>(row, row + commStride);
 }
 
 // Gives a vector with blocking times for the channel, depending on allocated TDMA slots
 // (waiting time from release of a message until the first available slot)
-const vector<int> Mapping::wcBlockingTimes() {
+const vector<int>& Mapping::wcBlockingTimes() const {
   return target->maxBlockingTimes();
 }
 
 // Gives a vector with communication times for the channel, depending on allocated TDMA slots
 const vector<int> Mapping::wcTransferTimes(int channel) {
-  return target->maxTransferTimes(program->getTokenSize(channel));
+  const int* row = &transferTable[commClass[channel]*commStride];
+  return vector<int>(row, row + commStride);
 }
 
 // Gives the sum of maximum communication times over all channels
@@ -546,10 +616,10 @@ void Mapping::maxIterations() {
     its[id]=program->getMaxNumberOfIPTInstances(id);
     }else if(program->isSDF(id)){
     if(target->nodes()>1){
-    if(program->getPredecessors(id).size() == 0){
+    if(program->predecessorIds(id).empty()){
     its[id]=(sumMaxExecTimes()+sumWcetCommTimes())/minExecTime(id);
     }else{
-    vector<int> preds = program->getPredecessors(id);
+    tools::ArrayView<int> preds = program->predecessorIds(id);
     vector<int> tmp_its(preds.size(), -1);
     for (size_t i=0; i<preds.size(); i++){
     if(its[preds[i]]>0) tmp_its[i]=its[preds[i]];
@@ -797,10 +867,10 @@ void Mapping::generateDZNfile(const string &dir) const {
 void Mapping::PrintWCETs() const{
   for (unsigned i = 0; i < program->n_programEntities(); i++) {
     cout << "\nWCETs[" << i << "]: " << endl;
-    for (unsigned j = 0; j < wcets[i].size(); j++) {
+    for (unsigned j = 0; j < target->nodes(); j++) {
       cout << "  p" << j << ": ";
-      for(unsigned k = 0; k<wcets[i][j].size(); k++){
-        cout << wcets[i][j][k] << ", ";
+      for(unsigned k = 0; k<target->getModes(j); k++){
+        cout << getWCET(i, j, k) << ", ";
       }
     }
   }
@@ -821,75 +891,50 @@ void Mapping::PrintUtilizations() {
 }
 //fixed
 double Mapping::getTaskUtilization(int entityID, unsigned procID) {
-  vector<int> _wcets = getWCETsSingleMode(entityID); ///should use function because it does not factor in speedupds
   if (program->getTaskPeriod(entityID) <= 0) {
     THROW_EXCEPTION(InvalidArgumentException,string("period of entity: ") + tools::toString(entityID) +
         " : " + tools::toString(program->getTaskPeriod(entityID)));
   }
-  return (double) _wcets[procID] / program->getTaskPeriod(entityID);
+  return (double) getWCET(entityID, procID, 0) / program->getTaskPeriod(entityID);
 }
 
-int Mapping::LeveliWorkload(int entityID, int t) {
-  auto procID = current_mapping[entityID];
-  int W = getWCET(entityID, current_mapping[entityID], current_modes[procID]);
+void Mapping::fpTasksOnProc(size_t procID, vector<int>& ids, vector<tools::FPTask>& tasks) {
+  ids.clear();
+  tasks.clear();
   for (size_t i = program->n_SDFActors(); i < program->n_programEntities();
        i++) {
-    /**
-     * If task is mapped on my processor and it has higher priority
-     */
-    if (procID == current_mapping[i]
-        && program->getTaskPriority(entityID)
-        < program->getTaskPriority(i)) {
-      W += ceil((double) t / program->getTaskPeriod(i))
-        * getWCET(i, current_mapping[i],
-                  current_modes[current_mapping[i]]);
+    if ((size_t)current_mapping[i] == procID) {
+      ids.push_back(i);
+      tasks.push_back({getWCET(i, current_mapping[i], current_modes[current_mapping[i]]),
+                       program->getTaskPeriod(i),
+                       program->getTaskDeadline(i),
+                       program->getTaskPriority(i)});
     }
   }
-  return W;
+}
+
+int Mapping::LeveliWorkload(int entityID, int t) {
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
+  fpTasksOnProc(current_mapping[entityID], ids, tasks);
+  size_t i = find(ids.begin(), ids.end(), entityID) - ids.begin();
+  return tools::leveliWorkload(tasks, i, t);
 }
 bool Mapping::FPSchedulable() {
   const clock_t begin_time = clock();
-  bool taski;
+  vector<int> ids;
+  vector<tools::FPTask> tasks;
   //program->SetRMPriorities();
 
   for (size_t k = 0; k < target->nodes(); k++) {
-    double util = 0;
-    int task_on_k = 0;
-    for (size_t i = program->n_SDFActors(); i < program->n_programEntities();
-         i++) {
-      if ((size_t)current_mapping[i] == k) {
-        task_on_k++;
-        util += getWCET(i, current_mapping[i],
-                        current_modes[current_mapping[i]])
-          / (double) program->getTaskDeadline(i);
-      }
-    }
-    double bound = task_on_k * (pow(2, (1.0 / task_on_k)) - 1);
-    //cout << "util[" << k << "] = " << util << " bound = " << bound << endl;
-    if (task_on_k == 0 || util <= bound) {
-      // cout << "proc " << k << " is schedulable based on utilization test\n";
-    } else {
-      for (size_t i = program->n_SDFActors();
-           i < program->n_programEntities(); i++) {
-        if ((size_t)current_mapping[i] == k) {
-          taski = false;
-          for (auto t = 1; t <= program->getTaskDeadline(i); t++) //This can be improved by Bini and Buttazzo's approach
-            {
-              if (LeveliWorkload(i, t) <= t) {
-                taski = true;
-                break;
-              }
-            }
-          if (!taski) {
-            schedulabilityTime = clock() - begin_time;
-            cout << "processor " << k << " is not schedulable \n";
-            return false;
-          }
-        }
-      }
+    fpTasksOnProc(k, ids, tasks);
+    if (!fpCache.schedulable(ids, tasks)) {
       schedulabilityTime = clock() - begin_time;
+      LOG_DEBUG("processor " + tools::toString(k) + " is not schedulable");
+      return false;
     }
   }
+  schedulabilityTime = clock() - begin_time;
 
   return true;
 }
@@ -909,8 +954,8 @@ int Mapping::getMaxWCET_IPT() {
        i++){
     for (size_t j = 0; j < target->nodes(); j++){
       for (size_t k = 0; k<target->getModes(j); k++){
-        if (wcets[i][j][k] > maxWCET)
-          maxWCET = wcets[i][j][k];
+        if (getWCET(i, j, k) > maxWCET)
+          maxWCET = getWCET(i, j, k);
       }
     }
   }
@@ -935,10 +980,10 @@ vector<int> Mapping::getUtilizationVector(int entityID) {
 }
 //fixed
 vector<int> Mapping::getUtilizationModeVector(int entityID, unsigned proc) {
-  vector<int> _utils, tmp_wcets;
-  tmp_wcets = getWCETs(entityID, proc);
+  vector<int> _utils;
+  const int* tmp_wcets = wcetsOn(entityID, proc);
   for (size_t i = 0; i < target->getModes(proc); i++) {
-    if (wcets[entityID][proc][i] != -1)
+    if (tmp_wcets[i] != -1)
       _utils.push_back(
                        ceil(
                             (tmp_wcets[i] * max_utilization)
@@ -1057,8 +1102,14 @@ void Mapping::SortTasksUtilization() {
       auto util_ip1 = getUtilizationVector(i + 1);
       if (util_i[0] < util_ip1[0]) {
         program->swapPrTasks(i, i + 1);
-        using std::swap;
-        swap(wcets[i], wcets[i + 1]);
+        swap_ranges(wcetTable.begin() + i*wcetStride, wcetTable.begin() + (i+1)*wcetStride,
+                    wcetTable.begin() + (i+1)*wcetStride);
+        swap_ranges(memCode.begin() + i*target->nodes(), memCode.begin() + (i+1)*target->nodes(),
+                    memCode.begin() + (i+1)*target->nodes());
+        swap_ranges(memData.begin() + i*target->nodes(), memData.begin() + (i+1)*target->nodes(),
+                    memData.begin() + (i+1)*target->nodes());
+        summarizeWCETs(i);
+        summarizeWCETs(i + 1);
       }
     }
 }
@@ -1067,10 +1118,6 @@ void Mapping::setMappingMode(vector<int>& _mapping, vector<int>& _modes) {
   current_mapping = _mapping;
   current_modes = _modes;
 }
-//fixed
-int Mapping::getWCET(unsigned actorId, unsigned proc, unsigned mode) const {
-  return wcets[actorId][proc][mode];
-}
 int Mapping::getMemorySize(unsigned proc) {
   return target->memorySize(proc, current_modes[proc]);
 }
@@ -1359,22 +1406,22 @@ int Mapping::getSumWCETs(size_t app) const {
   int sum = 0;
   for (size_t i = 0; i < program->n_SDFActors(); i++) {
     if (program->getSDFGraph(i) == app) {
-      vector<int> wcets = getWCETsModes(i);
-      sum += *max_element(wcets.begin(), wcets.end());      
+      const int* wcets = wcetRow(i);
+      sum += *max_element(wcets, wcets + wcetColumns());
     }
   }
   return sum;
 }
 int Mapping::getSumWCCTs(size_t app) {
   int sum = 0;
-  vector<int> wcbts = wcBlockingTimes();
+  const vector<int>& wcbts = wcBlockingTimes();
   int wcbt = *max_element(wcbts.begin(), wcbts.end());
   for (size_t i = 0; i < program->n_SDFchannels(); i++) 
   {
     int src_i = program->getChannel(i)->source;
     if (program->getSDFGraph(src_i) == app) {
-      vector<int> wccts = wcTransferTimes(i);
-      sum += wcbt + *max_element(wccts.begin(), wccts.end());      
+      const int* wccts = &transferTable[commClass[i]*commStride];
+      sum += wcbt + *max_element(wccts, wccts + commStride);      
     }
   }
   return sum;
@@ -29,11 +29,14 @@
 
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
 
 #include "../applications/applications.hpp"
 #include "../platform/platform.hpp"
 
 #include "../exceptions/runtimeexception.h"
+#include "../tools/fpschedulability.hpp"
+#include "../tools/alignedallocator.hpp"
 
 
 using namespace std;
@@ -60,7 +63,29 @@ protected:
   vector<int> send_buff;            /*!< Buffer sizes for receiving buffer of all channels. */
   vector<int> rec_buff;             /*!< Buffer sizes for receiving buffer of all channels. */
 
-  vector<vector<vector<int>>> wcets; /*!< WCET of all actors and all periodic tasks on each processor in all modes. */
+  /** WCET of all actors and all periodic tasks on each processor in all modes, as one table:
+      the WCETs of entity i on processor j in its modes start at wcetTable[i*wcetStride+wcetOffset[j]],
+      so that row i holds all modes of all processors (as getWCETsModes). Rows are padded to whole
+      cache lines. */
+  vector<int, tools::AlignedAllocator<int>> wcetTable;
+  vector<size_t> wcetOffset;   /*!< First column of each processor in a row; the last entry is the number of columns. */
+  size_t wcetStride;           /*!< Length of a row, in ints. */
+  vector<int> minWCET;         /*!< Smallest valid (>0) WCET of each entity. */
+  vector<int> maxWCET;         /*!< Largest valid (>0) WCET of each entity. */
+  vector<uint64_t> validModes; /*!< [entity*nodes+proc]: bit k is set iff the WCET in mode k is valid (>0). */
+  vector<int> memCode;         /*!< [entity*nodes+proc]: code memory of the entity on the processor. */
+  vector<int> memData;         /*!< [entity*nodes+proc]: data memory of the entity on the processor. */
+
+  /** Worst-case transfer and communication times on the TDMA bus, as Platform::maxTransferTimes
+      and Platform::maxCommTimes, computed once per token size: the times of channel ch with
+      s allocated slots are at [commClass[ch]*commStride+s]. */
+  vector<int> transferTable;
+  vector<int> commTable;
+  vector<size_t> commClass;    /*!< Token-size class (row of the TDMA tables) of each SDF channel. */
+  size_t commStride;           /*!< Length of a row of the TDMA tables (tdmaSlots()+1). */
+
+  /** Updates minWCET, maxWCET and validModes of an entity after its WCETs changed. */
+  void summarizeWCETs(size_t entity);
   vector<int> fixed_wcets;   /*!< WCET of all actors and all periodic tasks on its allocated processor 
                                in a fixed mapping. */
   vector<div_t> comm_delay;   /*!< Communication delay for all channels (sending).
@@ -107,6 +132,10 @@ protected:
   
   //Time spent in schedulability analysis
   clock_t schedulabilityTime; 
+  //FP verdicts per processor task set, reused across validated solutions
+  tools::FPSchedulabilityCache fpCache;
+  //Collects the periodic tasks on procID under the current mapping and modes
+  void fpTasksOnProc(size_t procID, vector<int>& ids, vector<tools::FPTask>& tasks);
 
   vector<int>  current_mapping; /*!< Used by validation class. */  
   vector<int>  current_modes;   /*!< Used by validation class. */  
@@ -115,12 +144,23 @@ public:
 
   int const max_utilization = 1000;
 
+  /** WCET of a task type on a processor model, as given in the WCET input. */
+  struct WCETEntry {
+    string taskType;
+    string procModel;
+    int    wcet;
+  };
+
   Mapping() {};
   Mapping(Applications*, Platform*, XMLdoc&);
+  /** Creates the mapping from WCET entries already read, e.g. from a compiled instance. */
+  Mapping(Applications*, Platform*, const vector<WCETEntry>&);
   //Mapping(Applications*, Platform*, vector<vector<int>>&, vector<int>&, vector<int>&, vector<vector<SDFChannel*>>&);
 
   ~Mapping();
-  void load_wcets(XMLdoc& xml);
+  /** Reads the WCET entries of the WCET input file. */
+  static vector<WCETEntry> readWCETs(XMLdoc& xml);
+  void load_wcets(const vector<WCETEntry>& entries);
   Applications* getApplications() const;
 
   Platform* getPlatform() const;
@@ -229,7 +269,23 @@ public:
   vector<int> getWCETs(unsigned actorId, unsigned proc) const;
   
   /** @return WCET of an entity on a particular processor in a given mode */ 
-  int getWCET(unsigned actorId, unsigned proc, unsigned mode) const;
+  int getWCET(unsigned actorId, unsigned proc, unsigned mode) const {
+    return wcetTable[actorId*wcetStride + wcetOffset[proc] + mode];
+  }
+
+  /** @return the WCETs of an entity on all processors in all modes, as getWCETsModes
+    but without a copy; wcetColumns() values. */
+  const int* wcetRow(unsigned actorId) const { return &wcetTable[actorId*wcetStride]; }
+
+  /** @return number of values in a wcetRow(). */
+  size_t wcetColumns() const { return wcetOffset.back(); }
+
+  /** @return the WCETs of an entity on a processor, one per mode of the processor,
+    as getWCETs(actorId, proc) but without a copy. */
+  const int* wcetsOn(unsigned actorId, unsigned proc) const { return &wcetTable[actorId*wcetStride + wcetOffset[proc]]; }
+
+  /** @return the modes of proc in which the entity has a valid WCET, as a bit mask. */
+  uint64_t getValidModes(unsigned actorId, unsigned proc) const { return validModes[actorId*target->nodes() + proc]; }
   
   /** @param id of the actor/task.
     @return the minimal WCET of an actor/task. */
@@ -330,6 +386,7 @@ public:
   bool homogeneousPlatform(); /*!< Determines whether the platform is homogenous. */
   bool homogeneousNodes(int nodeI, int nodeJ); /*!< Determines whether nodes nodeI and nodeJ are homogenous. */
   bool homogeneousModeNodes(int nodeI, int nodeJ); /*!< Determines whether nodes nodeI and nodeJ have the same set of modes. */
+  vector<vector<int>> homogeneousModeClasses(); /*!< Partitions the nodes into classes of interchangeable (homogeneousModeNodes) nodes, in increasing order. */
 
   void setFirstMapping(vector<div_t>& _firstMapping);
 
@@ -365,13 +422,13 @@ public:
   //vector<vector<SDFChannel*>> getMessageOrder() const;
 
   // Gives the memory consumption of the specified actor on the specified node
-  int memConsCode(int actor, int node);
+  int memConsCode(int actor, int node) const { return memCode[actor*target->nodes() + node]; }
 
   // Gives the memory consumptions of the specified actor on all nodes
   const vector<int> memConsCode(int actor);
 
   // Gives the memory consumption of the specified actor on the specified node
-  int memConsData(int actor, int node);
+  int memConsData(int actor, int node) const { return memData[actor*target->nodes() + node]; }
 
   // Gives the memory consumptions of the specified actor on all nodes
   const vector<int> memConsData(int actor);
@@ -382,13 +439,26 @@ public:
   // Gives a vector with communication times for the channel, depending on allocated TDMA slots
   const vector<int> wcCommTimes(int channel);
 
+  // Gives the communication time for the channel with the given number of TDMA slots
+  int wcCommTime(int channel, int slots) const { return commTable[commClass[channel]*commStride + slots]; }
+
   // Gives a vector with blocking times for the channel, depending on allocated TDMA slots
   // (waiting time from release of a message until the first available slot)
-  const vector<int> wcBlockingTimes();
+  const vector<int>& wcBlockingTimes() const;
+
+  // Gives the blocking time with the given number of TDMA slots
+  int wcBlockingTime(int slots) const { return target->maxBlockingTimes()[slots]; }
 
   // Gives a vector with communication times for the channel, depending on allocated TDMA slots
   const vector<int> wcTransferTimes(int channel);
 
+  // Gives the transfer time for the channel with the given number of TDMA slots
+  int wcTransferTime(int channel, int slots) const { return transferTable[commClass[channel]*commStride + slots]; }
+
+  // Gives the token-size class of the channel; channels of one class have the same
+  // transfer and communication times
+  size_t getCommClass(int channel) const { return commClass[channel]; }
+
   // Gives the sum of maximum communication times over all channels
   int sumWcetCommTimes();
 
@@ -0,0 +1,82 @@
+#include "problem.hpp"
+#include "../cp_model/sdf_pr_online_model.hpp"
+#include "../execution/modelsearch.hpp"
+#include "../metaheuristic/ga_population.hpp"
+
+using namespace std;
+
+Problem::Problem(const vector<SDFGraphBuilder>& graphs, const PlatformBuilder& _platform,
+                 const WCETTable& wcets, const vector<PeriodicTask*>& tasks,
+                 size_t maxUnfolding) {
+  vector<SDFGraph*> sdfs;
+  for (const auto& g : graphs)
+    sdfs.push_back(new SDFGraph(g, maxUnfolding));
+
+  taskset = new TaskSet(tasks);
+  if (taskset->getNumberOfTasks() > 0)
+    taskset->SetRMPriorities();
+  platform = _platform.build();
+
+  //the design constraints are part of the graphs
+  applications = shared_ptr<Applications>(new Applications(sdfs, vector<DesignConstraints*>(), taskset));
+  mapping = shared_ptr<Mapping>(new Mapping(applications.get(), platform, wcets.entries()));
+  mapping->SortTasksUtilization();
+}
+
+Problem::~Problem() {
+  mapping.reset();
+  applications.reset();
+  delete platform;
+  delete taskset;
+}
+
+shared_ptr<Applications> Problem::getApplications() const {
+  return applications;
+}
+
+shared_ptr<Mapping> Problem::getMapping() const {
+  return mapping;
+}
+
+DesignResult Problem::evaluate(const DesignPoint& d) const {
+  Design design(mapping, applications, d.proc_mappings, d.proc_modes,
+                d.next, d.sendNext, d.recNext, d.tdmaAlloc);
+  DesignResult result;
+  result.periods     = design.get_periods();
+  result.energy      = design.get_energy();
+  result.memorySlack = design.get_slack_memory();
+  return result;
+}
+
+vector<Solution> Problem::searchGA(Config& cfg) const {
+  GA_Population p(mapping, applications, cfg);
+  p.search();
+  vector<Solution> solutions;
+  for (const auto& d : p.get_designs())
+    solutions.push_back({d, evaluate(d)});
+  return solutions;
+}
+
+vector<Solution> Problem::searchCP(Config& cfg) const {
+  vector<Solution> solutions;
+  auto collect = [&](SDFPROnlineModel* s) {
+    vector<vector<int>> x = s->extractDesign();
+    DesignPoint d;
+    //the Design only covers the SDF actors
+    d.proc_mappings.assign(x[0].begin(), x[0].begin() + applications->n_SDFActors());
+    d.proc_modes = x[1];
+    d.tdmaAlloc  = x[2];
+    d.next       = x[3];
+    d.sendNext   = x[4];
+    d.recNext    = x[5];
+    solutions.push_back({d, evaluate(d)});
+    delete s;
+  };
+
+  SDFPROnlineModel* model = new SDFPROnlineModel(mapping.get(), &cfg);
+  //the portfolio branchings are posted per worker by Execution
+  if (cfg.settings().search == Config::PORTFOLIO)
+    model->postBranching(0, 0);
+  searchModel(model, cfg, collect);
+  return solutions;
+}
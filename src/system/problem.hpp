@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __PROBLEM__
+#define __PROBLEM__
+
+#include <memory>
+#include <vector>
+
+#include "mapping.hpp"
+#include "design.hpp"
+#include "wcettable.hpp"
+#include "../applications/sdfgraphbuilder.hpp"
+#include "../platform/platformbuilder.hpp"
+#include "../settings/config.hpp"
+
+using namespace std;
+
+/**
+ * A design found by an exploration, with its performance.
+ */
+struct Solution {
+  DesignPoint  design;
+  DesignResult result;
+};
+
+/**
+ * A DSE problem constructed in memory, for programs using DeSyDe as a
+ * library (libdesyde) instead of the adse tool: no input file is read.
+ * The problem owns its applications, platform and mapping; getMapping()
+ * and getApplications() give them to the exploration classes (e.g.
+ * GA_Population, Swarm or an SDFPROnlineModel), evaluate() analyses
+ * a single design, and searchGA() and searchCP() return the designs an
+ * exploration finds.
+ */
+class Problem {
+public:
+  /**
+   * Builds the graphs, the platform and the mapping.
+   * @param tasks periodic tasks, owned by the problem afterwards
+   * @param maxUnfolding see SDFGraph(XMLdoc&, size_t)
+   */
+  Problem(const vector<SDFGraphBuilder>& graphs, const PlatformBuilder& platform,
+          const WCETTable& wcets, const vector<PeriodicTask*>& tasks = vector<PeriodicTask*>(),
+          size_t maxUnfolding = 0);
+  ~Problem();
+  Problem(const Problem&) = delete;
+  Problem& operator=(const Problem&) = delete;
+
+  shared_ptr<Applications> getApplications() const;
+  shared_ptr<Mapping> getMapping() const;
+
+  /**
+   * Computes the periods, energy and memory slack of a design.
+   * Throws a RuntimeException if the vectors do not fit the problem.
+   */
+  DesignResult evaluate(const DesignPoint& design) const;
+
+  /**
+   * Runs the genetic algorithm (GA_Population) with the settings of cfg.
+   * The search still writes its log and plots to the output path of cfg.
+   * @return the designs of the Pareto front (multi-objective), or of the
+   *         long term memory, without violations
+   */
+  vector<Solution> searchGA(Config& cfg) const;
+
+  /**
+   * Solves the CP model with the settings of cfg: branch and bound if cfg
+   * optimizes, otherwise depth-first search, stopped after
+   * dse.timeout_all ms if set.
+   * @return the solutions in the order they were found
+   */
+  vector<Solution> searchCP(Config& cfg) const;
+
+private:
+  TaskSet*                 taskset;
+  Platform*                platform;
+  shared_ptr<Applications> applications;
+  shared_ptr<Mapping>      mapping;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __WCETTABLE__
+#define __WCETTABLE__
+
+#include <string>
+#include <vector>
+
+#include "mapping.hpp"
+
+using namespace std;
+
+/**
+ * The WCETs of task types (SDF parent actors or periodic task types) on
+ * processor models, given in memory as an alternative to a WCET XML file.
+ */
+class WCETTable {
+public:
+  /** Sets the WCET of taskType on procModel. */
+  WCETTable& set(const string& taskType, const string& procModel, int wcet) {
+    entries_.push_back(Mapping::WCETEntry{taskType, procModel, wcet});
+    return *this;
+  }
+
+  const vector<Mapping::WCETEntry>& entries() const { return entries_; }
+
+private:
+  vector<Mapping::WCETEntry> entries_;
+};
+
+#endif
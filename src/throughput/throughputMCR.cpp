@@ -1,23 +1,50 @@
 #include "throughputMCR.hpp"
 #include "../tools/stringtools.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
 
 using namespace Gecode;
 using namespace Int;
 using namespace std;
 
+namespace {
+  const size_t profileKind = tools::PropStats::kind("ThroughputMCR");
+}
+
 ThroughputMCR::ThroughputMCR(Space& home, ViewArray<IntView> p_latency, ViewArray<IntView> p_period, ViewArray<IntView> p_iterations,
     ViewArray<IntView> p_iterationsCh, ViewArray<IntView> p_sendbufferSz, ViewArray<IntView> p_recbufferSz, ViewArray<IntView> p_next,
     ViewArray<IntView> p_wcet, ViewArray<IntView> p_sendingTime, ViewArray<IntView> p_sendingLatency, ViewArray<IntView> p_sendingNext,
     ViewArray<IntView> p_receivingTime, ViewArray<IntView> p_receivingNext, IntArgs p_ch_src, IntArgs p_ch_dst, IntArgs p_tok, IntArgs p_apps,
-    IntArgs p_minIndices, IntArgs p_maxIndices) :
+    IntArgs p_minIndices, IntArgs p_maxIndices, bool p_partialBound) :
     Propagator(home), latency(p_latency), period(p_period), iterations(p_iterations), iterationsCh(p_iterationsCh), sendbufferSz(p_sendbufferSz), recbufferSz(
         p_recbufferSz), next(p_next), wcet(p_wcet), sendingTime(p_sendingTime), sendingLatency(p_sendingLatency), sendingNext(p_sendingNext), receivingTime(
         p_receivingTime), receivingNext(p_receivingNext), ch_src(p_ch_src), ch_dst(p_ch_dst), tok(p_tok), apps(p_apps), minIndices(p_minIndices), maxIndices(
-        p_maxIndices) {
+        p_maxIndices), c(home) {
+
+  printDebug = false;
+  partialBound = p_partialBound;
+
+  n_actors = p_wcet.size();
+  n_channels = p_ch_src.size();
+  n_procs = p_next.size() - n_actors;
 
-  sendingTime.subscribe(home, *this, Int::PC_INT_BND);
-  sendingNext.subscribe(home, *this, Int::PC_INT_VAL);
-  next.subscribe(home, *this, Int::PC_INT_VAL);
+  //schedule views change the structure of the MSAG, all others only its weights
+  for(int i = 0; i < next.size(); i++)
+    (void) new (home) MsagAdvisor(home, *this, c, next[i], -1);
+  for(int i = 0; i < sendingNext.size(); i++)
+    (void) new (home) MsagAdvisor(home, *this, c, sendingNext[i], -1);
+  for(int i = 0; i < receivingNext.size(); i++)
+    (void) new (home) MsagAdvisor(home, *this, c, receivingNext[i], -1);
+  for(int i = 0; i < wcet.size(); i++)
+    (void) new (home) MsagAdvisor(home, *this, c, wcet[i], sourceKey(SRC_WCET, i));
+  for(int i = 0; i < n_channels; i++){
+    (void) new (home) MsagAdvisor(home, *this, c, sendingTime[i], sourceKey(SRC_SENDTIME, i));
+    (void) new (home) MsagAdvisor(home, *this, c, sendingLatency[i], sourceKey(SRC_SENDLAT, i));
+    (void) new (home) MsagAdvisor(home, *this, c, receivingTime[i], sourceKey(SRC_RECTIME, i));
+    (void) new (home) MsagAdvisor(home, *this, c, sendbufferSz[i], sourceKey(SRC_SENDBUF, i));
+    (void) new (home) MsagAdvisor(home, *this, c, recbufferSz[i], sourceKey(SRC_RECBUF, i));
+  }
+  msagStale = true;
   /*latency.subscribe(home, *this, Int::PC_INT_BND);
    period.subscribe(home, *this, Int::PC_INT_BND);
    sendbufferSz.subscribe(home, *this, Int::PC_INT_BND);
@@ -28,11 +55,6 @@ ThroughputMCR::ThroughputMCR(Space& home, ViewArray<IntView> p_latency, ViewArra
    sendingNext.subscribe(home, *this, Int::PC_INT_VAL);
    receivingNext.subscribe(home, *this, Int::PC_INT_VAL);*/
 
-  printDebug = false;
-
-  n_actors = p_wcet.size();
-  n_channels = p_ch_src.size();
-  n_procs = p_next.size() - n_actors;
   wc_latency.insert(wc_latency.begin(), p_apps.size(), vector<int>());
   wc_period.insert(wc_period.begin(), p_apps.size(), 0);
 
@@ -40,9 +62,7 @@ ThroughputMCR::ThroughputMCR(Space& home, ViewArray<IntView> p_latency, ViewArra
 }
 
 size_t ThroughputMCR::dispose(Space& home) {
-  sendingTime.cancel(home, *this, Int::PC_INT_BND);
-  sendingNext.cancel(home, *this, Int::PC_INT_VAL);
-  next.cancel(home, *this, Int::PC_INT_VAL);
+  c.dispose(home);
   /*latency.cancel(home, *this, Int::PC_INT_BND);
    period.cancel(home, *this, Int::PC_INT_BND);
    sendbufferSz.cancel(home, *this, Int::PC_INT_BND);
@@ -53,26 +73,20 @@ size_t ThroughputMCR::dispose(Space& home) {
    sendingNext.cancel(home, *this, Int::PC_INT_VAL);
    receivingNext.cancel(home, *this, Int::PC_INT_VAL);*/
 
-  //b_msag.~adj_list_impl();
-  b_msags.~vector<boost_msag*>();
-  msaGraph.~unordered_map<int, vector<SuccessorNode>>();
-  channelMapping.~vector<int>();
-  receivingActors.~vector<int>();
+  ch_src.~IntSharedArray();
+  ch_dst.~IntSharedArray();
+  tok.~IntSharedArray();
+  apps.~IntSharedArray();
+  minIndices.~IntSharedArray();
+  maxIndices.~IntSharedArray();
+  dirtySources.~vector<int>();
+  msag.~shared_ptr<const MsagStructure>();
+  msagWeights.~vector<int>();
+  msagTokens.~vector<int>();
+  msagOfApp.~vector<int>();
 
   wc_latency.~vector<vector<int>>();
   wc_period.~vector<int>();
-  max_start.~vector<vector<int>>();
-  max_end.~vector<vector<int>>();
-  min_start.~vector<vector<int>>();
-  min_end.~vector<vector<int>>();
-  start_pp.~vector<int>();
-  end_pp.~vector<int>();
-  min_iterations.~vector<int>();
-  max_iterations.~vector<int>();
-  min_send_buffer.~vector<int>();
-  max_send_buffer.~vector<int>();
-  min_rec_buffer.~vector<int>();
-  max_rec_buffer.~vector<int>();
 
   home.ignore(*this, AP_DISPOSE);
   (void) Propagator::dispose(home);
@@ -80,9 +94,16 @@ size_t ThroughputMCR::dispose(Space& home) {
 }
 
 ThroughputMCR::ThroughputMCR(Space& home, bool share, ThroughputMCR& p) :
-    Propagator(home, share, p), ch_src(p.ch_src), ch_dst(p.ch_dst), tok(p.tok), apps(p.apps), minIndices(p.minIndices), maxIndices(p.maxIndices), n_actors(
-        p.n_actors), n_channels(p.n_channels), n_procs(p.n_procs), n_msagActors(p.n_msagActors), msaGraph(p.msaGraph), b_msag(p.b_msag), b_msags(p.b_msags), channelMapping(
-        p.channelMapping), receivingActors(p.receivingActors), wc_latency(p.wc_latency), wc_period(p.wc_period), printDebug(p.printDebug) {
+    Propagator(home, share, p), n_actors(p.n_actors), n_channels(p.n_channels), n_procs(p.n_procs), n_msagActors(p.n_msagActors), msagStale(p.msagStale), dirtySources(
+        p.dirtySources), msag(p.msag), msagWeights(p.msagWeights), msagTokens(p.msagTokens), msagOfApp(p.msagOfApp), wc_latency(p.wc_latency), wc_period(p.wc_period), printDebug(
+        p.printDebug), partialBound(p.partialBound) {
+  c.update(home, share, p.c);
+  ch_src.update(home, share, p.ch_src);
+  ch_dst.update(home, share, p.ch_dst);
+  tok.update(home, share, p.tok);
+  apps.update(home, share, p.apps);
+  minIndices.update(home, share, p.minIndices);
+  maxIndices.update(home, share, p.maxIndices);
   latency.update(home, share, p.latency);
   period.update(home, share, p.period);
   iterations.update(home, share, p.iterations);
@@ -99,15 +120,175 @@ ThroughputMCR::ThroughputMCR(Space& home, bool share, ThroughputMCR& p) :
 }
 
 Propagator* ThroughputMCR::copy(Space& home, bool share) {
+  tools::CloneStats::record(sizeof(*this) + sizeof(int) * (dirtySources.size() + msagWeights.size() + msagTokens.size() + msagOfApp.size() + wc_period.size()));
   return new (home) ThroughputMCR(home, share, *this);
 }
 
-//TODO: do this right
+ThroughputMCR::Workspace& ThroughputMCR::workspace() {
+  static thread_local Workspace w;
+  return w;
+}
+
+//Howard's MCR is (in practice) about quadratic in the size of the MSAG, rebuilding
+//the MSAG on top of it walks the schedule chains once more
 PropCost ThroughputMCR::cost(const Space& home, const ModEventDelta& med) const {
-  return PropCost::linear(PropCost::HI, next.size());
+  int n = n_actors + 3 * n_channels;
+  if(msagStale)
+    return PropCost::cubic(PropCost::HI, n);
+  return PropCost::quadratic(PropCost::HI, n);
+}
+
+ExecStatus ThroughputMCR::advise(Space& home, Advisor& _a, const Delta& d) {
+  MsagAdvisor& a = static_cast<MsagAdvisor&>(_a);
+  IntView x = a.view();
+
+  if(a.key < 0){ //next, sendingNext or receivingNext: only decisions change the MSAG
+    if(!x.assigned())
+      return ES_FIX;
+    msagStale = true;
+    return home.ES_NOFIX_DISPOSE(c, a);
+  }
+
+  bool minMoved = x.any(d) || x.min(d) < x.min();
+  bool maxMoved = x.any(d) || x.max(d) > x.max();
+  if(a.key >= sourceKey(SRC_SENDBUF, 0)){ //buffer sizes are read as tokens (max)
+    if(!maxMoved)
+      return x.assigned() ? home.ES_FIX_DISPOSE(c, a) : ES_FIX;
+  }else if(!minMoved){ //delays are read as min
+    return x.assigned() ? home.ES_FIX_DISPOSE(c, a) : ES_FIX;
+  }
+  dirtySources.push_back(a.key);
+
+  //a channel starts to use the interconnect or gets decided: different MSAG actors
+  if(a.key >= sourceKey(SRC_SENDTIME, 0) && a.key < sourceKey(SRC_SENDLAT, 0)){
+    if(x.assigned() || x.any(d) || x.min(d) <= 0)
+      msagStale = true;
+  }
+  return x.assigned() ? home.ES_NOFIX_DISPOSE(c, a) : ES_NOFIX;
+}
+
+int ThroughputMCR::sourceKey(MsagSource src, int idx) const {
+  if(src == SRC_WCET)
+    return idx;
+  return n_actors + (src - SRC_SENDTIME) * n_channels + idx;
+}
+
+int ThroughputMCR::sourceValue(int key) const {
+  if(key < n_actors)
+    return wcet[key].min();
+  int idx = (key - n_actors) % n_channels;
+  switch((key - n_actors) / n_channels + SRC_SENDTIME){
+  case SRC_SENDTIME:
+    return sendingTime[idx].min();
+  case SRC_SENDLAT:
+    return sendingLatency[idx].min();
+  case SRC_RECTIME:
+    return receivingTime[idx].min();
+  case SRC_SENDBUF:
+    return sendbufferSz[idx].max();
+  default:
+    return recbufferSz[idx].max() - tok[idx];
+  }
+}
+
+void ThroughputMCR::putWeight(boost_msag& g, b::graph_traits<boost_msag>::edge_descriptor e, MsagSource src, int idx) {
+  int key = sourceKey(src, idx);
+  b::put(b::edge_weight, g, e, sourceValue(key));
+  b::put(edge_wsource, g, e, key + 1);
+}
+
+void ThroughputMCR::putTokens(boost_msag& g, b::graph_traits<boost_msag>::edge_descriptor e, MsagSource src, int idx) {
+  int key = sourceKey(src, idx);
+  b::put(b::edge_weight2, g, e, sourceValue(key));
+  b::put(edge_tsource, g, e, key + 1);
+}
+
+void ThroughputMCR::flattenMSAG(const vector<boost_msag*>& graphs) {
+  std::shared_ptr<MsagStructure> flat = std::make_shared<MsagStructure>();
+  msagWeights.clear();
+  msagTokens.clear();
+  for(size_t t = 0; t < graphs.size(); t++){
+    const boost_msag& g = *graphs[t];
+    flat->actors.push_back(vector<int>());
+    for(auto v : b::make_iterator_range(b::vertices(g)))
+      flat->actors.back().push_back(b::get(vertex_actorid, g, v));
+    for(auto e : b::make_iterator_range(b::edges(g))){
+      MsagEdge edge;
+      edge.graph = t;
+      edge.src = b::source(e, g);
+      edge.dst = b::target(e, g);
+      edge.wsource = b::get(edge_wsource, g, e);
+      edge.tsource = b::get(edge_tsource, g, e);
+      flat->edges.push_back(edge);
+      msagWeights.push_back(b::get(b::edge_weight, g, e));
+      msagTokens.push_back(b::get(b::edge_weight2, g, e));
+    }
+  }
+
+  //index edges by the views they read
+  int n_keys = sourceKey(SRC_RECBUF, n_channels);
+  vector<int>& first = flat->first;
+  first.assign(n_keys + 1, 0);
+  for(auto& e : flat->edges){
+    if(e.wsource)
+      first[e.wsource]++;
+    if(e.tsource && e.tsource != e.wsource)
+      first[e.tsource]++;
+  }
+  for(int k = 0; k < n_keys; k++)
+    first[k + 1] += first[k];
+  flat->index.assign(first[n_keys], 0);
+  vector<int> pos(first.begin(), first.end() - 1);
+  for(size_t i = 0; i < flat->edges.size(); i++){
+    const MsagEdge& e = flat->edges[i];
+    if(e.wsource)
+      flat->index[pos[e.wsource - 1]++] = i;
+    if(e.tsource && e.tsource != e.wsource)
+      flat->index[pos[e.tsource - 1]++] = i;
+  }
+  msag = flat;
+  dirtySources.clear();
+}
+
+bool ThroughputMCR::patchMSAG() {
+  bool moved = false;
+  for(int key : dirtySources){
+    int value = sourceValue(key);
+    for(int i = msag->first[key]; i < msag->first[key + 1]; i++){
+      int ei = msag->index[i];
+      const MsagEdge& e = msag->edges[ei];
+      if(e.wsource == key + 1 && msagWeights[ei] != value){
+        msagWeights[ei] = value;
+        moved = true;
+      }
+      if(e.tsource == key + 1 && msagTokens[ei] != value){
+        msagTokens[ei] = value;
+        moved = true;
+      }
+    }
+  }
+  dirtySources.clear();
+  return moved;
+}
+
+void ThroughputMCR::materializeMSAG(vector<boost_msag>& graphs) const {
+  graphs.assign(msag->actors.size(), boost_msag());
+  for(size_t t = 0; t < msag->actors.size(); t++){
+    for(int actor : msag->actors[t])
+      b::add_vertex(actor, graphs[t]);
+  }
+  b::graph_traits<boost_msag>::edge_descriptor _e;
+  bool found;
+  for(size_t i = 0; i < msag->edges.size(); i++){
+    const MsagEdge& e = msag->edges[i];
+    b::tie(_e, found) = b::add_edge(e.src, e.dst, graphs[e.graph]);
+    b::put(b::edge_weight, graphs[e.graph], _e, msagWeights[i]);
+    b::put(b::edge_weight2, graphs[e.graph], _e, msagTokens[i]);
+  }
 }
 
 void ThroughputMCR::constructMSAG() {
+  Workspace& w = workspace();
   if(printDebug)
     cout << "\tThroughputMCR::constructMSAG()" << endl;
 
@@ -123,22 +304,22 @@ void ThroughputMCR::constructMSAG() {
   b::graph_traits<boost_msag>::vertex_descriptor src, dst;
   b::graph_traits<boost_msag>::edge_descriptor _e;
 
-  msaGraph.clear();
-  receivingActors.clear();
-  channelMapping.clear();
-  receivingActors.insert(receivingActors.begin(), n_actors, -1); //pre-fill with -1
+  w.msaGraph.clear();
+  w.receivingActors.clear();
+  w.channelMapping.clear();
+  w.receivingActors.insert(w.receivingActors.begin(), n_actors, -1); //pre-fill with -1
 
   //add all actors as vertices, and self-loops
   bool found;
   for(int n = 0; n < n_msagActors; n++){
-    add_vertex(n, b_msag);
+    add_vertex(n, w.b_msag);
     //add self-edges
-    src = vertex(n, b_msag);
-    tie(_e, found) = add_edge(src, src, b_msag);
+    src = vertex(n, w.b_msag);
+    tie(_e, found) = add_edge(src, src, w.b_msag);
     if(n < n_actors){
-      b::put(b::edge_weight, b_msag, _e, wcet[n].min());
+      putWeight(w.b_msag, _e, SRC_WCET, n);
     } //else{}: delay for communication actors are added further down
-    b::put(b::edge_weight2, b_msag, _e, 1);
+    b::put(b::edge_weight2, w.b_msag, _e, 1);
   }
   //next: add edges to boost-msag
 
@@ -158,9 +339,9 @@ void ThroughputMCR::constructMSAG() {
       int send_actor = block_actor + 1;
       int rec_actor = send_actor + 1;
       //store mapping between block/send/rec_actor and channel i
-      channelMapping.push_back(i); //[block_actor] = i;
-      channelMapping.push_back(i); //[send_actor] = i;
-      channelMapping.push_back(i); //[rec_actor] = i;
+      w.channelMapping.push_back(i); //[block_actor] = i;
+      w.channelMapping.push_back(i); //[send_actor] = i;
+      w.channelMapping.push_back(i); //[rec_actor] = i;
       //add the block actor as a successor of ch_src[i]
       SuccessorNode succB;
       succB.successor_key = block_actor;
@@ -170,24 +351,24 @@ void ThroughputMCR::constructMSAG() {
       succB.channel = i;
 
       //add to boost-msag
-      src = b::vertex(ch_src[i], b_msag);
-      dst = b::vertex(block_actor, b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingLatency[i].min());
-      b::put(b::edge_weight2, b_msag, _e, 0);
+      src = b::vertex(ch_src[i], w.b_msag);
+      dst = b::vertex(block_actor, w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDLAT, i);
+      b::put(b::edge_weight2, w.b_msag, _e, 0);
       //delay-weight for self-loop on block-actor:
-      tie(_e, found) = edge(dst, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingLatency[i].min());
+      tie(_e, found) = edge(dst, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDLAT, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(ch_src[i]).push_back(succB);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(ch_src[i]).push_back(succB);
         }else{      //no entry for ch_src[i] yet
           vector<SuccessorNode> succBv;
           succBv.push_back(succB);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], succBv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], succBv));
         }
       }
 
@@ -199,21 +380,21 @@ void ThroughputMCR::constructMSAG() {
       srcCh.max_tok = sendbufferSz[i].max();
 
       //add to boost-msag
-      src = b::vertex(block_actor, b_msag);
-      dst = b::vertex(ch_src[i], b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, wcet[ch_src[i]].min());
-      b::put(b::edge_weight2, b_msag, _e, sendbufferSz[i].max());
+      src = b::vertex(block_actor, w.b_msag);
+      dst = b::vertex(ch_src[i], w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_WCET, ch_src[i]);
+      putTokens(w.b_msag, _e, SRC_SENDBUF, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(block_actor).push_back(srcCh);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(srcCh);
         }else{      //no entry for block_actor yet
           vector<SuccessorNode> srcChv;
           srcChv.push_back(srcCh);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, srcChv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, srcChv));
         }
       }
 //###
@@ -226,24 +407,24 @@ void ThroughputMCR::constructMSAG() {
       succS.channel = i;
 
       //add to boost-msag
-      src = b::vertex(block_actor, b_msag);
-      dst = b::vertex(send_actor, b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingTime[i].min());
-      b::put(b::edge_weight2, b_msag, _e, 0);
+      src = b::vertex(block_actor, w.b_msag);
+      dst = b::vertex(send_actor, w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDTIME, i);
+      b::put(b::edge_weight2, w.b_msag, _e, 0);
       //delay-weight for self-loop on send-actor:
-      tie(_e, found) = edge(dst, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingTime[i].min());
+      tie(_e, found) = edge(dst, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDTIME, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(block_actor).push_back(succS);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(succS);
         }else{      //no entry for block_actor yet
           vector<SuccessorNode> succSv;
           succSv.push_back(succS);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, succSv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, succSv));
         }
       }
 
@@ -256,21 +437,21 @@ void ThroughputMCR::constructMSAG() {
       succBS.channel = i;
 
       //add to boost-msag
-      src = b::vertex(send_actor, b_msag);
-      dst = b::vertex(block_actor, b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingLatency[i].min());
-      b::put(b::edge_weight2, b_msag, _e, 1);
+      src = b::vertex(send_actor, w.b_msag);
+      dst = b::vertex(block_actor, w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDLAT, i);
+      b::put(b::edge_weight2, w.b_msag, _e, 1);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){ //send actor already has an entry in the map
-          msaGraph.at(send_actor).push_back(succBS);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(succBS);
         }else{      //no entry for send_actor yet
           vector<SuccessorNode> succBSv;
           succBSv.push_back(succBS);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, succBSv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, succBSv));
         }
       }
 
@@ -284,44 +465,44 @@ void ThroughputMCR::constructMSAG() {
       dstCh.recOrder = receivingNext[i].min();
 
       //add to boost-msag
-      src = b::vertex(send_actor, b_msag);
-      dst = b::vertex(rec_actor, b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, receivingTime[i].min());
-      b::put(b::edge_weight2, b_msag, _e, tok[i]);
+      src = b::vertex(send_actor, w.b_msag);
+      dst = b::vertex(rec_actor, w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_RECTIME, i);
+      b::put(b::edge_weight2, w.b_msag, _e, tok[i]);
       //delay-weight for self-loop on rec-actor:
-      tie(_e, found) = edge(dst, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, receivingTime[i].min());
+      tie(_e, found) = edge(dst, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_RECTIME, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(send_actor).push_back(dstCh);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(dstCh);
         }else{      //no entry for i yet
           vector<SuccessorNode> dstChv;
           dstChv.push_back(dstCh);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, dstChv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, dstChv));
         }
       }
 
       //save the receiving actors for each actor (for next order)
-      if(receivingActors[ch_dst[i]] == -1){ //first rec_actor for the dst
-        receivingActors[ch_dst[i]] = rec_actor;
+      if(w.receivingActors[ch_dst[i]] == -1){ //first rec_actor for the dst
+        w.receivingActors[ch_dst[i]] = rec_actor;
       }else{
-        int curRec_actor_ch = channelMapping[receivingActors[ch_dst[i]] - n_actors];
+        int curRec_actor_ch = w.channelMapping[w.receivingActors[ch_dst[i]] - n_actors];
         if(receivingNext[curRec_actor_ch].assigned()){
           if(receivingNext[curRec_actor_ch].val() < n_channels){
             if(ch_dst[receivingNext[curRec_actor_ch].val()] != ch_dst[i]){ //last rec_actor for this dst
-              receivingActors[ch_dst[i]] = rec_actor;
+              w.receivingActors[ch_dst[i]] = rec_actor;
             } //else
           }else{ //last rec_actor for this dst
-            receivingActors[ch_dst[i]] = rec_actor;
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
-        if(receivingNext[channelMapping[rec_actor - n_actors]].assigned()){
-          if(receivingNext[channelMapping[rec_actor - n_actors]].val() == receivingActors[ch_dst[i]]){
-            receivingActors[ch_dst[i]] = rec_actor;
+        if(receivingNext[w.channelMapping[rec_actor - n_actors]].assigned()){
+          if(receivingNext[w.channelMapping[rec_actor - n_actors]].val() == w.receivingActors[ch_dst[i]]){
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
       }
@@ -335,21 +516,21 @@ void ThroughputMCR::constructMSAG() {
       succRec.channel = i;
 
       //add to boost-msag
-      src = b::vertex(rec_actor, b_msag);
-      dst = b::vertex(send_actor, b_msag);
-      b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-      b::put(b::edge_weight, b_msag, _e, sendingTime[i].min());
-      b::put(b::edge_weight2, b_msag, _e, recbufferSz[i].max() - tok[i]);
+      src = b::vertex(rec_actor, w.b_msag);
+      dst = b::vertex(send_actor, w.b_msag);
+      b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+      putWeight(w.b_msag, _e, SRC_SENDTIME, i);
+      putTokens(w.b_msag, _e, SRC_RECBUF, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(rec_actor);
-        if(it != msaGraph.end()){ //i already has an entry in the map
-          msaGraph.at(rec_actor).push_back(succRec);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(rec_actor);
+        if(it != w.msaGraph.end()){ //i already has an entry in the map
+          w.msaGraph.at(rec_actor).push_back(succRec);
         }else{ //no entry for i yet
           vector<SuccessorNode> succRecv;
           succRecv.push_back(succRec);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(rec_actor, succRecv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(rec_actor, succRecv));
         }
       }
 
@@ -365,45 +546,45 @@ void ThroughputMCR::constructMSAG() {
         _dst.channel = i;
 
         //add to boost-msag
-        src = b::vertex(ch_src[i], b_msag);
-        dst = b::vertex(ch_dst[i], b_msag);
-        b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-        b::put(b::edge_weight, b_msag, _e, wcet[ch_dst[i]].min());
-        b::put(b::edge_weight2, b_msag, _e, tok[i]);
+        src = b::vertex(ch_src[i], w.b_msag);
+        dst = b::vertex(ch_dst[i], w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_WCET, ch_dst[i]);
+        b::put(b::edge_weight2, w.b_msag, _e, tok[i]);
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-          if(it != msaGraph.end()){ //i already has an entry in the map
-            msaGraph.at(ch_src[i]).push_back(_dst);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+          if(it != w.msaGraph.end()){ //i already has an entry in the map
+            w.msaGraph.at(ch_src[i]).push_back(_dst);
           }else{ //no entry for i yet
             vector<SuccessorNode> dstv;
             dstv.push_back(_dst);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], dstv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], dstv));
           }
         }
       }
     }
   }
   /*
-   for(unsigned int i=0; i<receivingActors.size(); i++){
-   cout << receivingActors[i] << " ";
+   for(unsigned int i=0; i<w.receivingActors.size(); i++){
+   cout << w.receivingActors[i] << " ";
    }
    cout << endl;*/
 
   /*
-   cout << "channelMapping.size() = " << channelMapping.size() << endl;
-   for(unsigned int i=0; i<channelMapping.size(); i+=3){
-   cout << channelMapping[i] << " ";
+   cout << "w.channelMapping.size() = " << w.channelMapping.size() << endl;
+   for(unsigned int i=0; i<w.channelMapping.size(); i+=3){
+   cout << w.channelMapping[i] << " ";
    }
    cout << endl;*/
 
   //put sendNext relations into the MSAG
-  for(unsigned int i = 1; i < channelMapping.size(); i += 3){ //for all sending actors
+  for(unsigned int i = 1; i < w.channelMapping.size(); i += 3){ //for all sending actors
     bool continues = true;
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     int tokens = 0; //is channel to add a cycle-closing back-edge?
     while(!nextFound && continues){
       if(sendingNext[x].assigned()){
@@ -440,7 +621,7 @@ void ThroughputMCR::constructMSAG() {
     }
     if(nextFound){
       //add send_actor of channel i -> block_actor of nextCh
-      if(channelMapping[i] != nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
+      if(w.channelMapping[i] != nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
         int block_actor = getBlockActor(nextCh);
 
         //cout << "Next channel (send_actor of channel " << i << "): " << nextCh << endl;
@@ -453,21 +634,21 @@ void ThroughputMCR::constructMSAG() {
         succBS.channel = nextCh;
 
         //add to boost-msag
-        src = b::vertex(i + n_actors, b_msag);
-        dst = b::vertex(block_actor, b_msag);
-        b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-        b::put(b::edge_weight, b_msag, _e, sendingLatency[nextCh].min());
-        b::put(b::edge_weight2, b_msag, _e, tokens);
+        src = b::vertex(i + n_actors, w.b_msag);
+        dst = b::vertex(block_actor, w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_SENDLAT, nextCh);
+        b::put(b::edge_weight2, w.b_msag, _e, tokens);
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i + n_actors);
-          if(it != msaGraph.end()){ //send actor already has an entry in the map
-            msaGraph.at(i + n_actors).push_back(succBS);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i + n_actors);
+          if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+            w.msaGraph.at(i + n_actors).push_back(succBS);
           }else{ //no entry for send_actor i yet
             vector<SuccessorNode> succBSv;
             succBSv.push_back(succBS);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succBSv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succBSv));
           }
         }
       }
@@ -475,10 +656,10 @@ void ThroughputMCR::constructMSAG() {
   }
 
   //put recNext relations into the MSAG
-  for(unsigned int i = 2; i < channelMapping.size(); i += 3){ //for all receiving actors
+  for(unsigned int i = 2; i < w.channelMapping.size(); i += 3){ //for all receiving actors
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
 
     //cout << "looking for recNext, channel " << i << endl;
 
@@ -486,11 +667,11 @@ void ThroughputMCR::constructMSAG() {
       if(receivingNext[x].assigned()){
         nextCh = receivingNext[x].val();
         if(nextCh >= n_channels){ //end of chain found
-          nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
           nextFound = true;
         }else{ //not end of chain (nextCh < n_channels)
-          if(ch_dst[nextCh] != ch_dst[channelMapping[i]]){ //next rec actor belongs to other dst
-            nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          if(ch_dst[nextCh] != ch_dst[w.channelMapping[i]]){ //next rec actor belongs to other dst
+            nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
             nextFound = true;
           }else{ //same dst
             if(sendingTime[nextCh].min() > 0){
@@ -501,7 +682,7 @@ void ThroughputMCR::constructMSAG() {
           }
         }
       }else{
-        nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+        nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
         nextFound = true;
       }
     }
@@ -509,8 +690,8 @@ void ThroughputMCR::constructMSAG() {
     //cout << "  found " << nextCh;
 
     SuccessorNode succRec;
-    succRec.successor_key = nextCh == -1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh);
-    succRec.delay = nextCh == -1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min();
+    succRec.successor_key = nextCh == -1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh);
+    succRec.delay = nextCh == -1 ? wcet[ch_dst[w.channelMapping[i]]].min() : receivingTime[nextCh].min();
     succRec.min_tok = 0;
     succRec.max_tok = 0;
     if(nextCh != -1)
@@ -519,21 +700,25 @@ void ThroughputMCR::constructMSAG() {
     //cout << " ( "<< succRec.successor_key <<")" << endl;
 
     //add to boost-msag
-    src = b::vertex(i + n_actors, b_msag);
-    dst = b::vertex(nextCh == -1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh), b_msag);
-    b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-    b::put(b::edge_weight, b_msag, _e, nextCh == -1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min());
-    b::put(b::edge_weight2, b_msag, _e, 0);
+    src = b::vertex(i + n_actors, w.b_msag);
+    dst = b::vertex(nextCh == -1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh), w.b_msag);
+    b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+    if(nextCh == -1){
+      putWeight(w.b_msag, _e, SRC_WCET, ch_dst[w.channelMapping[i]]);
+    }else{
+      putWeight(w.b_msag, _e, SRC_RECTIME, nextCh);
+    }
+    b::put(b::edge_weight2, w.b_msag, _e, 0);
 
     n_msagChannels++;
     if(printDebug){
-      unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i + n_actors);
-      if(it != msaGraph.end()){ //send actor already has an entry in the map
-        msaGraph.at(i + n_actors).push_back(succRec);
+      unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i + n_actors);
+      if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+        w.msaGraph.at(i + n_actors).push_back(succRec);
       }else{ //no entry for send_actor i yet
         vector<SuccessorNode> succRecv;
         succRecv.push_back(succRec);
-        msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succRecv));
+        w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succRecv));
       }
     }
   }
@@ -545,7 +730,7 @@ void ThroughputMCR::constructMSAG() {
 
       //check whether nextActor has preceding rec_actor
       SuccessorNode nextA;
-      if(receivingActors[nextActor] == -1){
+      if(w.receivingActors[nextActor] == -1){
         //add edge i -> nextActor
         nextA.successor_key = nextActor;
         nextA.delay = wcet[nextActor].min();
@@ -553,36 +738,36 @@ void ThroughputMCR::constructMSAG() {
         nextA.max_tok = 0;
 
         //add to boost-msag
-        src = b::vertex(i, b_msag);
-        dst = b::vertex(nextActor, b_msag);
-        b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-        b::put(b::edge_weight, b_msag, _e, wcet[nextActor].min());
-        b::put(b::edge_weight2, b_msag, _e, 0);
+        src = b::vertex(i, w.b_msag);
+        dst = b::vertex(nextActor, w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_WCET, nextActor);
+        b::put(b::edge_weight2, w.b_msag, _e, 0);
       }else{
         //add edge i -> receivingActor[nextActor]
-        nextA.successor_key = receivingActors[nextActor];
-        nextA.delay = receivingTime[channelMapping[receivingActors[nextActor] - n_actors]].min();
+        nextA.successor_key = w.receivingActors[nextActor];
+        nextA.delay = receivingTime[w.channelMapping[w.receivingActors[nextActor] - n_actors]].min();
         nextA.min_tok = 0;
         nextA.max_tok = 0;
-        nextA.channel = channelMapping[receivingActors[nextActor] - n_actors];
+        nextA.channel = w.channelMapping[w.receivingActors[nextActor] - n_actors];
 
         //add to boost-msag
-        src = b::vertex(i, b_msag);
-        dst = b::vertex(receivingActors[nextActor], b_msag);
-        b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-        b::put(b::edge_weight, b_msag, _e, receivingTime[channelMapping[receivingActors[nextActor] - n_actors]].min());
-        b::put(b::edge_weight2, b_msag, _e, 0);
+        src = b::vertex(i, w.b_msag);
+        dst = b::vertex(w.receivingActors[nextActor], w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[nextActor] - n_actors]);
+        b::put(b::edge_weight2, w.b_msag, _e, 0);
       }
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-        if(it != msaGraph.end()){ //i already has an entry in the map
-          msaGraph.at(i).push_back(nextA);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+        if(it != w.msaGraph.end()){ //i already has an entry in the map
+          w.msaGraph.at(i).push_back(nextA);
         }else{ //no entry for i yet
           vector<SuccessorNode> nextAv;
           nextAv.push_back(nextA);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(i, nextAv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i, nextAv));
         }
       }
 
@@ -599,7 +784,7 @@ void ThroughputMCR::constructMSAG() {
 
         //check whether firstActor has preceding rec_actor
         SuccessorNode first;
-        if(receivingActors[firstActor] == -1){
+        if(w.receivingActors[firstActor] == -1){
           //add edge i -> firstActor
           first.successor_key = firstActor;
           first.delay = wcet[firstActor].min();
@@ -607,42 +792,65 @@ void ThroughputMCR::constructMSAG() {
           first.max_tok = 1;
 
           //add to boost-msag
-          src = b::vertex(i, b_msag);
-          dst = b::vertex(firstActor, b_msag);
-          b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-          b::put(b::edge_weight, b_msag, _e, wcet[firstActor].min());
-          b::put(b::edge_weight2, b_msag, _e, 1);
+          src = b::vertex(i, w.b_msag);
+          dst = b::vertex(firstActor, w.b_msag);
+          b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+          putWeight(w.b_msag, _e, SRC_WCET, firstActor);
+          b::put(b::edge_weight2, w.b_msag, _e, 1);
         }else{
           //add edge i -> receivingActor[firstActor]
-          first.successor_key = receivingActors[firstActor];
-          first.delay = receivingTime[channelMapping[receivingActors[firstActor] - n_actors]].min();
+          first.successor_key = w.receivingActors[firstActor];
+          first.delay = receivingTime[w.channelMapping[w.receivingActors[firstActor] - n_actors]].min();
           first.min_tok = 1;
           first.max_tok = 1;
-          first.channel = channelMapping[receivingActors[firstActor] - n_actors];
+          first.channel = w.channelMapping[w.receivingActors[firstActor] - n_actors];
 
           //add to boost-msag
-          src = b::vertex(i, b_msag);
-          dst = b::vertex(receivingActors[firstActor], b_msag);
-          b::tie(_e, found) = b::add_edge(src, dst, b_msag);
-          b::put(b::edge_weight, b_msag, _e, receivingTime[channelMapping[receivingActors[firstActor] - n_actors]].min());
-          b::put(b::edge_weight2, b_msag, _e, 1);
+          src = b::vertex(i, w.b_msag);
+          dst = b::vertex(w.receivingActors[firstActor], w.b_msag);
+          b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+          putWeight(w.b_msag, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[firstActor] - n_actors]);
+          b::put(b::edge_weight2, w.b_msag, _e, 1);
         }
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-          if(it != msaGraph.end()){ //i already has an entry in the map
-            msaGraph.at(i).push_back(first);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+          if(it != w.msaGraph.end()){ //i already has an entry in the map
+            w.msaGraph.at(i).push_back(first);
           }else{    //no entry for i yet
             vector<SuccessorNode> firstv;
             firstv.push_back(first);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(i, firstv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i, firstv));
           }
         }
       }
     }
   }
 
+  //Step 4 (bounding mode): close each open chain of decided next values with a
+  //1-token edge back to its head. Any completion of the schedule connects tail and head
+  //by a path with exactly one token (the proc cycle) and at least this delay, so the
+  //MCR stays a lower bound on the period
+  if(partialBound){
+    for(auto& seg : openSegments()){
+      int tail = seg.first;
+      int head = seg.second;
+      src = b::vertex(tail, w.b_msag);
+      if(w.receivingActors[head] == -1){
+        dst = b::vertex(head, w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_WCET, head);
+      }else{
+        dst = b::vertex(w.receivingActors[head], w.b_msag);
+        b::tie(_e, found) = b::add_edge(src, dst, w.b_msag);
+        putWeight(w.b_msag, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[head] - n_actors]);
+      }
+      b::put(b::edge_weight2, w.b_msag, _e, 1);
+      n_msagChannels++;
+    }
+  }
+
   if(printDebug){
     //printThroughputGraphAsDot(".");
   }
@@ -666,14 +874,15 @@ struct G {
 };
 
 void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
+  Workspace& w = workspace();
 
   if(printDebug)
     cout << "\tThroughputMCR::constructMSAG(vector<int> &msagMap)" << endl;
 
-  msaGraph.clear();
-  receivingActors.clear();
-  channelMapping.clear();
-  receivingActors.insert(receivingActors.begin(), n_actors, -1); //pre-fill with -1
+  w.msaGraph.clear();
+  w.receivingActors.clear();
+  w.channelMapping.clear();
+  w.receivingActors.insert(w.receivingActors.begin(), n_actors, -1); //pre-fill with -1
   //to identify for each msag-actor, which msag it belongs to
   vector<int> msagId;
 
@@ -683,9 +892,9 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
     if(sendingTime[i].min() > 0){ //=> channel on interconnect
       n_msagActors += 3; //one blocking, one sending and one receiving actor
       //store mapping between block/send/rec_actor and channel i
-      channelMapping.push_back(i); //[block_actor] = i;
-      channelMapping.push_back(i); //[send_actor] = i;
-      channelMapping.push_back(i); //[rec_actor] = i;
+      w.channelMapping.push_back(i); //[block_actor] = i;
+      w.channelMapping.push_back(i); //[send_actor] = i;
+      w.channelMapping.push_back(i); //[rec_actor] = i;
     }
   }
 
@@ -700,7 +909,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
   //add all actors as vertices, and self-loops
   bool found;
   for(int n = 0; n < n_msagActors; n++){
-    boost_msag& curr_graph = *b_msags[msagId[n]];
+    boost_msag& curr_graph = *w.b_msags[msagId[n]];
 
     src = add_vertex(curr_graph);
     b::put(vertex_actorid, curr_graph, src, n);
@@ -708,7 +917,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
     //add self-edges
     tie(_e, found) = add_edge(src, src, curr_graph);
     if(n < n_actors){
-      b::put(b::edge_weight, curr_graph, _e, wcet[n].min());
+      putWeight(curr_graph, _e, SRC_WCET, n);
     } //else{}: delay for communication actors are added further down
     b::put(b::edge_weight2, curr_graph, _e, 1);
   }
@@ -738,26 +947,26 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       succB.channel = i;
 
       //add to boost-msag
-      boost_msag& curr_graph = *b_msags[msagId[ch_src[i]]];
-      src = g.getVertex(ch_src[i]);    //b::vertex(ch_src[i], *b_msags[msagId[ch_src[i]]]);
-      dst = g.getVertex(block_actor);  //b::vertex(block_actor, *b_msags[msagId[ch_src[i]]]);
+      boost_msag& curr_graph = *w.b_msags[msagId[ch_src[i]]];
+      src = g.getVertex(ch_src[i]);    //b::vertex(ch_src[i], *w.b_msags[msagId[ch_src[i]]]);
+      dst = g.getVertex(block_actor);  //b::vertex(block_actor, *w.b_msags[msagId[ch_src[i]]]);
       b::tie(_e, found) = b::add_edge(src, dst, curr_graph);
-      b::put(b::edge_weight, curr_graph, _e, sendingLatency[i].min());
+      putWeight(curr_graph, _e, SRC_SENDLAT, i);
       b::put(b::edge_weight2, curr_graph, _e, 0);
       //delay-weight for self-loop on block-actor:
-      curr_graph = *b_msags[msagId[block_actor]];
+      curr_graph = *w.b_msags[msagId[block_actor]];
       tie(_e, found) = edge(dst, dst, curr_graph);
-      b::put(b::edge_weight, curr_graph, _e, sendingLatency[i].min());
+      putWeight(curr_graph, _e, SRC_SENDLAT, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(ch_src[i]).push_back(succB);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(ch_src[i]).push_back(succB);
         }else{      //no entry for ch_src[i] yet
           vector<SuccessorNode> succBv;
           succBv.push_back(succB);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], succBv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], succBv));
         }
       }
 
@@ -769,22 +978,22 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       srcCh.max_tok = sendbufferSz[i].max();
 
       //add to boost-msag
-      boost_msag& curr_graph1 = *b_msags[msagId[block_actor]];
-      src = g.getVertex(block_actor);  //b::vertex(block_actor, *b_msags[msagId[block_actor]]);
-      dst = g.getVertex(ch_src[i]);    //b::vertex(ch_src[i], *b_msags[msagId[block_actor]]);
-      b::tie(_e, found) = b::add_edge(src, dst, *b_msags[msagId[block_actor]]);
-      b::put(b::edge_weight, curr_graph1, _e, wcet[ch_src[i]].min());
-      b::put(b::edge_weight2, curr_graph1, _e, sendbufferSz[i].max());
+      boost_msag& curr_graph1 = *w.b_msags[msagId[block_actor]];
+      src = g.getVertex(block_actor);  //b::vertex(block_actor, *w.b_msags[msagId[block_actor]]);
+      dst = g.getVertex(ch_src[i]);    //b::vertex(ch_src[i], *w.b_msags[msagId[block_actor]]);
+      b::tie(_e, found) = b::add_edge(src, dst, *w.b_msags[msagId[block_actor]]);
+      putWeight(curr_graph1, _e, SRC_WCET, ch_src[i]);
+      putTokens(curr_graph1, _e, SRC_SENDBUF, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(block_actor).push_back(srcCh);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(srcCh);
         }else{      //no entry for block_actor yet
           vector<SuccessorNode> srcChv;
           srcChv.push_back(srcCh);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, srcChv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, srcChv));
         }
       }
 //###
@@ -797,25 +1006,25 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       succS.channel = i;
 
       //add to boost-msag
-      boost_msag& curr_graph2 = *b_msags[msagId[block_actor]];
-      src = g.getVertex(block_actor);  //b::vertex(block_actor, *b_msags[msagId[block_actor]]);
-      dst = g.getVertex(send_actor);   //b::vertex(send_actor, *b_msags[msagId[block_actor]]);
+      boost_msag& curr_graph2 = *w.b_msags[msagId[block_actor]];
+      src = g.getVertex(block_actor);  //b::vertex(block_actor, *w.b_msags[msagId[block_actor]]);
+      dst = g.getVertex(send_actor);   //b::vertex(send_actor, *w.b_msags[msagId[block_actor]]);
       b::tie(_e, found) = b::add_edge(src, dst, curr_graph2);
-      b::put(b::edge_weight, curr_graph2, _e, sendingTime[i].min());
+      putWeight(curr_graph2, _e, SRC_SENDTIME, i);
       b::put(b::edge_weight2, curr_graph2, _e, 0);
       //delay-weight for self-loop on send-actor:
       tie(_e, found) = edge(dst, dst, curr_graph2);
-      b::put(b::edge_weight, curr_graph2, _e, sendingTime[i].min());
+      putWeight(curr_graph2, _e, SRC_SENDTIME, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(block_actor).push_back(succS);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(succS);
         }else{      //no entry for block_actor yet
           vector<SuccessorNode> succSv;
           succSv.push_back(succS);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, succSv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(block_actor, succSv));
         }
       }
 
@@ -828,22 +1037,22 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       succBS.channel = i;
 
       //add to boost-msag
-      boost_msag& curr_graph3 = *b_msags[msagId[send_actor]];
-      src = g.getVertex(send_actor);   //b::vertex(send_actor, *b_msags[msagId[send_actor]]);
-      dst = g.getVertex(block_actor);  //b::vertex(block_actor, *b_msags[msagId[send_actor]]);
-      b::tie(_e, found) = b::add_edge(src, dst, *b_msags[msagId[send_actor]]);
-      b::put(b::edge_weight, curr_graph3, _e, sendingLatency[i].min());
+      boost_msag& curr_graph3 = *w.b_msags[msagId[send_actor]];
+      src = g.getVertex(send_actor);   //b::vertex(send_actor, *w.b_msags[msagId[send_actor]]);
+      dst = g.getVertex(block_actor);  //b::vertex(block_actor, *w.b_msags[msagId[send_actor]]);
+      b::tie(_e, found) = b::add_edge(src, dst, *w.b_msags[msagId[send_actor]]);
+      putWeight(curr_graph3, _e, SRC_SENDLAT, i);
       b::put(b::edge_weight2, curr_graph3, _e, 1);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){ //send actor already has an entry in the map
-          msaGraph.at(send_actor).push_back(succBS);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(succBS);
         }else{      //no entry for send_actor yet
           vector<SuccessorNode> succBSv;
           succBSv.push_back(succBS);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, succBSv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, succBSv));
         }
       }
 
@@ -857,45 +1066,45 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       dstCh.recOrder = receivingNext[i].min();
 
       //add to boost-msag
-      boost_msag& curr_graph4 = *b_msags[msagId[send_actor]];
-      src = g.getVertex(send_actor);   //b::vertex(send_actor, *b_msags[msagId[send_actor]]);
-      dst = g.getVertex(rec_actor);    //b::vertex(rec_actor, *b_msags[msagId[send_actor]]);
+      boost_msag& curr_graph4 = *w.b_msags[msagId[send_actor]];
+      src = g.getVertex(send_actor);   //b::vertex(send_actor, *w.b_msags[msagId[send_actor]]);
+      dst = g.getVertex(rec_actor);    //b::vertex(rec_actor, *w.b_msags[msagId[send_actor]]);
       b::tie(_e, found) = b::add_edge(src, dst, curr_graph4);
-      b::put(b::edge_weight, curr_graph4, _e, receivingTime[i].min());
+      putWeight(curr_graph4, _e, SRC_RECTIME, i);
       b::put(b::edge_weight2, curr_graph4, _e, tok[i]);
       //delay-weight for self-loop on rec-actor:
       tie(_e, found) = edge(dst, dst, curr_graph4);
-      b::put(b::edge_weight, curr_graph4, _e, receivingTime[i].min());
+      putWeight(curr_graph4, _e, SRC_RECTIME, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){    //i already has an entry in the map
-          msaGraph.at(send_actor).push_back(dstCh);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){    //i already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(dstCh);
         }else{      //no entry for i yet
           vector<SuccessorNode> dstChv;
           dstChv.push_back(dstCh);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, dstChv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(send_actor, dstChv));
         }
       }
 
       //save the receiving actors for each actor (for next order)
-      if(receivingActors[ch_dst[i]] == -1){ //first rec_actor for the dst
-        receivingActors[ch_dst[i]] = rec_actor;
+      if(w.receivingActors[ch_dst[i]] == -1){ //first rec_actor for the dst
+        w.receivingActors[ch_dst[i]] = rec_actor;
       }else{
-        int curRec_actor_ch = channelMapping[receivingActors[ch_dst[i]] - n_actors];
+        int curRec_actor_ch = w.channelMapping[w.receivingActors[ch_dst[i]] - n_actors];
         if(receivingNext[curRec_actor_ch].assigned()){
           if(receivingNext[curRec_actor_ch].val() < n_channels){
             if(ch_dst[receivingNext[curRec_actor_ch].val()] != ch_dst[i]){ //last rec_actor for this dst
-              receivingActors[ch_dst[i]] = rec_actor;
+              w.receivingActors[ch_dst[i]] = rec_actor;
             } //else
           }else{ //last rec_actor for this dst
-            receivingActors[ch_dst[i]] = rec_actor;
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
-        if(receivingNext[channelMapping[rec_actor - n_actors]].assigned()){
-          if(receivingNext[channelMapping[rec_actor - n_actors]].val() == receivingActors[ch_dst[i]]){
-            receivingActors[ch_dst[i]] = rec_actor;
+        if(receivingNext[w.channelMapping[rec_actor - n_actors]].assigned()){
+          if(receivingNext[w.channelMapping[rec_actor - n_actors]].val() == w.receivingActors[ch_dst[i]]){
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
       }
@@ -909,22 +1118,22 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       succRec.channel = i;
 
       //add to boost-msag
-      boost_msag& curr_graph5 = *b_msags[msagId[rec_actor]];
-      src = g.getVertex(rec_actor);   //b::vertex(rec_actor, *b_msags[msagId[rec_actor]]);
-      dst = g.getVertex(send_actor);   //b::vertex(send_actor, *b_msags[msagId[rec_actor]]);
+      boost_msag& curr_graph5 = *w.b_msags[msagId[rec_actor]];
+      src = g.getVertex(rec_actor);   //b::vertex(rec_actor, *w.b_msags[msagId[rec_actor]]);
+      dst = g.getVertex(send_actor);   //b::vertex(send_actor, *w.b_msags[msagId[rec_actor]]);
       b::tie(_e, found) = b::add_edge(src, dst, curr_graph5);
-      b::put(b::edge_weight, curr_graph5, _e, sendingTime[i].min());
-      b::put(b::edge_weight2, curr_graph5, _e, recbufferSz[i].max() - tok[i]);
+      putWeight(curr_graph5, _e, SRC_SENDTIME, i);
+      putTokens(curr_graph5, _e, SRC_RECBUF, i);
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(rec_actor);
-        if(it != msaGraph.end()){ //i already has an entry in the map
-          msaGraph.at(rec_actor).push_back(succRec);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(rec_actor);
+        if(it != w.msaGraph.end()){ //i already has an entry in the map
+          w.msaGraph.at(rec_actor).push_back(succRec);
         }else{ //no entry for i yet
           vector<SuccessorNode> succRecv;
           succRecv.push_back(succRec);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(rec_actor, succRecv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(rec_actor, succRecv));
         }
       }
 
@@ -940,46 +1149,46 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
         _dst.channel = i;
 
         //add to boost-msag
-        boost_msag& curr_graph5 = *b_msags[msagId[ch_src[i]]];
-        src = g.getVertex(ch_src[i]);   //b::vertex(ch_src[i], *b_msags[msagId[ch_src[i]]]);
-        dst = g.getVertex(ch_dst[i]);   //b::vertex(ch_dst[i], *b_msags[msagId[ch_src[i]]]);
+        boost_msag& curr_graph5 = *w.b_msags[msagId[ch_src[i]]];
+        src = g.getVertex(ch_src[i]);   //b::vertex(ch_src[i], *w.b_msags[msagId[ch_src[i]]]);
+        dst = g.getVertex(ch_dst[i]);   //b::vertex(ch_dst[i], *w.b_msags[msagId[ch_src[i]]]);
         b::tie(_e, found) = b::add_edge(src, dst, curr_graph5);
-        b::put(b::edge_weight, curr_graph5, _e, wcet[ch_dst[i]].min());
+        putWeight(curr_graph5, _e, SRC_WCET, ch_dst[i]);
         b::put(b::edge_weight2, curr_graph5, _e, tok[i]);
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-          if(it != msaGraph.end()){ //i already has an entry in the map
-            msaGraph.at(ch_src[i]).push_back(_dst);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+          if(it != w.msaGraph.end()){ //i already has an entry in the map
+            w.msaGraph.at(ch_src[i]).push_back(_dst);
           }else{ //no entry for i yet
             vector<SuccessorNode> dstv;
             dstv.push_back(_dst);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], dstv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(ch_src[i], dstv));
           }
         }
       }
     }
   }
   /*
-   for(unsigned int i=0; i<receivingActors.size(); i++){
-   cout << receivingActors[i] << " ";
+   for(unsigned int i=0; i<w.receivingActors.size(); i++){
+   cout << w.receivingActors[i] << " ";
    }
    cout << endl;*/
 
   /*
-   cout << "channelMapping.size() = " << channelMapping.size() << endl;
-   for(unsigned int i=0; i<channelMapping.size(); i+=3){
-   cout << channelMapping[i] << " ";
+   cout << "w.channelMapping.size() = " << w.channelMapping.size() << endl;
+   for(unsigned int i=0; i<w.channelMapping.size(); i+=3){
+   cout << w.channelMapping[i] << " ";
    }
    cout << endl;*/
 
   //put sendNext relations into the MSAG
-  for(unsigned int i = 1; i < channelMapping.size(); i += 3){ //for all sending actors
+  for(unsigned int i = 1; i < w.channelMapping.size(); i += 3){ //for all sending actors
     bool continues = true;
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     int tokens = 0; //is channel to add a cycle-closing back-edge?
     while(!nextFound && continues){
       if(sendingNext[x].assigned()){
@@ -1016,7 +1225,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
     }
     if(nextFound){
       //add send_actor of channel i -> block_actor of nextCh
-      if(channelMapping[i] != nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
+      if(w.channelMapping[i] != nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
         int block_actor = getBlockActor(nextCh);
 
         //cout << "Next channel (send_actor of channel " << i << "): " << nextCh << endl;
@@ -1029,22 +1238,22 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
         succBS.channel = nextCh;
 
         //add to boost-msag
-        boost_msag& curr_graph6 = *b_msags[msagId[block_actor]];
-        src = g.getVertex(i + n_actors);   //b::vertex(i + n_actors, *b_msags[msagId[block_actor]]);
-        dst = g.getVertex(block_actor);    //b::vertex(block_actor, *b_msags[msagId[block_actor]]);
+        boost_msag& curr_graph6 = *w.b_msags[msagId[block_actor]];
+        src = g.getVertex(i + n_actors);   //b::vertex(i + n_actors, *w.b_msags[msagId[block_actor]]);
+        dst = g.getVertex(block_actor);    //b::vertex(block_actor, *w.b_msags[msagId[block_actor]]);
         b::tie(_e, found) = b::add_edge(src, dst, curr_graph6);
-        b::put(b::edge_weight, curr_graph6, _e, sendingLatency[nextCh].min());
+        putWeight(curr_graph6, _e, SRC_SENDLAT, nextCh);
         b::put(b::edge_weight2, curr_graph6, _e, tokens);
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i + n_actors);
-          if(it != msaGraph.end()){ //send actor already has an entry in the map
-            msaGraph.at(i + n_actors).push_back(succBS);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i + n_actors);
+          if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+            w.msaGraph.at(i + n_actors).push_back(succBS);
           }else{ //no entry for send_actor i yet
             vector<SuccessorNode> succBSv;
             succBSv.push_back(succBS);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succBSv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succBSv));
           }
         }
       }
@@ -1052,10 +1261,10 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
   }
 
   //put recNext relations into the MSAG
-  for(unsigned int i = 2; i < channelMapping.size(); i += 3){ //for all receiving actors
+  for(unsigned int i = 2; i < w.channelMapping.size(); i += 3){ //for all receiving actors
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
 
     //cout << "looking for recNext, channel " << i << endl;
 
@@ -1063,11 +1272,11 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
       if(receivingNext[x].assigned()){
         nextCh = receivingNext[x].val();
         if(nextCh >= n_channels){ //end of chain found
-          nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
           nextFound = true;
         }else{ //not end of chain (nextCh < n_channels)
-          if(ch_dst[nextCh] != ch_dst[channelMapping[i]]){ //next rec actor belongs to other dst
-            nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          if(ch_dst[nextCh] != ch_dst[w.channelMapping[i]]){ //next rec actor belongs to other dst
+            nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
             nextFound = true;
           }else{ //same dst
             if(sendingTime[nextCh].min() > 0){
@@ -1078,7 +1287,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
           }
         }
       }else{
-        nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+        nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
         nextFound = true;
       }
     }
@@ -1086,8 +1295,8 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
     //cout << "  found " << nextCh;
 
     SuccessorNode succRec;
-    succRec.successor_key = nextCh == -1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh);
-    succRec.delay = nextCh == -1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min();
+    succRec.successor_key = nextCh == -1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh);
+    succRec.delay = nextCh == -1 ? wcet[ch_dst[w.channelMapping[i]]].min() : receivingTime[nextCh].min();
     succRec.min_tok = 0;
     succRec.max_tok = 0;
     if(nextCh != -1)
@@ -1097,22 +1306,26 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
 
     //add to boost-msag
     int tmp = i + n_actors;
-    boost_msag& curr_graph7 = *b_msags[msagId[tmp]];
-    src = g.getVertex(tmp);            //b::vertex(tmp, *b_msags[msagId[tmp]]);
-    dst = g.getVertex(nextCh == -1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh)); //b::vertex(nextCh == -1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh),*b_msags[msagId[tmp]]);
+    boost_msag& curr_graph7 = *w.b_msags[msagId[tmp]];
+    src = g.getVertex(tmp);            //b::vertex(tmp, *w.b_msags[msagId[tmp]]);
+    dst = g.getVertex(nextCh == -1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh)); //b::vertex(nextCh == -1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh),*w.b_msags[msagId[tmp]]);
     b::tie(_e, found) = b::add_edge(src, dst, curr_graph7);
-    b::put(b::edge_weight, curr_graph7, _e, nextCh == -1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min());
+    if(nextCh == -1){
+      putWeight(curr_graph7, _e, SRC_WCET, ch_dst[w.channelMapping[i]]);
+    }else{
+      putWeight(curr_graph7, _e, SRC_RECTIME, nextCh);
+    }
     b::put(b::edge_weight2, curr_graph7, _e, 0);
 
     n_msagChannels++;
     if(printDebug){
-      unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i + n_actors);
-      if(it != msaGraph.end()){ //send actor already has an entry in the map
-        msaGraph.at(i + n_actors).push_back(succRec);
+      unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i + n_actors);
+      if(it != w.msaGraph.end()){ //send actor already has an entry in the map
+        w.msaGraph.at(i + n_actors).push_back(succRec);
       }else{ //no entry for send_actor i yet
         vector<SuccessorNode> succRecv;
         succRecv.push_back(succRec);
-        msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succRecv));
+        w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i + n_actors, succRecv));
       }
     }
   }
@@ -1124,7 +1337,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
 
       //check whether nextActor has preceding rec_actor
       SuccessorNode nextA;
-      if(receivingActors[nextActor] == -1){
+      if(w.receivingActors[nextActor] == -1){
         //add edge i -> nextActor
         nextA.successor_key = nextActor;
         nextA.delay = wcet[nextActor].min();
@@ -1132,38 +1345,38 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
         nextA.max_tok = 0;
 
         //add to boost-msag
-        boost_msag& curr_graph8 = *b_msags[msagId[i]];
-        src = g.getVertex(i);         //b::vertex(i, *b_msags[msagId[i]]);
-        dst = g.getVertex(nextActor); //b::vertex(nextActor, *b_msags[msagId[i]]);
+        boost_msag& curr_graph8 = *w.b_msags[msagId[i]];
+        src = g.getVertex(i);         //b::vertex(i, *w.b_msags[msagId[i]]);
+        dst = g.getVertex(nextActor); //b::vertex(nextActor, *w.b_msags[msagId[i]]);
         b::tie(_e, found) = b::add_edge(src, dst, curr_graph8);
-        b::put(b::edge_weight, curr_graph8, _e, wcet[nextActor].min());
+        putWeight(curr_graph8, _e, SRC_WCET, nextActor);
         b::put(b::edge_weight2, curr_graph8, _e, 0);
       }else{
         //add edge i -> receivingActor[nextActor]
-        nextA.successor_key = receivingActors[nextActor];
-        nextA.delay = receivingTime[channelMapping[receivingActors[nextActor] - n_actors]].min();
+        nextA.successor_key = w.receivingActors[nextActor];
+        nextA.delay = receivingTime[w.channelMapping[w.receivingActors[nextActor] - n_actors]].min();
         nextA.min_tok = 0;
         nextA.max_tok = 0;
-        nextA.channel = channelMapping[receivingActors[nextActor] - n_actors];
+        nextA.channel = w.channelMapping[w.receivingActors[nextActor] - n_actors];
 
         //add to boost-msag
-        boost_msag& curr_graph9 = *b_msags[msagId[i]];
-        src = g.getVertex(i);                          //b::vertex(i, *b_msags[msagId[i]]);
-        dst = g.getVertex(receivingActors[nextActor]); //b::vertex(receivingActors[nextActor], *b_msags[msagId[i]]);
+        boost_msag& curr_graph9 = *w.b_msags[msagId[i]];
+        src = g.getVertex(i);                          //b::vertex(i, *w.b_msags[msagId[i]]);
+        dst = g.getVertex(w.receivingActors[nextActor]); //b::vertex(w.receivingActors[nextActor], *w.b_msags[msagId[i]]);
         b::tie(_e, found) = b::add_edge(src, dst, curr_graph9);
-        b::put(b::edge_weight, curr_graph9, _e, receivingTime[channelMapping[receivingActors[nextActor] - n_actors]].min());
+        putWeight(curr_graph9, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[nextActor] - n_actors]);
         b::put(b::edge_weight2, curr_graph9, _e, 0);
       }
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-        if(it != msaGraph.end()){ //i already has an entry in the map
-          msaGraph.at(i).push_back(nextA);
+        unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+        if(it != w.msaGraph.end()){ //i already has an entry in the map
+          w.msaGraph.at(i).push_back(nextA);
         }else{ //no entry for i yet
           vector<SuccessorNode> nextAv;
           nextAv.push_back(nextA);
-          msaGraph.insert(pair<int, vector<SuccessorNode>>(i, nextAv));
+          w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i, nextAv));
         }
       }
 
@@ -1180,7 +1393,7 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
 
         //check whether firstActor has preceding rec_actor
         SuccessorNode first;
-        if(receivingActors[firstActor] == -1){
+        if(w.receivingActors[firstActor] == -1){
           //add edge i -> firstActor
           first.successor_key = firstActor;
           first.delay = wcet[firstActor].min();
@@ -1188,44 +1401,67 @@ void ThroughputMCR::constructMSAG(vector<int> &msagMap) {
           first.max_tok = 1;
 
           //add to boost-msag
-          boost_msag& curr_graph10 = *b_msags[msagId[i]];
-          src = g.getVertex(i);          //b::vertex(i, *b_msags[msagId[i]]);
-          dst = g.getVertex(firstActor); //b::vertex(firstActor, *b_msags[msagId[i]]);
+          boost_msag& curr_graph10 = *w.b_msags[msagId[i]];
+          src = g.getVertex(i);          //b::vertex(i, *w.b_msags[msagId[i]]);
+          dst = g.getVertex(firstActor); //b::vertex(firstActor, *w.b_msags[msagId[i]]);
           b::tie(_e, found) = b::add_edge(src, dst, curr_graph10);
-          b::put(b::edge_weight, curr_graph10, _e, wcet[firstActor].min());
+          putWeight(curr_graph10, _e, SRC_WCET, firstActor);
           b::put(b::edge_weight2, curr_graph10, _e, 1);
         }else{
           //add edge i -> receivingActor[firstActor]
-          first.successor_key = receivingActors[firstActor];
-          first.delay = receivingTime[channelMapping[receivingActors[firstActor] - n_actors]].min();
+          first.successor_key = w.receivingActors[firstActor];
+          first.delay = receivingTime[w.channelMapping[w.receivingActors[firstActor] - n_actors]].min();
           first.min_tok = 1;
           first.max_tok = 1;
-          first.channel = channelMapping[receivingActors[firstActor] - n_actors];
+          first.channel = w.channelMapping[w.receivingActors[firstActor] - n_actors];
 
           //add to boost-msag
-          boost_msag& curr_graph11 = *b_msags[msagId[i]];
-          src = g.getVertex(i);                           //b::vertex(i, *b_msags[msagId[i]]);
-          dst = g.getVertex(receivingActors[firstActor]); //b::vertex(receivingActors[firstActor], *b_msags[msagId[i]]);
+          boost_msag& curr_graph11 = *w.b_msags[msagId[i]];
+          src = g.getVertex(i);                           //b::vertex(i, *w.b_msags[msagId[i]]);
+          dst = g.getVertex(w.receivingActors[firstActor]); //b::vertex(w.receivingActors[firstActor], *w.b_msags[msagId[i]]);
           b::tie(_e, found) = b::add_edge(src, dst, curr_graph11);
-          b::put(b::edge_weight, curr_graph11, _e, receivingTime[channelMapping[receivingActors[firstActor] - n_actors]].min());
+          putWeight(curr_graph11, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[firstActor] - n_actors]);
           b::put(b::edge_weight2, curr_graph11, _e, 1);
         }
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int, vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-          if(it != msaGraph.end()){ //i already has an entry in the map
-            msaGraph.at(i).push_back(first);
+          unordered_map<int, vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+          if(it != w.msaGraph.end()){ //i already has an entry in the map
+            w.msaGraph.at(i).push_back(first);
           }else{    //no entry for i yet
             vector<SuccessorNode> firstv;
             firstv.push_back(first);
-            msaGraph.insert(pair<int, vector<SuccessorNode>>(i, firstv));
+            w.msaGraph.insert(pair<int, vector<SuccessorNode>>(i, firstv));
           }
         }
       }
     }
   }
 
+  //Step 4 (bounding mode): close each open chain with a 1-token edge back to its head
+  //(see constructMSAG()). Tail and head are linked by decided next values, so they are
+  //in the same MSAG
+  if(partialBound){
+    for(auto& seg : openSegments()){
+      int tail = seg.first;
+      int head = seg.second;
+      boost_msag& curr_graph = *w.b_msags[msagId[tail]];
+      src = g.getVertex(tail);
+      if(w.receivingActors[head] == -1){
+        dst = g.getVertex(head);
+        b::tie(_e, found) = b::add_edge(src, dst, curr_graph);
+        putWeight(curr_graph, _e, SRC_WCET, head);
+      }else{
+        dst = g.getVertex(w.receivingActors[head]);
+        b::tie(_e, found) = b::add_edge(src, dst, curr_graph);
+        putWeight(curr_graph, _e, SRC_RECTIME, w.channelMapping[w.receivingActors[head] - n_actors]);
+      }
+      b::put(b::edge_weight2, curr_graph, _e, 1);
+      n_msagChannels++;
+    }
+  }
+
   if(printDebug){
     //printThroughputGraphAsDot(".");
   }
@@ -1239,169 +1475,177 @@ void checkApp(int app, unordered_map<int, set<int>>& coMappedApps, vector<int>&
       checkApp(appl, coMappedApps, uncheckedApps, res);
 }
 
-ExecStatus ThroughputMCR::propagate(Space& home, const ModEventDelta&) {
+ExecStatus ThroughputMCR::propagate(Space& home, const ModEventDelta& med) {
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus ThroughputMCR::filter(Space& home, const ModEventDelta&) {
+  Workspace& w = workspace();
   if(printDebug)
     cout << "\tThroughputMCR::propagate()" << endl;
 
   //auto _start = std::chrono::high_resolution_clock::now(); //timer
   //int time; //runtime of period calculation
 
-  vector<int> msagMap(apps.size(), 0);
-
-  if(apps.size() > 1){
-    //check which application graphs are mapped to same processor (= combined into the same MSAG)
-    vector<set<int>> result;
-    unordered_map<int, set<int>> coMappedApps;
-    vector<int> uncheckedApps(apps.size(), 1);
-    for(int a = 0; a < apps.size(); a++){
-      coMappedApps.insert(pair<int, set<int>>(a, set<int>()));
-    }
-    for(int i = 0; i < n_actors; i++){
-      if(next[i].assigned() && next[i].val() < n_actors){ //next[i] is decided and points to an application actor
-        int actor = i;
-        int nextActor = next[i].val();
-        if(getApp(actor) != getApp(nextActor)){ //from different applications
-          unordered_map<int, set<int>>::const_iterator it = coMappedApps.find(getApp(actor));
-          if(it != coMappedApps.end()){ //i already has an entry in the map
-            coMappedApps.at(getApp(actor)).insert(getApp(nextActor));
-          }else{ //no entry for ch_src[i] yet
-            set<int> coApp;
-            coApp.insert(getApp(nextActor));
-            coMappedApps.insert(pair<int, set<int>>(getApp(actor), coApp));
-          }
-          it = coMappedApps.find(getApp(nextActor));
-          if(it != coMappedApps.end()){ //i already has an entry in the map
-            coMappedApps.at(getApp(nextActor)).insert(getApp(actor));
-          }else{ //no entry for ch_src[i] yet
-            set<int> coApp;
-            coApp.insert(getApp(actor));
-            coMappedApps.insert(pair<int, set<int>>(getApp(nextActor), coApp));
+  //the MSAG only needs to be rebuilt if a schedule decision changed its structure,
+  //otherwise the weights of the retained MSAG are patched
+  bool weightsMoved = true;
+  if(msagStale){
+    //a failed propagation may have left scratch graphs behind
+    for(auto g : w.b_msags)
+      delete g;
+    w.b_msags.clear();
+    w.b_msag.clear();
+
+    vector<int> msagMap(apps.size(), 0);
+
+    if(apps.size() > 1){
+      //check which application graphs are mapped to same processor (= combined into the same MSAG)
+      vector<set<int>> result;
+      unordered_map<int, set<int>> coMappedApps;
+      vector<int> uncheckedApps(apps.size(), 1);
+      for(int a = 0; a < apps.size(); a++){
+        coMappedApps.insert(pair<int, set<int>>(a, set<int>()));
+      }
+      for(int i = 0; i < n_actors; i++){
+        if(next[i].assigned() && next[i].val() < n_actors){ //next[i] is decided and points to an application actor
+          int actor = i;
+          int nextActor = next[i].val();
+          if(getApp(actor) != getApp(nextActor)){ //from different applications
+            unordered_map<int, set<int>>::const_iterator it = coMappedApps.find(getApp(actor));
+            if(it != coMappedApps.end()){ //i already has an entry in the map
+              coMappedApps.at(getApp(actor)).insert(getApp(nextActor));
+            }else{ //no entry for ch_src[i] yet
+              set<int> coApp;
+              coApp.insert(getApp(nextActor));
+              coMappedApps.insert(pair<int, set<int>>(getApp(actor), coApp));
+            }
+            it = coMappedApps.find(getApp(nextActor));
+            if(it != coMappedApps.end()){ //i already has an entry in the map
+              coMappedApps.at(getApp(nextActor)).insert(getApp(actor));
+            }else{ //no entry for ch_src[i] yet
+              set<int> coApp;
+              coApp.insert(getApp(actor));
+              coMappedApps.insert(pair<int, set<int>>(getApp(nextActor), coApp));
+            }
           }
         }
       }
-    }
-//    if(coMappedApps.size() > 0){
+  //    if(coMappedApps.size() > 0){
 
-      int sum_unchecked = 0;
-      for(int x : uncheckedApps)
-        sum_unchecked += x;
-      while(sum_unchecked){
+        int sum_unchecked = 0;
+        for(int x : uncheckedApps)
+          sum_unchecked += x;
+        while(sum_unchecked){
 
-        for(auto& mapp : coMappedApps){
-          if(printDebug){
-            cout << "App " << mapp.first << " is" << (mapp.second.empty() ? " not " : " ") << "co-mapped with ";
-            cout << (mapp.second.empty() ? string(" any other app") : tools::toString(mapp.second)) << endl;
-          }
+          for(auto& mapp : coMappedApps){
+            if(printDebug){
+              cout << "App " << mapp.first << " is" << (mapp.second.empty() ? " not " : " ") << "co-mapped with ";
+              cout << (mapp.second.empty() ? string(" any other app") : tools::toString(mapp.second)) << endl;
+            }
 
-          if(uncheckedApps[mapp.first]){
-            set<int> res;
-            result.push_back(res);
-            checkApp(mapp.first, coMappedApps, uncheckedApps, result.back());
+            if(uncheckedApps[mapp.first]){
+              set<int> res;
+              result.push_back(res);
+              checkApp(mapp.first, coMappedApps, uncheckedApps, result.back());
+            }
           }
-        }
 
-        sum_unchecked = 0;
-        for(int x : uncheckedApps)
-          sum_unchecked += x;
+          sum_unchecked = 0;
+          for(int x : uncheckedApps)
+            sum_unchecked += x;
 
+        }
+
+  //    }else{
+  //      for(size_t i = 0; i < wc_period.size(); i++){
+  //        set<int> res;
+  //        res.insert(i);
+  //        result.push_back(res);
+  //      }
+  //    }
+      for(size_t i = 0; i < result.size(); i++){
+        w.b_msags.push_back(new boost_msag());
+        for(auto it = result[i].begin(); it != result[i].end(); ++it){
+          msagMap[*it] = i;
+        }
       }
+      constructMSAG(msagMap);
 
-//    }else{
-//      for(size_t i = 0; i < wc_period.size(); i++){
-//        set<int> res;
-//        res.insert(i);
-//        result.push_back(res);
-//      }
-//    }
-    for(size_t i = 0; i < result.size(); i++){
-      b_msags.push_back(new boost_msag());
-      for(auto it = result[i].begin(); it != result[i].end(); ++it){
-        msagMap[*it] = i;
+      if(printDebug){
+        if(next.assigned() && wcet.assigned()){
+          cout << "trying to print " << w.b_msags.size() << " boost-msags." << endl;
+          for(size_t t = 0; t < w.b_msags.size(); t++){
+            cout << "Graph " << t << endl;
+            cout << "  Vertices number: " << num_vertices(*w.b_msags[t]) << endl;
+            cout << "  Edges number: " << num_edges(*w.b_msags[t]) << endl;
+            string graphName = "boost_msag" + to_string(t);
+            ofstream out;
+            string outputFile = ".";
+            outputFile += (outputFile.back() == '/') ? (graphName + ".dot") : ("/" + graphName + ".dot");
+            out.open(outputFile.c_str());
+            write_graphviz(out, *w.b_msags[t]);
+            out.close();
+            cout << "  Printed dot graph file " << outputFile << endl;
+          }
+          printThroughputGraphAsDot(".");
+        }
       }
-    }
-    constructMSAG(msagMap);
 
-    if(printDebug){
-      if(next.assigned() && wcet.assigned()){
-        cout << "trying to print " << b_msags.size() << " boost-msags." << endl;
-        for(size_t t = 0; t < b_msags.size(); t++){
-          cout << "Graph " << t << endl;
-          cout << "  Vertices number: " << num_vertices(*b_msags[t]) << endl;
-          cout << "  Edges number: " << num_edges(*b_msags[t]) << endl;
-          string graphName = "boost_msag" + to_string(t);
+      flattenMSAG(w.b_msags);
+    }else{ //only a single application
+      constructMSAG();
+      if(printDebug){
+        if(next.assigned() && wcet.assigned()){
+          string graphName = "boost_msag";
           ofstream out;
           string outputFile = ".";
           outputFile += (outputFile.back() == '/') ? (graphName + ".dot") : ("/" + graphName + ".dot");
           out.open(outputFile.c_str());
-          write_graphviz(out, *b_msags[t]);
+          write_graphviz(out, w.b_msag);
           out.close();
-          cout << "  Printed dot graph file " << outputFile << endl;
+          printThroughputGraphAsDot(".");
         }
-        printThroughputGraphAsDot(".");
       }
+      vector<boost_msag*> graphs(1, &w.b_msag);
+      flattenMSAG(graphs);
     }
+    msagOfApp = msagMap;
+    msagStale = false;
+    tools::PropStats::msag(profileKind, n_msagActors, n_msagChannels);
+  }else{
+    weightsMoved = patchMSAG();
+  }
 
+  //do MCR analysis, unless no edge of the MSAG has changed since the last one
+  if(weightsMoved){
+    vector<boost_msag> graphs;
+    materializeMSAG(graphs);
     vector<int> msag_mcrs;
-    for(auto m : b_msags){
+    for(auto& m : graphs){
       using namespace boost;
       int max_cr; /// maximum cycle ratio
       typedef std::vector<graph_traits<boost_msag>::edge_descriptor> t_critCycl;
       t_critCycl cc; ///critical cycle
-      property_map<boost_msag, vertex_index_t>::type vim = get(vertex_index, *m);
-      property_map<boost_msag, edge_weight_t>::type ew1 = get(edge_weight, *m);
-      property_map<boost_msag, edge_weight2_t>::type ew2 = get(edge_weight2, *m);
+      property_map<boost_msag, vertex_actorid_t>::type vim = get(vertex_actorid, m);
+      property_map<boost_msag, edge_weight_t>::type ew1 = get(edge_weight, m);
+      property_map<boost_msag, edge_weight2_t>::type ew2 = get(edge_weight2, m);
 
-      //do MCR analysis
-      max_cr = maximum_cycle_ratio(*m, vim, ew1, ew2, &cc);
+      max_cr = maximum_cycle_ratio(m, get(vertex_index, m), ew1, ew2, &cc);
       msag_mcrs.push_back(max_cr);
       if(printDebug){
-        cout << "Period of app(s) " << tools::toString(result[msag_mcrs.size()-1]) << ": ";
-        cout <<  max_cr << endl;
+        cout << "Period of MSAG " << msag_mcrs.size() - 1 << ": ";
+        cout << max_cr << endl;
         cout << "Critical cycle:\n";
         for(t_critCycl::iterator itr = cc.begin(); itr != cc.end(); ++itr){
-          cout << "(" << vim[source(*itr, b_msag)] << "," << vim[target(*itr, b_msag)] << ") ";
+          cout << "(" << vim[source(*itr, m)] << "," << vim[target(*itr, m)] << ") ";
         }
         cout << endl;
       }
     }
-    for(size_t i = 0; i < msag_mcrs.size(); i++){
-      for(auto r: result[i]){
-        wc_period[r] = msag_mcrs[i];
-      }
-    }
-
-  }else{ //only a single application
-    constructMSAG();
-    using namespace boost;
-    int max_cr; /// maximum cycle ratio
-    typedef std::vector<graph_traits<boost_msag>::edge_descriptor> t_critCycl;
-    t_critCycl cc; ///critical cycle
-
-    property_map<boost_msag, vertex_index_t>::type vim = get(vertex_index, b_msag);
-    property_map<boost_msag, edge_weight_t>::type ew1 = get(edge_weight, b_msag);
-    property_map<boost_msag, edge_weight2_t>::type ew2 = get(edge_weight2, b_msag);
-    //do MCR analysis
-    max_cr = maximum_cycle_ratio(b_msag, vim, ew1, ew2, &cc);
-    wc_period[0] = max_cr;
-
-    if(printDebug){
-      if(next.assigned() && wcet.assigned()){
-        string graphName = "boost_msag";
-        ofstream out;
-        string outputFile = ".";
-        outputFile += (outputFile.back() == '/') ? (graphName + ".dot") : ("/" + graphName + ".dot");
-        out.open(outputFile.c_str());
-        write_graphviz(out, b_msag);
-        out.close();
-        printThroughputGraphAsDot(".");
-      }
-
-      cout << "Maximum cycle ratio is " << max_cr << endl;
-      cout << "Critical cycle:\n";
-      for(t_critCycl::iterator itr = cc.begin(); itr != cc.end(); ++itr){
-        cout << "(" << vim[source(*itr, b_msag)] << "," << vim[target(*itr, b_msag)] << ") ";
-      }
-      cout << endl;
+    for(int i = 0; i < apps.size(); i++){
+      wc_period[i] = msag_mcrs[msagOfApp[i]];
     }
   }
 
@@ -1440,7 +1684,7 @@ ExecStatus ThroughputMCR::propagate(Space& home, const ModEventDelta&) {
      //GECODE_ME_CHECK(latency[i].eq(home,wc_latency[i][0]));
      GECODE_ME_CHECK(period[i].eq(home,wc_period[i]));
      }else*/
-    if(!all_assigned && !all_ch_local){
+    if(!all_assigned && (!all_ch_local || partialBound)){
 //          GECODE_ME_CHECK(latency[i].gq(home, wc_latency[i][0]));
       GECODE_ME_CHECK(period[i].gq(home, wc_period[i]));
     }else if(all_assigned){
@@ -1451,41 +1695,41 @@ ExecStatus ThroughputMCR::propagate(Space& home, const ModEventDelta&) {
   /*
    //propagate bounds on iterations of entities and channels in time-based schedule
    for(int i=0; i<n_actors; i++){
-   //if(next.assigned())GECODE_ME_CHECK(iterations[i].gq(home,min_iterations[i]));
-   //if(all_assigned)GECODE_ME_CHECK(iterations[i].gq(home,min_iterations[i]));
-   if(all_assigned)GECODE_ME_CHECK(iterations[i].lq(home,max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
+   //if(next.assigned())GECODE_ME_CHECK(iterations[i].gq(home,w.min_iterations[i]));
+   //if(all_assigned)GECODE_ME_CHECK(iterations[i].gq(home,w.min_iterations[i]));
+   if(all_assigned)GECODE_ME_CHECK(iterations[i].lq(home,w.max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
    }
    for(int i=n_actors; i<n_msagActors; i++){
    //for now, only consider the sending part for each channel
    if((i-n_actors)%2==0){
-   //if(next.assigned())GECODE_ME_CHECK(iterationsCh[channelMapping[i]].gq(home,min_iterations[i]));
-   //if(all_assigned)GECODE_ME_CHECK(iterationsCh[channelMapping[i]].gq(home,min_iterations[i]));
-   if(all_assigned)GECODE_ME_CHECK(iterationsCh[channelMapping[i]].lq(home,max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
+   //if(next.assigned())GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].gq(home,w.min_iterations[i]));
+   //if(all_assigned)GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].gq(home,w.min_iterations[i]));
+   if(all_assigned)GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].lq(home,w.max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
    }
    }*/
 
-  b_msag.clear();
-  for(size_t t = 0; t < b_msags.size(); t++){
-    //b_msags[t]->clear();
-    delete b_msags[t];
-  }
-  b_msags.clear();
-  msaGraph.clear();
-  channelMapping.clear();
-  receivingActors.clear();
-
-  max_start.clear();
-  max_end.clear();
-  min_start.clear();
-  min_end.clear();
-  start_pp.clear();
-  end_pp.clear();
-  min_iterations.clear();
-  max_iterations.clear();
-  min_send_buffer.clear();
-  max_send_buffer.clear();
-  min_rec_buffer.clear();
-  max_rec_buffer.clear();
+  w.b_msag.clear();
+  for(size_t t = 0; t < w.b_msags.size(); t++){
+    //w.b_msags[t]->clear();
+    delete w.b_msags[t];
+  }
+  w.b_msags.clear();
+  w.msaGraph.clear();
+  w.channelMapping.clear();
+  w.receivingActors.clear();
+
+  w.max_start.clear();
+  w.max_end.clear();
+  w.min_start.clear();
+  w.min_end.clear();
+  w.start_pp.clear();
+  w.end_pp.clear();
+  w.min_iterations.clear();
+  w.max_iterations.clear();
+  w.min_send_buffer.clear();
+  w.max_send_buffer.clear();
+  w.min_rec_buffer.clear();
+  w.max_rec_buffer.clear();
 
   if(next.assigned() && wcet.assigned() && sendingTime.assigned() && sendingLatency.assigned() && receivingTime.assigned() && receivingNext.assigned()
       && sendbufferSz.assigned() && recbufferSz.assigned())
@@ -1653,7 +1897,7 @@ void throughputMCR(Space& home, const IntVarArgs& latency, const IntVarArgs& per
     const IntVarArgs& iterationsCh, //min/max
     const IntVarArgs& sendbufferSz, const IntVarArgs& recbufferSz, const IntVarArgs& next, const IntVarArgs& wcet, const IntVarArgs& sendingTime,
     const IntVarArgs& sendingLatency, const IntVarArgs& sendingNext, const IntVarArgs& receivingTime, const IntVarArgs& receivingNext, const IntArgs& ch_src,
-    const IntArgs& ch_dst, const IntArgs& tok, const IntArgs& apps) {
+    const IntArgs& ch_dst, const IntArgs& tok, const IntArgs& apps, bool partialBound) {
   if(latency.size() != period.size()){
     throw Gecode::Int::ArgumentSizeMismatch("Throughput constraint, latency & period");
   }
@@ -1710,39 +1954,66 @@ void throughputMCR(Space& home, const IntVarArgs& latency, const IntVarArgs& per
   ViewArray<Int::IntView> _receivingNext(home, receivingNext);
   IntArgs minIndices, maxIndices;
   if(ThroughputMCR::post(home, _latency, _period, _iterations, _iterationsCh, _sendbufferSz, _recbufferSz, _next, _wcet, _sendingTime, _sendingLatency,
-      _sendingNext, _receivingTime, _receivingNext, ch_src, ch_dst, tok, apps, minIndices, maxIndices) != ES_OK){
+      _sendingNext, _receivingTime, _receivingNext, ch_src, ch_dst, tok, apps, minIndices, maxIndices, partialBound) != ES_OK){
     home.fail();
   }
 }
 
+vector<pair<int,int>> ThroughputMCR::openSegments() const {
+  vector<int> pred(n_actors, -1);
+  for(int i = 0; i < n_actors; i++){
+    if(next[i].assigned() && next[i].val() < n_actors)
+      pred[next[i].val()] = i;
+  }
+  vector<pair<int,int>> segments;
+  for(int i = 0; i < n_actors; i++){
+    bool open = !next[i].assigned();
+    if(next[i].assigned() && next[i].val() >= n_actors){ //last on its proc: open until the first actor is known
+      int dummy = next[i].val() > n_actors ? n_actors + ((next[i].val() - n_actors - 1) % n_procs) : n_actors + n_procs - 1;
+      open = !next[dummy].assigned();
+    }
+    if(!open)
+      continue;
+    int head = i;
+    for(int steps = 0; pred[head] != -1 && steps < n_actors; steps++)
+      head = pred[head];
+    segments.push_back(make_pair(i, head));
+  }
+  return segments;
+}
+
 int ThroughputMCR::getBlockActor(int ch_id) const {
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it) + n_actors;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it) + n_actors;
 
   return -1;
 }
 
 int ThroughputMCR::getSendActor(int ch_id) const {
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it) + n_actors + 1;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it) + n_actors + 1;
 
   return -1;
 }
 
 int ThroughputMCR::getRecActor(int ch_id) const {
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it) + n_actors + 2;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it) + n_actors + 2;
 
   return -1;
 }
 
 int ThroughputMCR::getApp(int msagActor_id) const {
+  Workspace& w = workspace();
   int id = msagActor_id;
   if(msagActor_id >= n_actors){
-    id = ch_dst[channelMapping[msagActor_id - n_actors]];
+    id = ch_dst[w.channelMapping[msagActor_id - n_actors]];
   }
   for(int i = 0; i < apps.size(); i++){
     if(id <= apps[i])
@@ -1752,8 +2023,9 @@ int ThroughputMCR::getApp(int msagActor_id) const {
 }
 
 void ThroughputMCR::printThroughputGraph() const {
+  Workspace& w = workspace();
   cout << "-------------------------------------------------" << endl;
-  for(auto it = msaGraph.begin(); it != msaGraph.end(); ++it){
+  for(auto it = w.msaGraph.begin(); it != w.msaGraph.end(); ++it){
     int node = it->first;
     cout << node << ": ";
     vector<SuccessorNode> succs = (vector<SuccessorNode> ) (it->second);
@@ -1782,6 +2054,7 @@ void ThroughputMCR::printThroughputGraph() const {
 }
 
 void ThroughputMCR::printThroughputGraphAsDot(const string &dir) const {
+  Workspace& w = workspace();
 
   string graphName = "throughputGraph";
   ofstream out;
@@ -1801,13 +2074,13 @@ void ThroughputMCR::printThroughputGraphAsDot(const string &dir) const {
       actorName = "actor_" + to_string(i);
       col = (getApp(i) + 1) % 32;
     }else if(i >= n_actors && (i - n_actors) % 3 == 0){ //blocking node
-      actorName = "block_ch" + to_string(channelMapping[i - n_actors]);
+      actorName = "block_ch" + to_string(w.channelMapping[i - n_actors]);
       col = -1;
     }else if(i >= n_actors && (i - n_actors) % 3 == 1){ //sending node
-      actorName = "send_ch" + to_string(channelMapping[i - n_actors]);
+      actorName = "send_ch" + to_string(w.channelMapping[i - n_actors]);
       col = -2;
     }else if(i >= n_actors && (i - n_actors) % 3 == 2){ //receiving node
-      actorName = "rec_ch" + to_string(channelMapping[i - n_actors]);
+      actorName = "rec_ch" + to_string(w.channelMapping[i - n_actors]);
       col = -3;
     }
 
@@ -1835,17 +2108,17 @@ void ThroughputMCR::printThroughputGraphAsDot(const string &dir) const {
   }
   out << endl;
 
-  for(auto it = msaGraph.begin(); it != msaGraph.end(); ++it){
+  for(auto it = w.msaGraph.begin(); it != w.msaGraph.end(); ++it){
     string srcName;
     int node = it->first;
     if(node < n_actors){
       srcName = "actor_" + to_string(node);
     }else if(node >= n_actors && (node - n_actors) % 3 == 0){ //blocking node
-      srcName = "block_ch" + to_string(channelMapping[node - n_actors]);
+      srcName = "block_ch" + to_string(w.channelMapping[node - n_actors]);
     }else if(node >= n_actors && (node - n_actors) % 3 == 1){ //sending node
-      srcName = "send_ch" + to_string(channelMapping[node - n_actors]);
+      srcName = "send_ch" + to_string(w.channelMapping[node - n_actors]);
     }else if(node >= n_actors && (node - n_actors) % 3 == 2){ //receiving node
-      srcName = "rec_ch" + to_string(channelMapping[node - n_actors]);
+      srcName = "rec_ch" + to_string(w.channelMapping[node - n_actors]);
     }
     vector<SuccessorNode> succs = (vector<SuccessorNode> ) (it->second);
     for(auto itV = succs.begin(); itV != succs.end(); ++itV){
@@ -1854,11 +2127,11 @@ void ThroughputMCR::printThroughputGraphAsDot(const string &dir) const {
       if(node2 < n_actors){
         dstName = "actor_" + to_string(node2);
       }else if(node2 >= n_actors && (node2 - n_actors) % 3 == 0){ //blocking node
-        dstName = "block_ch" + to_string(channelMapping[node2 - n_actors]);
+        dstName = "block_ch" + to_string(w.channelMapping[node2 - n_actors]);
       }else if(node2 >= n_actors && (node2 - n_actors) % 3 == 1){ //sending node
-        dstName = "send_ch" + to_string(channelMapping[node2 - n_actors]);
+        dstName = "send_ch" + to_string(w.channelMapping[node2 - n_actors]);
       }else if(node2 >= n_actors && (node2 - n_actors) % 3 == 2){ //receiving node
-        dstName = "rec_ch" + to_string(channelMapping[node2 - n_actors]);
+        dstName = "rec_ch" + to_string(w.channelMapping[node2 - n_actors]);
       }
       int tok = ((SuccessorNode) (*itV)).max_tok;
       // Initial tokens on channel?
@@ -1866,10 +2139,10 @@ void ThroughputMCR::printThroughputGraphAsDot(const string &dir) const {
         string label;
         out << "    " << srcName << " -> " << dstName;
         if(node >= n_actors && (node - n_actors) % 3 == 0 && node2 < n_actors){
-          label = "send_buff (ch" + to_string(channelMapping[node - n_actors]) + ")";
+          label = "send_buff (ch" + to_string(w.channelMapping[node - n_actors]) + ")";
           out << " [ label=\"" << label << "\"];" << endl;
         }else if(node >= n_actors && (node - n_actors) % 3 == 2 && node2 >= n_actors && (node2 - n_actors) % 3 == 1){
-          label = "rec_buff (ch" + to_string(channelMapping[node2 - n_actors]) + ")";
+          label = "rec_buff (ch" + to_string(w.channelMapping[node2 - n_actors]) + ")";
           out << " [ label=\"" << label << "\"];" << endl;
         }else{
           label = to_string(tok);
@@ -36,11 +36,13 @@
 #include <unordered_map>
 #include <set>
 #include <chrono>
+#include <memory>
 #include <sstream>
 #include <fstream>
 #include <boost/graph/graphviz.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/howard_cycle_ratio.hpp>
+#include <boost/range/iterator_range.hpp>
 
 
 using namespace Gecode;
@@ -52,12 +54,18 @@ namespace b = boost;
 //! alias for actor ID property (check BGL documentation)
 //<http://www.boost.org/doc/libs/1_53_0/libs/graph/doc/using_adjacency_list.html#sec:adjacency-list-properties>
 enum vertex_actorid_t { vertex_actorid };
+//! alias for the sources of the delay and token weights of an edge (0 = constant)
+enum edge_wsource_t { edge_wsource };
+enum edge_tsource_t { edge_tsource };
 namespace boost {
   BOOST_INSTALL_PROPERTY(vertex, actorid);
+  BOOST_INSTALL_PROPERTY(edge, wsource);
+  BOOST_INSTALL_PROPERTY(edge, tsource);
 }
 
 using actor_prop = b::property<vertex_actorid_t, int>;
-using chan_prop  = b::property<b::edge_weight_t, int, b::property<b::edge_weight2_t, int> >;
+using chan_prop  = b::property<b::edge_weight_t, int, b::property<b::edge_weight2_t, int,
+                   b::property<edge_wsource_t, int, b::property<edge_tsource_t, int> > > >;
 using boost_msag = b::adjacency_list<b::vecS, b::vecS, b::directedS, actor_prop, chan_prop>;
 
 
@@ -78,6 +86,61 @@ private:
       SuccessorNode():successor_key(-1){};
 
   };
+  //views an edge weight of the MSAG can be read from
+  enum MsagSource { SRC_WCET, SRC_SENDTIME, SRC_SENDLAT, SRC_RECTIME, SRC_SENDBUF, SRC_RECBUF };
+  //edge of the retained (flat) MSAG
+  class MsagEdge{
+    public:
+      int graph; //index of the MSAG the edge belongs to
+      int src;
+      int dst;
+      int wsource; //source key + 1 of the delay, 0 if constant
+      int tsource; //source key + 1 of the tokens, 0 if constant
+  };
+  //structure of the retained MSAG(s), only changes when the MSAG is rebuilt
+  class MsagStructure{
+    public:
+      vector<MsagEdge> edges;
+      vector<vector<int>> actors; //for each MSAG, the actor id of each vertex
+      vector<int> first; //index[first[k]..first[k+1]-1] are the edges reading source key k
+      vector<int> index;
+  };
+  //scratch data only used within one propagation, kept once per thread instead of per clone
+  class Workspace{
+    public:
+      //for construction of the mapping and scheduling aware graph
+      unordered_map<int,vector<SuccessorNode>> msaGraph;
+      //MSAG representation for boost
+      boost_msag b_msag;
+      //MSAG representation for boost
+      vector<boost_msag*> b_msags;
+      //for mapping from msag send/rec actors to appG-channels
+      vector<int> channelMapping;
+      //receivingActors: for storing/finding the first receiving actor for each dst
+      vector<int> receivingActors;
+      vector<vector<int>> max_start; //self-timed schedule generated by MCR
+      vector<vector<int>> max_end; //self-timed schedule generated by MCR
+      vector<vector<int>> min_start; //minimal schedule with same latency & period
+      vector<vector<int>> min_end; //minimal schedule with same latency & period
+      vector<int> start_pp; //start times for periodic phase
+      vector<int> end_pp; //end times for periodic phase
+      vector<int> min_iterations; //min iterations of actors for wc latency and period
+      vector<int> max_iterations; //max iterations of actors for wc latency and period
+      vector<int> min_send_buffer; //min buffer size of all appG-channels
+      vector<int> max_send_buffer; //max buffer size of all appG-channels
+      vector<int> min_rec_buffer; //min buffer size of all appG-channels
+      vector<int> max_rec_buffer; //max buffer size of all appG-channels
+  };
+  static Workspace& workspace();
+  //advisor on a single view, key is the source key for weight views, -1 for schedule views
+  class MsagAdvisor : public ViewAdvisor<IntView>{
+    public:
+      int key;
+      MsagAdvisor(Space& home, Propagator& p, Council<MsagAdvisor>& c, IntView x, int k) :
+          ViewAdvisor<IntView>(home, p, c, x), key(k){}
+      MsagAdvisor(Space& home, bool share, MsagAdvisor& a) :
+          ViewAdvisor<IntView>(home, share, a), key(a.key){}
+  };
 protected:
   ViewArray<IntView> latency; //resulting initial latency
   ViewArray<IntView> period; //resulting period
@@ -92,12 +155,12 @@ protected:
   ViewArray<IntView> sendingNext; //current sending schedule for channels
   ViewArray<IntView> receivingTime; //current receiving time for channels (atm 0)
   ViewArray<IntView> receivingNext; //current receiving schedule (Note: sending schedule is included/respected in sending latency)
-  IntArgs ch_src; //source actors for all channels 
-  IntArgs ch_dst; //destination actors for all channels
-  IntArgs tok; //initial token distribution of application graph
-  IntArgs apps; //apps[i] is index of last actor of application i
-  IntArgs minIndices; //for each entity and channel, its first index in the time-based schedule
-  IntArgs maxIndices; //for each entity and channel, its last index in the time-based schedule
+  IntSharedArray ch_src; //source actors for all channels 
+  IntSharedArray ch_dst; //destination actors for all channels
+  IntSharedArray tok; //initial token distribution of application graph
+  IntSharedArray apps; //apps[i] is index of last actor of application i
+  IntSharedArray minIndices; //for each entity and channel, its first index in the time-based schedule
+  IntSharedArray maxIndices; //for each entity and channel, its last index in the time-based schedule
 
   int n_actors; //number of actors in the graph
   int n_channels; //number of channels in the graph
@@ -105,48 +168,55 @@ protected:
   int n_msagActors; //number of actors in msag
   int n_msagChannels; //number of channels
   int channel_count; //number of messages on interconnect
-  
-  //for construction of the mapping and scheduling aware graph
-  unordered_map<int,vector<SuccessorNode>> msaGraph;
-  //MSAG representation for boost
-  boost_msag b_msag;
-  //MSAG representation for boost
-  vector<boost_msag*> b_msags;
-  //for mapping from msag send/rec actors to appG-channels
-  vector<int> channelMapping;
-  //receivingActors: for storing/finding the first receiving actor for each dst
-  vector<int> receivingActors;
+
+  //advisors on next, wcet and the communication views
+  Council<MsagAdvisor> c;
+  //true if the structure of the MSAG has changed since it was last built
+  bool msagStale;
+  //source keys of weight views that have changed since the last propagation
+  vector<int> dirtySources;
+  //retained MSAG(s) as flat edge list, shared between clones until rebuilt
+  std::shared_ptr<const MsagStructure> msag;
+  //current delays and tokens of the edges in msag, patched on weight changes
+  vector<int> msagWeights;
+  vector<int> msagTokens;
+  //for each application, the MSAG it is part of
+  vector<int> msagOfApp;
 
   //MCR results
   vector<vector<int>> wc_latency; 
   vector<int> wc_period;
-  vector<vector<int>> max_start; //self-timed schedule generated by MCR
-  vector<vector<int>> max_end; //self-timed schedule generated by MCR
-  vector<vector<int>> min_start; //minimal schedule with same latency & period
-  vector<vector<int>> min_end; //minimal schedule with same latency & period
-  vector<int> start_pp; //start times for periodic phase
-  vector<int> end_pp; //end times for periodic phase
-  vector<int> min_iterations; //min iterations of actors for wc latency and period
-  vector<int> max_iterations; //max iterations of actors for wc latency and period
-  vector<int> min_send_buffer; //min buffer size of all appG-channels
-  vector<int> max_send_buffer; //max buffer size of all appG-channels
-  vector<int> min_rec_buffer; //min buffer size of all appG-channels
-  vector<int> max_rec_buffer; //max buffer size of all appG-channels
 
   //for evaluation purposes
   bool printDebug;
+  //bounding mode: close partial schedule chains optimistically and bound the period at every node
+  bool partialBound;
   
   //builds the msaGraph based on the current state of the solution
   void constructMSAG();
   //builds the msaGraph based on the current state of the solution
   //the coMapped vector specifies for each application, which MSAG it is part of
   void constructMSAG(vector<int> &msagMap);
+  //source key of view idx of kind src, and its current contribution to an edge weight
+  int sourceKey(MsagSource src, int idx) const;
+  int sourceValue(int key) const;
+  //sets the delay/tokens of edge e and remembers where it was read from
+  void putWeight(boost_msag& g, b::graph_traits<boost_msag>::edge_descriptor e, MsagSource src, int idx);
+  void putTokens(boost_msag& g, b::graph_traits<boost_msag>::edge_descriptor e, MsagSource src, int idx);
+  //stores the built MSAG(s) as flat edge list
+  void flattenMSAG(const vector<boost_msag*>& graphs);
+  //re-reads the weights of all edges depending on dirty sources, returns true if any edge changed
+  bool patchMSAG();
+  //builds boost graphs from the flat edge list
+  void materializeMSAG(vector<boost_msag>& graphs) const;
   int getBlockActor(int ch_id) const;
   int getSendActor(int ch_id) const;
   int getRecActor(int ch_id) const;
   int getApp(int msagActor_id) const;
   void printThroughputGraph() const;
   void printThroughputGraphAsDot(const string &dir) const;
+  //(tail, head) of the chains of decided next values that are not closed into a processor cycle yet
+  vector<pair<int,int>> openSegments() const;
 
 
 public:
@@ -168,7 +238,8 @@ ThroughputMCR(Space& home, ViewArray<IntView> p_latency,
                          IntArgs p_tok, 
                          IntArgs p_apps, 
                          IntArgs p_minIndices, 
-                         IntArgs p_maxIndices);
+                         IntArgs p_maxIndices,
+                         bool p_partialBound = false);
 
 static ExecStatus post(Space& home, ViewArray<IntView> p_latency,
                        ViewArray<IntView> p_period,  
@@ -188,12 +259,13 @@ static ExecStatus post(Space& home, ViewArray<IntView> p_latency,
                        IntArgs p_tok, 
                        IntArgs p_apps, 
                        IntArgs p_minIndices, 
-                       IntArgs p_maxIndices){
+                       IntArgs p_maxIndices,
+                       bool p_partialBound = false){
   (void) new (home) ThroughputMCR(home, p_latency, p_period, p_iterations, p_iterationsCh, 
                                   p_sendbufferSz, p_recbufferSz, p_next,
                                   p_wcet, p_sendingTime, p_sendingLatency, p_sendingNext,
                                   p_receivingTime, p_receivingNext,p_ch_src, p_ch_dst,
-                                  p_tok, p_apps, p_minIndices, p_maxIndices);
+                                  p_tok, p_apps, p_minIndices, p_maxIndices, p_partialBound);
   return ES_OK;
 }
 
@@ -203,11 +275,16 @@ ThroughputMCR(Space& home, bool share, ThroughputMCR& p);
 
 virtual Propagator* copy(Space& home, bool share);
 
-//TODO: do this right
 virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
 
+virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+
 virtual ExecStatus propagate(Space& home, const ModEventDelta&);
 
+protected:
+/** Rebuilds (or re-weights) the MSAGs and bounds period and latency by their maximum cycle ratio. */
+ExecStatus filter(Space& home, const ModEventDelta& med);
+
 };
 
 
@@ -230,6 +307,7 @@ extern void throughputMCR(Space& home, const IntVar latency,
                              const IntArgs& tok);
                              
 //throughput constraint for multiple apps without propagation on time-based schedule
+//partialBound: bound the periods from the partial schedule at every node (th_prop=MCR_BOUND)
 extern void throughputMCR(Space& home, const IntVarArgs& latency,
                              const IntVarArgs& period,
                              const IntVarArgs& iterations, //min/max
@@ -246,6 +324,7 @@ extern void throughputMCR(Space& home, const IntVarArgs& latency,
                              const IntArgs& ch_src,
                              const IntArgs& ch_dst, 
                              const IntArgs& tok, 
-                             const IntArgs& apps);
+                             const IntArgs& apps,
+                             bool partialBound = false);
 #endif
 
@@ -1,10 +1,16 @@
 
 #include "throughputSSE.hpp"
+#include "../tools/clonestats.hpp"
+#include "../tools/propstats.hpp"
 
 using namespace Gecode;
 using namespace Int;
 using namespace std;
 
+namespace {
+  const size_t profileKind = tools::PropStats::kind("ThroughputSSE");
+}
+
 
 ThroughputSSE::ThroughputSSE(Space& home, ViewArray<IntView> p_latency,
                              ViewArray<IntView> p_period,  
@@ -91,26 +97,15 @@ size_t ThroughputSSE::dispose(Space& home){
     sendingNext.cancel(home, *this, Int::PC_INT_VAL);
     receivingNext.cancel(home, *this, Int::PC_INT_VAL);*/
   
-  msaGraph.~unordered_map<int,vector<SuccessorNode>>();
-  channelMapping.~vector<int>();
-  receivingActors.~vector<int>();
-  ch_state.~vector<int>();
-  actor_delay.~vector<int>();
+  ch_src.~IntSharedArray();
+  ch_dst.~IntSharedArray();
+  tok.~IntSharedArray();
+  apps.~IntSharedArray();
+  minIndices.~IntSharedArray();
+  maxIndices.~IntSharedArray();
 
   wc_latency.~vector<vector<int>>(); 
   wc_period.~vector<int>();
-  max_start.~vector<vector<int>>();
-  max_end.~vector<vector<int>>();
-  min_start.~vector<vector<int>>();
-  min_end.~vector<vector<int>>();
-  start_pp.~vector<int>();
-  end_pp.~vector<int>();
-  min_iterations.~vector<int>();
-  max_iterations.~vector<int>();
-  min_send_buffer.~vector<int>();
-  max_send_buffer.~vector<int>();
-  min_rec_buffer.~vector<int>();
-  max_rec_buffer.~vector<int>();
   
   
   home.ignore(*this, AP_DISPOSE);
@@ -120,26 +115,21 @@ size_t ThroughputSSE::dispose(Space& home){
  
 ThroughputSSE::ThroughputSSE(Space& home, bool share, ThroughputSSE& p): 
   Propagator(home, share, p),
-  ch_src(p.ch_src),
-  ch_dst(p.ch_dst),
-  tok(p.tok),
-  apps(p.apps),
-  minIndices(p.minIndices), 
-  maxIndices(p.maxIndices),
   n_actors(p.n_actors),
   n_channels(p.n_channels),
   n_procs(p.n_procs),
   n_msagActors(p.n_msagActors),
-  msaGraph(p.msaGraph),
-  channelMapping(p.channelMapping),
-  receivingActors(p.receivingActors),
-  ch_state(p.ch_state),
-  actor_delay(p.actor_delay),
   wc_latency(p.wc_latency),
   wc_period(p.wc_period),
   calls(p.calls),
   total_time(p.total_time),
   printDebug(p.printDebug) {
+  ch_src.update(home, share, p.ch_src);
+  ch_dst.update(home, share, p.ch_dst);
+  tok.update(home, share, p.tok);
+  apps.update(home, share, p.apps);
+  minIndices.update(home, share, p.minIndices);
+  maxIndices.update(home, share, p.maxIndices);
   latency.update(home, share, p.latency);
   period.update(home, share, p.period);
   iterations.update(home, share, p.iterations);
@@ -164,15 +154,25 @@ ThroughputSSE::ThroughputSSE(Space& home, bool share, ThroughputSSE& p):
 }
 
 Propagator* ThroughputSSE::copy(Space& home, bool share){
+  size_t bytes = sizeof(*this) + sizeof(int) * wc_period.size();
+  for(auto& l : wc_latency)
+    bytes += sizeof(vector<int>) + sizeof(int) * l.size();
+  tools::CloneStats::record(bytes);
   return new (home) ThroughputSSE(home, share, *this);
 }
 
+ThroughputSSE::Workspace& ThroughputSSE::workspace(){
+  static thread_local Workspace w;
+  return w;
+}
+
 //TODO: do this right
 PropCost ThroughputSSE::cost(const Space& home, const ModEventDelta& med) const{
   return PropCost::linear(PropCost::HI,next.size());
 }
 
 void ThroughputSSE::debug_constructMSAG(){
+  Workspace& w = workspace();
   //if(printDebug) cout << "\tThroughputSSE::debug_constructMSAG()" << endl;
   //first, figure out how many actors there will be in the MSAG, in order to
   //initialize channel-matrix and actor-vector for the state of SSE
@@ -183,15 +183,15 @@ void ThroughputSSE::debug_constructMSAG(){
     }
   }
   
-  msaGraph.clear();
-  ch_state.clear();
-  actor_delay.clear();
-  receivingActors.clear();
-  channelMapping.clear();
+  w.msaGraph.clear();
+  w.ch_state.clear();
+  w.actor_delay.clear();
+  w.receivingActors.clear();
+  w.channelMapping.clear();
   
-  ch_state.insert(ch_state.begin(), n_msagActors*n_msagActors, -1);
-  actor_delay.insert(actor_delay.begin(), n_msagActors, 0);
-  receivingActors.insert(receivingActors.begin(), n_actors, -1); //pre-fill with -1
+  w.ch_state.insert(w.ch_state.begin(), n_msagActors*n_msagActors, -1);
+  w.actor_delay.insert(w.actor_delay.begin(), n_msagActors, 0);
+  w.receivingActors.insert(w.receivingActors.begin(), n_actors, -1); //pre-fill with -1
 
   channel_count = 0;
   n_msagChannels = 0; //to count the number of channels in the MSAG
@@ -209,9 +209,9 @@ void ThroughputSSE::debug_constructMSAG(){
       int send_actor = block_actor + 1;
       int rec_actor = send_actor + 1;
       //store mapping between block/send/rec_actor and channel i
-      channelMapping.push_back(i); //[block_actor] = i;
-      channelMapping.push_back(i); //[send_actor] = i;
-      channelMapping.push_back(i); //[rec_actor] = i;
+      w.channelMapping.push_back(i); //[block_actor] = i;
+      w.channelMapping.push_back(i); //[send_actor] = i;
+      w.channelMapping.push_back(i); //[rec_actor] = i;
       //add the block actor as a successor of ch_src[i]
       SuccessorNode succB;
       succB.successor_key = block_actor;
@@ -222,19 +222,19 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(ch_src[i]).push_back(succB);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(ch_src[i]).push_back(succB);
         }else{//no entry for ch_src[i] yet
           vector<SuccessorNode> succBv;
           succBv.push_back(succB);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],succBv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],succBv));
         }
       }
       //add ch_src[i]->block_actor to state of SSE
-      ch_state[ch_src[i]*n_msagActors+block_actor] = succB.max_tok;
-      actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
-      actor_delay[block_actor] = sendingLatency[i].min();
+      w.ch_state[ch_src[i]*n_msagActors+block_actor] = succB.max_tok;
+      w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+      w.actor_delay[block_actor] = sendingLatency[i].min();
 
       //add ch_src[i] as successor of the block actor, with buffer size as tokens
       SuccessorNode srcCh;
@@ -245,19 +245,19 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(block_actor).push_back(srcCh);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(srcCh);
         }else{//no entry for block_actor yet
           vector<SuccessorNode> srcChv;
           srcChv.push_back(srcCh);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,srcChv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,srcChv));
         }
       }
       //add block_actor->ch_src[i] to state of SSE
-      ch_state[block_actor*n_msagActors+ch_src[i]] = srcCh.max_tok;
-      actor_delay[block_actor] = sendingLatency[i].min();
-      actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+      w.ch_state[block_actor*n_msagActors+ch_src[i]] = srcCh.max_tok;
+      w.actor_delay[block_actor] = sendingLatency[i].min();
+      w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
       //###
       //add the send actor as a successor of the block actor
       SuccessorNode succS;
@@ -269,19 +269,19 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(block_actor).push_back(succS);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(succS);
         }else{//no entry for block_actor yet
           vector<SuccessorNode> succSv;
           succSv.push_back(succS);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,succSv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,succSv));
         }
       }
       //add block_actor->send_actor to state of SSE
-      ch_state[block_actor*n_msagActors+send_actor] = succS.max_tok;
-      actor_delay[block_actor] = sendingLatency[i].min();
-      actor_delay[send_actor] = sendingTime[i].min();
+      w.ch_state[block_actor*n_msagActors+send_actor] = succS.max_tok;
+      w.actor_delay[block_actor] = sendingLatency[i].min();
+      w.actor_delay[send_actor] = sendingTime[i].min();
 
       //add the block actor as successor of the send actor, with one token (serialization)
       SuccessorNode succBS;
@@ -293,19 +293,19 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){//send actor already has an entry in the map
-          msaGraph.at(send_actor).push_back(succBS);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){//send actor already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(succBS);
         }else{//no entry for send_actor yet
           vector<SuccessorNode> succBSv;
           succBSv.push_back(succBS);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,succBSv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,succBSv));
         }
       }
       //add send_actor -> block_actor to state of SSE
-      ch_state[send_actor*n_msagActors+block_actor] = succBS.max_tok;
-      actor_delay[send_actor] = sendingTime[i].min();
-      actor_delay[block_actor] = sendingLatency[i].min();
+      w.ch_state[send_actor*n_msagActors+block_actor] = succBS.max_tok;
+      w.actor_delay[send_actor] = sendingTime[i].min();
+      w.actor_delay[block_actor] = sendingLatency[i].min();
       //###
       //add receiving actor as successor of the send actor, with potential initial tokens
       SuccessorNode dstCh;
@@ -318,25 +318,25 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(send_actor).push_back(dstCh);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(dstCh);
         }else{//no entry for i yet
           vector<SuccessorNode> dstChv;
           dstChv.push_back(dstCh);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,dstChv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,dstChv));
         }
       }
       //add send_actor->rec_actor to state of SSE
-      ch_state[send_actor*n_msagActors+rec_actor] = dstCh.max_tok;
-      actor_delay[send_actor] = sendingTime[i].min();
-      actor_delay[rec_actor] = receivingTime[i].min();
+      w.ch_state[send_actor*n_msagActors+rec_actor] = dstCh.max_tok;
+      w.actor_delay[send_actor] = sendingTime[i].min();
+      w.actor_delay[rec_actor] = receivingTime[i].min();
      
       //save the receiving actors for each actor (for next order)
-      if(receivingActors[ch_dst[i]]==-1){ //first rec_actor for the dst
-        receivingActors[ch_dst[i]] = rec_actor;
+      if(w.receivingActors[ch_dst[i]]==-1){ //first rec_actor for the dst
+        w.receivingActors[ch_dst[i]] = rec_actor;
       }else{
-        int curRec_actor_ch = channelMapping[receivingActors[ch_dst[i]]-n_actors];
+        int curRec_actor_ch = w.channelMapping[w.receivingActors[ch_dst[i]]-n_actors];
         
         //debug
         if(curRec_actor_ch < 0 || curRec_actor_ch >= receivingNext.size()) {
@@ -346,23 +346,23 @@ void ThroughputSSE::debug_constructMSAG(){
         if(receivingNext[curRec_actor_ch].assigned()){
           if(receivingNext[curRec_actor_ch].val()<n_channels){
             if(ch_dst[receivingNext[curRec_actor_ch].val()]!=ch_dst[i]){ //last rec_actor for this dst
-              receivingActors[ch_dst[i]] = rec_actor;
+              w.receivingActors[ch_dst[i]] = rec_actor;
             }//else
           }else{ //last rec_actor for this dst
-            receivingActors[ch_dst[i]] = rec_actor;
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
         
         //debug
-        if(channelMapping[rec_actor-n_actors] < 0 || channelMapping[rec_actor-n_actors] >= receivingNext.size()) {
-          cout << "receivingNext[channelMapping[rec_actor-n_actors]] with" << endl; 
-          cout << "  channelMapping[rec_actor-n_actors] = " << channelMapping[rec_actor-n_actors] << endl; 
+        if(w.channelMapping[rec_actor-n_actors] < 0 || w.channelMapping[rec_actor-n_actors] >= receivingNext.size()) {
+          cout << "receivingNext[w.channelMapping[rec_actor-n_actors]] with" << endl; 
+          cout << "  w.channelMapping[rec_actor-n_actors] = " << w.channelMapping[rec_actor-n_actors] << endl; 
           cout << "  rec_actor-n_actors = " << rec_actor-n_actors << endl; 
         }
         
-        if(receivingNext[channelMapping[rec_actor-n_actors]].assigned()){
-          if(receivingNext[channelMapping[rec_actor-n_actors]].val() == receivingActors[ch_dst[i]]){
-            receivingActors[ch_dst[i]] = rec_actor;  
+        if(receivingNext[w.channelMapping[rec_actor-n_actors]].assigned()){
+          if(receivingNext[w.channelMapping[rec_actor-n_actors]].val() == w.receivingActors[ch_dst[i]]){
+            w.receivingActors[ch_dst[i]] = rec_actor;  
           }
         }
       }
@@ -377,19 +377,19 @@ void ThroughputSSE::debug_constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(rec_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(rec_actor).push_back(succRec);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(rec_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(rec_actor).push_back(succRec);
         }else{//no entry for i yet
           vector<SuccessorNode> succRecv;
           succRecv.push_back(succRec);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(rec_actor,succRecv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(rec_actor,succRecv));
         }
       }
       //add rec_actor->send_actor to state of SSE
-      ch_state[rec_actor*n_msagActors+send_actor] = succRec.max_tok;
-      actor_delay[rec_actor] = receivingTime[i].min();
-      actor_delay[send_actor] = sendingTime[i].min();
+      w.ch_state[rec_actor*n_msagActors+send_actor] = succRec.max_tok;
+      w.actor_delay[rec_actor] = receivingTime[i].min();
+      w.actor_delay[send_actor] = sendingTime[i].min();
       
       
       channel_count += 3;
@@ -407,40 +407,40 @@ void ThroughputSSE::debug_constructMSAG(){
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-          if(it != msaGraph.end()){//i already has an entry in the map
-            msaGraph.at(ch_src[i]).push_back(dst);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+          if(it != w.msaGraph.end()){//i already has an entry in the map
+            w.msaGraph.at(ch_src[i]).push_back(dst);
           }else{//no entry for i yet
             vector<SuccessorNode> dstv;
             dstv.push_back(dst);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],dstv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],dstv));
           }
         }
         //add ch_src[i]->ch_dst[i] to state of SSE
-        ch_state[ch_src[i]*n_msagActors+ch_dst[i]] = tok[i];
-        actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
-        actor_delay[ch_dst[i]] = wcet[ch_dst[i]].min();
+        w.ch_state[ch_src[i]*n_msagActors+ch_dst[i]] = tok[i];
+        w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+        w.actor_delay[ch_dst[i]] = wcet[ch_dst[i]].min();
       }
     }
   }
   /* 
-     for (auto i=0; i<receivingActors.size(); i++){ 
-     cout << receivingActors[i] << " ";
+     for (auto i=0; i<w.receivingActors.size(); i++){ 
+     cout << w.receivingActors[i] << " ";
      }
      cout << endl;*/
   
   /*
-    cout << "channelMapping.size() = " << channelMapping.size() << endl;
-    for (auto i=0; i<channelMapping.size(); i+=3){ 
-    cout << channelMapping[i] << " ";
+    cout << "w.channelMapping.size() = " << w.channelMapping.size() << endl;
+    for (auto i=0; i<w.channelMapping.size(); i+=3){ 
+    cout << w.channelMapping[i] << " ";
     }
     cout << endl;*/
   //put sendNext relations into the MSAG
-  for (size_t i=1; i<channelMapping.size(); i+=3){ //for all sending actors
+  for (size_t i=1; i<w.channelMapping.size(); i+=3){ //for all sending actors
     bool continues = true;
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     int tokens = 0; //is channel to add a cycle-closing back-edge?
     while(!nextFound && continues){
       
@@ -497,7 +497,7 @@ void ThroughputSSE::debug_constructMSAG(){
     }
     if(nextFound){
       //add send_actor of channel i -> block_actor of nextCh
-      if(channelMapping[i]!=nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
+      if(w.channelMapping[i]!=nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
         int block_actor = getBlockActor(nextCh);  
         
         //cout << "Next channel (send_actor of channel " << i << "): " << nextCh << endl;
@@ -517,28 +517,28 @@ void ThroughputSSE::debug_constructMSAG(){
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i+n_actors);
-          if(it != msaGraph.end()){//send actor already has an entry in the map
-            msaGraph.at(i+n_actors).push_back(succBS);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i+n_actors);
+          if(it != w.msaGraph.end()){//send actor already has an entry in the map
+            w.msaGraph.at(i+n_actors).push_back(succBS);
           }else{//no entry for send_actor i yet
             vector<SuccessorNode> succBSv;
             succBSv.push_back(succBS);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succBSv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succBSv));
           }
         }
         //add i -> block_actor to state of SSE
-        ch_state[(i+n_actors)*n_msagActors+block_actor] = succBS.max_tok;
-        actor_delay[i+n_actors] = sendingTime[channelMapping[i]].min();
-        actor_delay[block_actor] = sendingLatency[nextCh].min();
+        w.ch_state[(i+n_actors)*n_msagActors+block_actor] = succBS.max_tok;
+        w.actor_delay[i+n_actors] = sendingTime[w.channelMapping[i]].min();
+        w.actor_delay[block_actor] = sendingLatency[nextCh].min();
       }
     }
   }
   
   //put recNext relations into the MSAG
-  for (size_t i=2; i<channelMapping.size(); i+=3){ //for all receiving actors
+  for (size_t i=2; i<w.channelMapping.size(); i+=3){ //for all receiving actors
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     
     //cout << "looking for recNext, channel " << i << endl;
     
@@ -551,11 +551,11 @@ void ThroughputSSE::debug_constructMSAG(){
       if(receivingNext[x].assigned()){
         nextCh = receivingNext[x].val();
         if(nextCh >= n_channels){ //end of chain found
-          nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
           nextFound = true;
         }else{ //not end of chain (nextCh < n_channels)
-          if(ch_dst[nextCh]!=ch_dst[channelMapping[i]]){ //next rec actor belongs to other dst
-            nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          if(ch_dst[nextCh]!=ch_dst[w.channelMapping[i]]){ //next rec actor belongs to other dst
+            nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
             nextFound = true;
           }else{ //same dst
             
@@ -571,7 +571,7 @@ void ThroughputSSE::debug_constructMSAG(){
           }
         }
       }else{
-        nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+        nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
         nextFound = true;
       }
     }
@@ -580,8 +580,8 @@ void ThroughputSSE::debug_constructMSAG(){
     //cout << "  found " << nextCh;
     
     SuccessorNode succRec;
-    succRec.successor_key = nextCh==-1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh);
-    succRec.delay = nextCh==-1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min();
+    succRec.successor_key = nextCh==-1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh);
+    succRec.delay = nextCh==-1 ? wcet[ch_dst[w.channelMapping[i]]].min() : receivingTime[nextCh].min();
     succRec.min_tok = 0;
     succRec.max_tok = 0;
     if(nextCh != -1) succRec.channel = nextCh;
@@ -590,25 +590,25 @@ void ThroughputSSE::debug_constructMSAG(){
 
     n_msagChannels++;
     if(printDebug){
-      unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i+n_actors);
-      if(it != msaGraph.end()){//send actor already has an entry in the map
-        msaGraph.at(i+n_actors).push_back(succRec);
+      unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i+n_actors);
+      if(it != w.msaGraph.end()){//send actor already has an entry in the map
+        w.msaGraph.at(i+n_actors).push_back(succRec);
       }else{//no entry for send_actor i yet
         vector<SuccessorNode> succRecv;
         succRecv.push_back(succRec);
-        msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succRecv));
+        w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succRecv));
       }
     }
     //add i -> block_actor to state of SSE
-    ch_state[(i+n_actors)*n_msagActors+succRec.successor_key] = succRec.max_tok;
-    actor_delay[i+n_actors] = receivingTime[channelMapping[i]].min();
-    actor_delay[succRec.successor_key] = succRec.delay;
+    w.ch_state[(i+n_actors)*n_msagActors+succRec.successor_key] = succRec.max_tok;
+    w.actor_delay[i+n_actors] = receivingTime[w.channelMapping[i]].min();
+    w.actor_delay[succRec.successor_key] = succRec.delay;
   }
 
 
 
   for (auto i=0; i<n_actors; i++){
-    actor_delay[i] = wcet[i].min();
+    w.actor_delay[i] = wcet[i].min();
     //Step 2
     if(next[i].assigned() && next[i].val() < n_actors){ //if next[i] is decided, the forward edge goes from i to next[i]
       int nextActor = next[i].val();
@@ -616,7 +616,7 @@ void ThroughputSSE::debug_constructMSAG(){
       cout << "found: " << i << " -> " << nextActor << endl;
       //check whether nextActor has preceding rec_actor
       SuccessorNode nextA;
-      if(receivingActors[nextActor] == -1){
+      if(w.receivingActors[nextActor] == -1){
         //add edge i -> nextActor
         nextA.successor_key = nextActor;
         
@@ -629,34 +629,34 @@ void ThroughputSSE::debug_constructMSAG(){
         nextA.max_tok = 0; 
       }else{
         //add edge i -> receivingActor[nextActor]  
-        nextA.successor_key = receivingActors[nextActor];
+        nextA.successor_key = w.receivingActors[nextActor];
         
         //debug
-        if(channelMapping[receivingActors[nextActor]-n_actors] < 0 || channelMapping[receivingActors[nextActor]-n_actors] >= receivingTime.size()) {
-          cout << "receivingTime[channelMapping[receivingActors[nextActor]-n_actors]] with channelMapping[receivingActors[nextActor]-n_actors] = " << channelMapping[receivingActors[nextActor]-n_actors] << endl; 
+        if(w.channelMapping[w.receivingActors[nextActor]-n_actors] < 0 || w.channelMapping[w.receivingActors[nextActor]-n_actors] >= receivingTime.size()) {
+          cout << "receivingTime[w.channelMapping[w.receivingActors[nextActor]-n_actors]] with w.channelMapping[w.receivingActors[nextActor]-n_actors] = " << w.channelMapping[w.receivingActors[nextActor]-n_actors] << endl; 
         }
         
-        nextA.delay = receivingTime[channelMapping[receivingActors[nextActor]-n_actors]].min();
+        nextA.delay = receivingTime[w.channelMapping[w.receivingActors[nextActor]-n_actors]].min();
         nextA.min_tok = 0; 
         nextA.max_tok = 0; 
-        nextA.channel = channelMapping[receivingActors[nextActor]-n_actors];
+        nextA.channel = w.channelMapping[w.receivingActors[nextActor]-n_actors];
       }
  
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(i).push_back(nextA);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(i).push_back(nextA);
         }else{//no entry for i yet
           vector<SuccessorNode> nextAv;
           nextAv.push_back(nextA);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(i,nextAv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i,nextAv));
         }
       }
       //add i->nextA to state of SSE
-      ch_state[i*n_msagActors+nextA.successor_key] = nextA.max_tok;
-      actor_delay[i] = wcet[i].min();
-      actor_delay[nextA.successor_key] = nextA.delay;
+      w.ch_state[i*n_msagActors+nextA.successor_key] = nextA.max_tok;
+      w.actor_delay[i] = wcet[i].min();
+      w.actor_delay[nextA.successor_key] = nextA.delay;
         
     }else if(next[i].assigned() && next[i].val() >= n_actors){ //next[i]>=n_actors
       //Step 3: add cycle-closing edge on each proc
@@ -679,7 +679,7 @@ void ThroughputSSE::debug_constructMSAG(){
         
         //check whether firstActor has preceding rec_actor
         SuccessorNode first;
-        if(receivingActors[firstActor] == -1){
+        if(w.receivingActors[firstActor] == -1){
           //add edge i -> firstActor
           first.successor_key = firstActor;
           
@@ -694,46 +694,46 @@ void ThroughputSSE::debug_constructMSAG(){
           
           
           //add edge i -> receivingActor[firstActor]  
-          first.successor_key = receivingActors[firstActor];
+          first.successor_key = w.receivingActors[firstActor];
           
           //debug
-          if(channelMapping[receivingActors[firstActor]-n_actors] < 0 || channelMapping[receivingActors[firstActor]-n_actors] >= receivingTime.size()) {
+          if(w.channelMapping[w.receivingActors[firstActor]-n_actors] < 0 || w.channelMapping[w.receivingActors[firstActor]-n_actors] >= receivingTime.size()) {
             cout << "i: " << i << " next[i].val(): " << next[i].val() << " firstActor: " << oldFirstActor << endl;
-            cout << "receivingTime[channelMapping[receivingActors[firstActor]-n_actors]] " << endl;
-            cout << "  with channelMapping[receivingActors[firstActor]-n_actors] = " << channelMapping[receivingActors[firstActor]-n_actors] << endl; 
-            cout << "  and receivingActors[firstActor] = " << receivingActors[firstActor] << endl; 
+            cout << "receivingTime[w.channelMapping[w.receivingActors[firstActor]-n_actors]] " << endl;
+            cout << "  with w.channelMapping[w.receivingActors[firstActor]-n_actors] = " << w.channelMapping[w.receivingActors[firstActor]-n_actors] << endl; 
+            cout << "  and w.receivingActors[firstActor] = " << w.receivingActors[firstActor] << endl; 
             cout << "  and firstActor = " << firstActor << endl; 
             
-            cout << "  and receivingActors = ";
+            cout << "  and w.receivingActors = ";
             for(auto s=0; s<next.size(); s++){
               cout << "next[" << s << "] = " << next[s] << endl;
             }
-            for(size_t s=0; s<receivingActors.size(); s++){
-              cout << receivingActors[s] << " ";
+            for(size_t s=0; s<w.receivingActors.size(); s++){
+              cout << w.receivingActors[s] << " ";
             }
             cout << endl;
           }
-          first.delay = receivingTime[channelMapping[receivingActors[firstActor]-n_actors]].min();
+          first.delay = receivingTime[w.channelMapping[w.receivingActors[firstActor]-n_actors]].min();
           first.min_tok = 1; 
           first.max_tok = 1; 
-          first.channel = channelMapping[receivingActors[firstActor]-n_actors];
+          first.channel = w.channelMapping[w.receivingActors[firstActor]-n_actors];
         }
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-          if(it != msaGraph.end()){//i already has an entry in the map
-            msaGraph.at(i).push_back(first);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+          if(it != w.msaGraph.end()){//i already has an entry in the map
+            w.msaGraph.at(i).push_back(first);
           }else{//no entry for i yet
             vector<SuccessorNode> firstv;
             firstv.push_back(first);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(i,firstv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i,firstv));
           }
         }
         //add i->ch_first to state of SSE
-        ch_state[i*n_msagActors+first.successor_key] = first.max_tok;
-        actor_delay[i] = wcet[i].min();
-        actor_delay[first.successor_key] = first.delay;
+        w.ch_state[i*n_msagActors+first.successor_key] = first.max_tok;
+        w.actor_delay[i] = wcet[i].min();
+        w.actor_delay[first.successor_key] = first.delay;
       }
     }
   }
@@ -742,11 +742,11 @@ void ThroughputSSE::debug_constructMSAG(){
     /*cout << "initial state for SSE: " << endl;
       for (auto i=0; i<n_msagActors; i++){
       for (auto j=0; j<n_msagActors; j++){
-      if(ch_state[i*n_msagActors+j] != -1)
-      if(ch_state[i*n_msagActors+j]>10)
+      if(w.ch_state[i*n_msagActors+j] != -1)
+      if(w.ch_state[i*n_msagActors+j]>10)
       cout << "B ";
       else
-      cout << ch_state[i*n_msagActors+j] << " ";
+      cout << w.ch_state[i*n_msagActors+j] << " ";
       else
       cout << "X ";
       }
@@ -758,6 +758,7 @@ void ThroughputSSE::debug_constructMSAG(){
 
 
 void ThroughputSSE::constructMSAG(){
+  Workspace& w = workspace();
   if(printDebug) cout << "\tThroughputSSE::constructMSAG()" << endl;
 
   if(printDebug){
@@ -775,15 +776,15 @@ void ThroughputSSE::constructMSAG(){
     }
   }
   
-  msaGraph.clear();
-  ch_state.clear();
-  actor_delay.clear();
-  receivingActors.clear();
-  channelMapping.clear();
+  w.msaGraph.clear();
+  w.ch_state.clear();
+  w.actor_delay.clear();
+  w.receivingActors.clear();
+  w.channelMapping.clear();
   
-  ch_state.insert(ch_state.begin(), n_msagActors*n_msagActors, -1);
-  actor_delay.insert(actor_delay.begin(), n_msagActors, 0);
-  receivingActors.insert(receivingActors.begin(), n_actors, -1); //pre-fill with -1
+  w.ch_state.insert(w.ch_state.begin(), n_msagActors*n_msagActors, -1);
+  w.actor_delay.insert(w.actor_delay.begin(), n_msagActors, 0);
+  w.receivingActors.insert(w.receivingActors.begin(), n_actors, -1); //pre-fill with -1
 
   channel_count = 0;
   n_msagChannels = 0; //to count the number of channels in the MSAG
@@ -801,9 +802,9 @@ void ThroughputSSE::constructMSAG(){
       int send_actor = block_actor + 1;
       int rec_actor = send_actor + 1;
       //store mapping between block/send/rec_actor and channel i
-      channelMapping.push_back(i); //[block_actor] = i;
-      channelMapping.push_back(i); //[send_actor] = i;
-      channelMapping.push_back(i); //[rec_actor] = i;
+      w.channelMapping.push_back(i); //[block_actor] = i;
+      w.channelMapping.push_back(i); //[send_actor] = i;
+      w.channelMapping.push_back(i); //[rec_actor] = i;
       //add the block actor as a successor of ch_src[i]
       SuccessorNode succB;
       succB.successor_key = block_actor;
@@ -814,19 +815,19 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(ch_src[i]).push_back(succB);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(ch_src[i]).push_back(succB);
         }else{//no entry for ch_src[i] yet
           vector<SuccessorNode> succBv;
           succBv.push_back(succB);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],succBv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],succBv));
         }
       }
       //add ch_src[i]->block_actor to state of SSE
-      ch_state[ch_src[i]*n_msagActors+block_actor] = succB.max_tok;
-      actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
-      actor_delay[block_actor] = sendingLatency[i].min();
+      w.ch_state[ch_src[i]*n_msagActors+block_actor] = succB.max_tok;
+      w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+      w.actor_delay[block_actor] = sendingLatency[i].min();
 
       //add ch_src[i] as successor of the block actor, with buffer size as tokens
       SuccessorNode srcCh;
@@ -837,19 +838,19 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(block_actor).push_back(srcCh);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(srcCh);
         }else{//no entry for block_actor yet
           vector<SuccessorNode> srcChv;
           srcChv.push_back(srcCh);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,srcChv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,srcChv));
         }
       }
       //add block_actor->ch_src[i] to state of SSE
-      ch_state[block_actor*n_msagActors+ch_src[i]] = srcCh.max_tok;
-      actor_delay[block_actor] = sendingLatency[i].min();
-      actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+      w.ch_state[block_actor*n_msagActors+ch_src[i]] = srcCh.max_tok;
+      w.actor_delay[block_actor] = sendingLatency[i].min();
+      w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
       //###
       //add the send actor as a successor of the block actor
       SuccessorNode succS;
@@ -861,19 +862,19 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(block_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(block_actor).push_back(succS);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(block_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(block_actor).push_back(succS);
         }else{//no entry for block_actor yet
           vector<SuccessorNode> succSv;
           succSv.push_back(succS);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,succSv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(block_actor,succSv));
         }
       }
       //add block_actor->send_actor to state of SSE
-      ch_state[block_actor*n_msagActors+send_actor] = succS.max_tok;
-      actor_delay[block_actor] = sendingLatency[i].min();
-      actor_delay[send_actor] = sendingTime[i].min();
+      w.ch_state[block_actor*n_msagActors+send_actor] = succS.max_tok;
+      w.actor_delay[block_actor] = sendingLatency[i].min();
+      w.actor_delay[send_actor] = sendingTime[i].min();
 
       //add the block actor as successor of the send actor, with one token (serialization)
       SuccessorNode succBS;
@@ -885,19 +886,19 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){//send actor already has an entry in the map
-          msaGraph.at(send_actor).push_back(succBS);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){//send actor already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(succBS);
         }else{//no entry for send_actor yet
           vector<SuccessorNode> succBSv;
           succBSv.push_back(succBS);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,succBSv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,succBSv));
         }
       }
       //add send_actor -> block_actor to state of SSE
-      ch_state[send_actor*n_msagActors+block_actor] = succBS.max_tok;
-      actor_delay[send_actor] = sendingTime[i].min();
-      actor_delay[block_actor] = sendingLatency[i].min();
+      w.ch_state[send_actor*n_msagActors+block_actor] = succBS.max_tok;
+      w.actor_delay[send_actor] = sendingTime[i].min();
+      w.actor_delay[block_actor] = sendingLatency[i].min();
       //###
       //add receiving actor as successor of the send actor, with potential initial tokens
       SuccessorNode dstCh;
@@ -910,37 +911,37 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(send_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(send_actor).push_back(dstCh);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(send_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(send_actor).push_back(dstCh);
         }else{//no entry for i yet
           vector<SuccessorNode> dstChv;
           dstChv.push_back(dstCh);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,dstChv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(send_actor,dstChv));
         }
       }
       //add send_actor->rec_actor to state of SSE
-      ch_state[send_actor*n_msagActors+rec_actor] = dstCh.max_tok;
-      actor_delay[send_actor] = sendingTime[i].min();
-      actor_delay[rec_actor] = receivingTime[i].min();
+      w.ch_state[send_actor*n_msagActors+rec_actor] = dstCh.max_tok;
+      w.actor_delay[send_actor] = sendingTime[i].min();
+      w.actor_delay[rec_actor] = receivingTime[i].min();
      
       //save the receiving actors for each actor (for next order)
-      if(receivingActors[ch_dst[i]]==-1){ //first rec_actor for the dst
-        receivingActors[ch_dst[i]] = rec_actor;
+      if(w.receivingActors[ch_dst[i]]==-1){ //first rec_actor for the dst
+        w.receivingActors[ch_dst[i]] = rec_actor;
       }else{
-        int curRec_actor_ch = channelMapping[receivingActors[ch_dst[i]]-n_actors];
+        int curRec_actor_ch = w.channelMapping[w.receivingActors[ch_dst[i]]-n_actors];
         if(receivingNext[curRec_actor_ch].assigned()){
           if(receivingNext[curRec_actor_ch].val()<n_channels){
             if(ch_dst[receivingNext[curRec_actor_ch].val()]!=ch_dst[i]){ //last rec_actor for this dst
-              receivingActors[ch_dst[i]] = rec_actor;
+              w.receivingActors[ch_dst[i]] = rec_actor;
             }//else
           }else{ //last rec_actor for this dst
-            receivingActors[ch_dst[i]] = rec_actor;
+            w.receivingActors[ch_dst[i]] = rec_actor;
           }
         }
-        if(receivingNext[channelMapping[rec_actor-n_actors]].assigned()){
-          if(receivingNext[channelMapping[rec_actor-n_actors]].val() == receivingActors[ch_dst[i]]){
-            receivingActors[ch_dst[i]] = rec_actor;  
+        if(receivingNext[w.channelMapping[rec_actor-n_actors]].assigned()){
+          if(receivingNext[w.channelMapping[rec_actor-n_actors]].val() == w.receivingActors[ch_dst[i]]){
+            w.receivingActors[ch_dst[i]] = rec_actor;  
           }
         }
       }
@@ -955,19 +956,19 @@ void ThroughputSSE::constructMSAG(){
 
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(rec_actor);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(rec_actor).push_back(succRec);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(rec_actor);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(rec_actor).push_back(succRec);
         }else{//no entry for i yet
           vector<SuccessorNode> succRecv;
           succRecv.push_back(succRec);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(rec_actor,succRecv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(rec_actor,succRecv));
         }
       }
       //add rec_actor->send_actor to state of SSE
-      ch_state[rec_actor*n_msagActors+send_actor] = succRec.max_tok;
-      actor_delay[rec_actor] = receivingTime[i].min();
-      actor_delay[send_actor] = sendingTime[i].min();
+      w.ch_state[rec_actor*n_msagActors+send_actor] = succRec.max_tok;
+      w.actor_delay[rec_actor] = receivingTime[i].min();
+      w.actor_delay[send_actor] = sendingTime[i].min();
       
       
       channel_count += 3;
@@ -985,40 +986,40 @@ void ThroughputSSE::constructMSAG(){
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(ch_src[i]);
-          if(it != msaGraph.end()){//i already has an entry in the map
-            msaGraph.at(ch_src[i]).push_back(dst);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(ch_src[i]);
+          if(it != w.msaGraph.end()){//i already has an entry in the map
+            w.msaGraph.at(ch_src[i]).push_back(dst);
           }else{//no entry for i yet
             vector<SuccessorNode> dstv;
             dstv.push_back(dst);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],dstv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(ch_src[i],dstv));
           }
         }
         //add ch_src[i]->ch_dst[i] to state of SSE
-        ch_state[ch_src[i]*n_msagActors+ch_dst[i]] = tok[i];
-        actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
-        actor_delay[ch_dst[i]] = wcet[ch_dst[i]].min();
+        w.ch_state[ch_src[i]*n_msagActors+ch_dst[i]] = tok[i];
+        w.actor_delay[ch_src[i]] = wcet[ch_src[i]].min();
+        w.actor_delay[ch_dst[i]] = wcet[ch_dst[i]].min();
       }
     }
   }
   /* 
-     for (auto i=0; i<receivingActors.size(); i++){ 
-     cout << receivingActors[i] << " ";
+     for (auto i=0; i<w.receivingActors.size(); i++){ 
+     cout << w.receivingActors[i] << " ";
      }
      cout << endl;*/
   
   /*
-    cout << "channelMapping.size() = " << channelMapping.size() << endl;
-    for (auto i=0; i<channelMapping.size(); i+=3){ 
-    cout << channelMapping[i] << " ";
+    cout << "w.channelMapping.size() = " << w.channelMapping.size() << endl;
+    for (auto i=0; i<w.channelMapping.size(); i+=3){ 
+    cout << w.channelMapping[i] << " ";
     }
     cout << endl;*/
   //put sendNext relations into the MSAG
-  for (size_t i=1; i<channelMapping.size(); i+=3){ //for all sending actors
+  for (size_t i=1; i<w.channelMapping.size(); i+=3){ //for all sending actors
     bool continues = true;
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     int tokens = 0; //is channel to add a cycle-closing back-edge?
     while(!nextFound && continues){
       if(sendingNext[x].assigned()){
@@ -1054,7 +1055,7 @@ void ThroughputSSE::constructMSAG(){
     }
     if(nextFound){
       //add send_actor of channel i -> block_actor of nextCh
-      if(channelMapping[i]!=nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
+      if(w.channelMapping[i]!=nextCh){ //if found successor is not the channel's own block_actor (then it is already in the graph)
         int block_actor = getBlockActor(nextCh);  
         
         //cout << "Next channel (send_actor of channel " << i << "): " << nextCh << endl;
@@ -1068,28 +1069,28 @@ void ThroughputSSE::constructMSAG(){
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i+n_actors);
-          if(it != msaGraph.end()){//send actor already has an entry in the map
-            msaGraph.at(i+n_actors).push_back(succBS);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i+n_actors);
+          if(it != w.msaGraph.end()){//send actor already has an entry in the map
+            w.msaGraph.at(i+n_actors).push_back(succBS);
           }else{//no entry for send_actor i yet
             vector<SuccessorNode> succBSv;
             succBSv.push_back(succBS);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succBSv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succBSv));
           }
         }
         //add i -> block_actor to state of SSE
-        ch_state[(i+n_actors)*n_msagActors+block_actor] = succBS.max_tok;
-        actor_delay[i+n_actors] = sendingTime[channelMapping[i]].min();
-        actor_delay[block_actor] = sendingLatency[nextCh].min();
+        w.ch_state[(i+n_actors)*n_msagActors+block_actor] = succBS.max_tok;
+        w.actor_delay[i+n_actors] = sendingTime[w.channelMapping[i]].min();
+        w.actor_delay[block_actor] = sendingLatency[nextCh].min();
       }
     }
   }
   
   //put recNext relations into the MSAG
-  for (size_t i=2; i<channelMapping.size(); i+=3){ //for all receiving actors
+  for (size_t i=2; i<w.channelMapping.size(); i+=3){ //for all receiving actors
     bool nextFound = false;
     int nextCh;
-    int x = channelMapping[i];
+    int x = w.channelMapping[i];
     
     //cout << "looking for recNext, channel " << i << endl;
     
@@ -1097,11 +1098,11 @@ void ThroughputSSE::constructMSAG(){
       if(receivingNext[x].assigned()){
         nextCh = receivingNext[x].val();
         if(nextCh >= n_channels){ //end of chain found
-          nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
           nextFound = true;
         }else{ //not end of chain (nextCh < n_channels)
-          if(ch_dst[nextCh]!=ch_dst[channelMapping[i]]){ //next rec actor belongs to other dst
-            nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+          if(ch_dst[nextCh]!=ch_dst[w.channelMapping[i]]){ //next rec actor belongs to other dst
+            nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
             nextFound = true;
           }else{ //same dst
             if(sendingTime[nextCh].min()>0){
@@ -1112,7 +1113,7 @@ void ThroughputSSE::constructMSAG(){
           }
         }
       }else{
-        nextCh = -1; //nextCh = ch_dst[channelMapping[i]];
+        nextCh = -1; //nextCh = ch_dst[w.channelMapping[i]];
         nextFound = true;
       }
     }
@@ -1121,8 +1122,8 @@ void ThroughputSSE::constructMSAG(){
     //cout << "  found " << nextCh;
     
     SuccessorNode succRec;
-    succRec.successor_key = nextCh==-1 ? ch_dst[channelMapping[i]] : getRecActor(nextCh);
-    succRec.delay = nextCh==-1 ? wcet[ch_dst[channelMapping[i]]].min() : receivingTime[nextCh].min();
+    succRec.successor_key = nextCh==-1 ? ch_dst[w.channelMapping[i]] : getRecActor(nextCh);
+    succRec.delay = nextCh==-1 ? wcet[ch_dst[w.channelMapping[i]]].min() : receivingTime[nextCh].min();
     succRec.min_tok = 0;
     succRec.max_tok = 0;
     if(nextCh != -1) succRec.channel = nextCh;
@@ -1131,32 +1132,32 @@ void ThroughputSSE::constructMSAG(){
 
     n_msagChannels++;
     if(printDebug){
-      unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i+n_actors);
-      if(it != msaGraph.end()){//send actor already has an entry in the map
-        msaGraph.at(i+n_actors).push_back(succRec);
+      unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i+n_actors);
+      if(it != w.msaGraph.end()){//send actor already has an entry in the map
+        w.msaGraph.at(i+n_actors).push_back(succRec);
       }else{//no entry for send_actor i yet
         vector<SuccessorNode> succRecv;
         succRecv.push_back(succRec);
-        msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succRecv));
+        w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i+n_actors,succRecv));
       }
     }
     //add i -> block_actor to state of SSE
-    ch_state[(i+n_actors)*n_msagActors+succRec.successor_key] = succRec.max_tok;
-    actor_delay[i+n_actors] = receivingTime[channelMapping[i]].min();
-    actor_delay[succRec.successor_key] = succRec.delay;
+    w.ch_state[(i+n_actors)*n_msagActors+succRec.successor_key] = succRec.max_tok;
+    w.actor_delay[i+n_actors] = receivingTime[w.channelMapping[i]].min();
+    w.actor_delay[succRec.successor_key] = succRec.delay;
   }
 
 
 
   for (auto i=0; i<n_actors; i++){
-    actor_delay[i] = wcet[i].min();
+    w.actor_delay[i] = wcet[i].min();
     //Step 2
     if(next[i].assigned() && next[i].val() < n_actors){ //if next[i] is decided, the forward edge goes from i to next[i]
       int nextActor = next[i].val();
       
       //check whether nextActor has preceding rec_actor
       SuccessorNode nextA;
-      if(receivingActors[nextActor] == -1){
+      if(w.receivingActors[nextActor] == -1){
         //add edge i -> nextActor
         nextA.successor_key = nextActor;
         nextA.delay = wcet[nextActor].min();
@@ -1164,28 +1165,28 @@ void ThroughputSSE::constructMSAG(){
         nextA.max_tok = 0; 
       }else{
         //add edge i -> receivingActor[nextActor]  
-        nextA.successor_key = receivingActors[nextActor];
-        nextA.delay = receivingTime[channelMapping[receivingActors[nextActor]-n_actors]].min();
+        nextA.successor_key = w.receivingActors[nextActor];
+        nextA.delay = receivingTime[w.channelMapping[w.receivingActors[nextActor]-n_actors]].min();
         nextA.min_tok = 0; 
         nextA.max_tok = 0; 
-        nextA.channel = channelMapping[receivingActors[nextActor]-n_actors];
+        nextA.channel = w.channelMapping[w.receivingActors[nextActor]-n_actors];
       }
  
       n_msagChannels++;
       if(printDebug){
-        unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-        if(it != msaGraph.end()){//i already has an entry in the map
-          msaGraph.at(i).push_back(nextA);
+        unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+        if(it != w.msaGraph.end()){//i already has an entry in the map
+          w.msaGraph.at(i).push_back(nextA);
         }else{//no entry for i yet
           vector<SuccessorNode> nextAv;
           nextAv.push_back(nextA);
-          msaGraph.insert(pair<int,vector<SuccessorNode>>(i,nextAv));
+          w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i,nextAv));
         }
       }
       //add i->nextA to state of SSE
-      ch_state[i*n_msagActors+nextA.successor_key] = nextA.max_tok;
-      actor_delay[i] = wcet[i].min();
-      actor_delay[nextA.successor_key] = nextA.delay;
+      w.ch_state[i*n_msagActors+nextA.successor_key] = nextA.max_tok;
+      w.actor_delay[i] = wcet[i].min();
+      w.actor_delay[nextA.successor_key] = nextA.delay;
         
     }else if(next[i].assigned() && next[i].val() >= n_actors){ //next[i]>=n_actors
       //Step 3: add cycle-closing edge on each proc
@@ -1200,7 +1201,7 @@ void ThroughputSSE::constructMSAG(){
         
         //check whether firstActor has preceding rec_actor
         SuccessorNode first;
-        if(receivingActors[firstActor] == -1){
+        if(w.receivingActors[firstActor] == -1){
           //add edge i -> firstActor
           first.successor_key = firstActor;
           first.delay = wcet[firstActor].min();
@@ -1208,28 +1209,28 @@ void ThroughputSSE::constructMSAG(){
           first.max_tok = 1;  
         }else{
           //add edge i -> receivingActor[firstActor]  
-          first.successor_key = receivingActors[firstActor];
-          first.delay = receivingTime[channelMapping[receivingActors[firstActor]-n_actors]].min();
+          first.successor_key = w.receivingActors[firstActor];
+          first.delay = receivingTime[w.channelMapping[w.receivingActors[firstActor]-n_actors]].min();
           first.min_tok = 1; 
           first.max_tok = 1; 
-          first.channel = channelMapping[receivingActors[firstActor]-n_actors];
+          first.channel = w.channelMapping[w.receivingActors[firstActor]-n_actors];
         }
 
         n_msagChannels++;
         if(printDebug){
-          unordered_map<int,vector<SuccessorNode>>::const_iterator it = msaGraph.find(i);
-          if(it != msaGraph.end()){//i already has an entry in the map
-            msaGraph.at(i).push_back(first);
+          unordered_map<int,vector<SuccessorNode>>::const_iterator it = w.msaGraph.find(i);
+          if(it != w.msaGraph.end()){//i already has an entry in the map
+            w.msaGraph.at(i).push_back(first);
           }else{//no entry for i yet
             vector<SuccessorNode> firstv;
             firstv.push_back(first);
-            msaGraph.insert(pair<int,vector<SuccessorNode>>(i,firstv));
+            w.msaGraph.insert(pair<int,vector<SuccessorNode>>(i,firstv));
           }
         }
         //add i->ch_first to state of SSE
-        ch_state[i*n_msagActors+first.successor_key] = first.max_tok;
-        actor_delay[i] = wcet[i].min();
-        actor_delay[first.successor_key] = first.delay;
+        w.ch_state[i*n_msagActors+first.successor_key] = first.max_tok;
+        w.actor_delay[i] = wcet[i].min();
+        w.actor_delay[first.successor_key] = first.delay;
       }
     }
   }
@@ -1238,11 +1239,11 @@ void ThroughputSSE::constructMSAG(){
     /*cout << "initial state for SSE: " << endl;
       for (auto i=0; i<n_msagActors; i++){
       for (auto j=0; j<n_msagActors; j++){
-      if(ch_state[i*n_msagActors+j] != -1)
-      if(ch_state[i*n_msagActors+j]>10)
+      if(w.ch_state[i*n_msagActors+j] != -1)
+      if(w.ch_state[i*n_msagActors+j]>10)
       cout << "B ";
       else
-      cout << ch_state[i*n_msagActors+j] << " ";
+      cout << w.ch_state[i*n_msagActors+j] << " ";
       else
       cout << "X ";
       }
@@ -1253,13 +1254,20 @@ void ThroughputSSE::constructMSAG(){
 }
 
 
-ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
+ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta& med){
+  tools::PropTimer timer(profileKind);
+  return timer.done(filter(home, med));
+}
+
+ExecStatus ThroughputSSE::filter(Space& home, const ModEventDelta&){
+  Workspace& w = workspace();
   if(printDebug) cout << "\tThroughputSSE::propagate()" << endl;
   // auto _start = std::chrono::high_resolution_clock::now(); //timer
   // int time; //runtime of period calculation
   
   constructMSAG();
   calls++;
+  tools::PropStats::msag(profileKind, n_msagActors, n_msagChannels);
   
   //debug_constructMSAG();
   
@@ -1273,11 +1281,11 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
       cout << "initial state for SSE: " << endl;
       for (auto i=0; i<n_msagActors; i++){
       for (auto j=0; j<n_msagActors; j++){
-      if(ch_state[i*n_msagActors+j] != -1)
-      if(ch_state[i*n_msagActors+j]>10)
+      if(w.ch_state[i*n_msagActors+j] != -1)
+      if(w.ch_state[i*n_msagActors+j]>10)
       cout << "B ";
       else
-      cout << ch_state[i*n_msagActors+j] << " ";
+      cout << w.ch_state[i*n_msagActors+j] << " ";
       else
       cout << "X ";
       }
@@ -1289,7 +1297,7 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
       }*/
   /*cout << endl;
     for (auto i=0; i<n_msagActors; i++){
-    cout << actor_delay[i] << " ";
+    cout << w.actor_delay[i] << " ";
     }
     cout << endl;*/
   
@@ -1311,45 +1319,45 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
       cout << wc_period[apps.size()-1] << endl;
       cout << "min/max iterations: ";
       for (auto i=0; i<n_actors-1; i++){
-      cout << min_iterations[i] << "/" << max_iterations[i] << ", ";  
+      cout << w.min_iterations[i] << "/" << w.max_iterations[i] << ", ";  
     
       }
-      cout << min_iterations[n_actors-1] << "/" << max_iterations[n_actors-1] << endl;
+      cout << w.min_iterations[n_actors-1] << "/" << w.max_iterations[n_actors-1] << endl;
       cout << "max timed schedule: " << endl;
       for (auto i=0; i<n_actors; i++){
       cout << i << ": ";
-      for (auto j=0; j<max_end[i].size(); j++){
-      cout << "[" << max_start[i][j] << ", " << max_end[i][j] << "] ";
+      for (auto j=0; j<w.max_end[i].size(); j++){
+      cout << "[" << w.max_start[i][j] << ", " << w.max_end[i][j] << "] ";
       }
-      //cout << "||  [" << start_pp[i] << ", " << end_pp[i] << "] ";
+      //cout << "||  [" << w.start_pp[i] << ", " << w.end_pp[i] << "] ";
       cout << endl;
       }
       cout << "max timed schedule for channels: " << endl;
-      for (auto i=n_actors; i<max_end.size(); i++){
+      for (auto i=n_actors; i<w.max_end.size(); i++){
       cout << i << ": ";
-      for (auto j=0; j<max_end[i].size(); j++){
-      cout << "[" << max_start[i][j] << ", " << max_end[i][j] << "] ";
+      for (auto j=0; j<w.max_end[i].size(); j++){
+      cout << "[" << w.max_start[i][j] << ", " << w.max_end[i][j] << "] ";
       }
-      //cout << "||  [" << start_pp[i] << ", " << end_pp[i] << "] ";
+      //cout << "||  [" << w.start_pp[i] << ", " << w.end_pp[i] << "] ";
       cout << endl;
       }
   
       cout << "min timed schedule: " << endl;
       for (auto i=0; i<n_actors; i++){
       cout << i << ": ";
-      for (auto j=0; j<min_end[i].size(); j++){
-      cout << "[" << min_start[i][j] << ", " << min_end[i][j] << "] ";
+      for (auto j=0; j<w.min_end[i].size(); j++){
+      cout << "[" << w.min_start[i][j] << ", " << w.min_end[i][j] << "] ";
       }
-      //cout << "||  [" << start_pp[i] << ", " << end_pp[i] << "] ";
+      //cout << "||  [" << w.start_pp[i] << ", " << w.end_pp[i] << "] ";
       cout << endl;
       }
       cout << "min timed schedule for channels: " << endl;
-      for (auto i=n_actors; i<min_end.size(); i++){
+      for (auto i=n_actors; i<w.min_end.size(); i++){
       cout << i << ": ";
-      for (auto j=0; j<min_end[i].size(); j++){
-      cout << "[" << min_start[i][j] << ", " << min_end[i][j] << "] ";
+      for (auto j=0; j<w.min_end[i].size(); j++){
+      cout << "[" << w.min_start[i][j] << ", " << w.min_end[i][j] << "] ";
       }
-      //cout << "||  [" << start_pp[i] << ", " << end_pp[i] << "] ";
+      //cout << "||  [" << w.start_pp[i] << ", " << w.end_pp[i] << "] ";
       cout << endl;
       }
   */
@@ -1415,16 +1423,16 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   /*  
   //propagate bounds on iterations of entities and channels in time-based schedule
   for (auto i=0; i<n_actors; i++){
-  //if(next.assigned())GECODE_ME_CHECK(iterations[i].gq(home,min_iterations[i]));
-  //if(all_assigned)GECODE_ME_CHECK(iterations[i].gq(home,min_iterations[i]));
-  if(all_assigned)GECODE_ME_CHECK(iterations[i].lq(home,max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
+  //if(next.assigned())GECODE_ME_CHECK(iterations[i].gq(home,w.min_iterations[i]));
+  //if(all_assigned)GECODE_ME_CHECK(iterations[i].gq(home,w.min_iterations[i]));
+  if(all_assigned)GECODE_ME_CHECK(iterations[i].lq(home,w.max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
   }
   for (auto i=n_actors; i<n_msagActors; i++){
   //for now, only consider the sending part for each channel
   if((i-n_actors)%2==0){
-  //if(next.assigned())GECODE_ME_CHECK(iterationsCh[channelMapping[i]].gq(home,min_iterations[i]));
-  //if(all_assigned)GECODE_ME_CHECK(iterationsCh[channelMapping[i]].gq(home,min_iterations[i]));
-  if(all_assigned)GECODE_ME_CHECK(iterationsCh[channelMapping[i]].lq(home,max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
+  //if(next.assigned())GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].gq(home,w.min_iterations[i]));
+  //if(all_assigned)GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].gq(home,w.min_iterations[i]));
+  if(all_assigned)GECODE_ME_CHECK(iterationsCh[w.channelMapping[i]].lq(home,w.max_iterations[i])); //upper bound can increase from "no mapping" until "fixed mapping" (due to added communication delays)
   }
   }
 
@@ -1433,17 +1441,17 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   for (auto i=0; i<n_msagActors; i++){
   if(i<n_actors){
   //transient phase
-  vector<int>::iterator its_min = min_start[i].begin();
-  vector<int>::iterator ite_min = min_end[i].begin();
-  vector<int>::iterator its_max = max_start[i].begin();
-  vector<int>::iterator ite_max = max_end[i].begin();
+  vector<int>::iterator its_min = w.min_start[i].begin();
+  vector<int>::iterator ite_min = w.min_end[i].begin();
+  vector<int>::iterator its_max = w.max_start[i].begin();
+  vector<int>::iterator ite_max = w.max_end[i].begin();
   for (auto j=minIndices[i]; j<=maxIndices[i]; j++){
-  if(its_min!=min_start[i].end()){
+  if(its_min!=w.min_start[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_start[j].lq(home, *its_min));
   if(sendingLatency.assigned())GECODE_ME_CHECK(timedSched_start[j].gq(home, *its_max));
   its_min++;
   its_max++;
-  }else if(its_max!=max_start[i].end()){
+  }else if(its_max!=w.max_start[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_start[j].lq(home, wc_latency-wcet[i].min()));
   IntVarImp _range(home, 0, (*its_max)-1);
   IntView rangeView(&_range);
@@ -1453,12 +1461,12 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   }else{
   if(all_assigned)GECODE_ME_CHECK(timedSched_start[j].eq(home, -1));
   }
-  if(ite_min!=min_end[i].end()){
+  if(ite_min!=w.min_end[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_end[j].lq(home, *ite_min));
   if(sendingLatency.assigned())GECODE_ME_CHECK(timedSched_end[j].gq(home, *ite_max));
   ite_min++;
   ite_max++;
-  }else if(ite_max!=max_end[i].end()){
+  }else if(ite_max!=w.max_end[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_end[j].lq(home, wc_latency));
   IntVarImp _range(home, 0, (*ite_max)-1);
   IntView rangeView(&_range);
@@ -1470,24 +1478,24 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   }
   }
   //periodic phase
-  GECODE_ME_CHECK(periodicSched_start[i].gq(home, start_pp[i]));
-  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_start[i].lq(home, end_pp[i]-wcet[i].min()));
-  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_end[i].lq(home, end_pp[i]));
-  GECODE_ME_CHECK(periodicSched_end[i].gq(home, start_pp[i]+wcet[i].min()));
+  GECODE_ME_CHECK(periodicSched_start[i].gq(home, w.start_pp[i]));
+  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_start[i].lq(home, w.end_pp[i]-wcet[i].min()));
+  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_end[i].lq(home, w.end_pp[i]));
+  GECODE_ME_CHECK(periodicSched_end[i].gq(home, w.start_pp[i]+wcet[i].min()));
   }else if(i>=n_actors && (i-n_actors)%2==0){ //sending node
-  int ch = channelMapping[i]; //id of channel
+  int ch = w.channelMapping[i]; //id of channel
   //transient phase
-  vector<int>::iterator its_min = min_start[i].begin();
-  vector<int>::iterator ite_min = min_end[i].begin();
-  vector<int>::iterator its_max = max_start[i].begin();
-  vector<int>::iterator ite_max = max_end[i].begin();
+  vector<int>::iterator its_min = w.min_start[i].begin();
+  vector<int>::iterator ite_min = w.min_end[i].begin();
+  vector<int>::iterator its_max = w.max_start[i].begin();
+  vector<int>::iterator ite_max = w.max_end[i].begin();
   for (auto j=minIndices[n_actors+ch]; j<=maxIndices[n_actors+ch]; j++){
-  if(its_min!=min_start[i].end()){
+  if(its_min!=w.min_start[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_IC_start[j].lq(home, *its_min));
   if(sendingLatency.assigned())GECODE_ME_CHECK(timedSched_IC_start[j].gq(home, *its_max));
   its_min++;
   its_max++;
-  }else if(its_max!=max_start[i].end()){
+  }else if(its_max!=w.max_start[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_IC_start[j].lq(home, wc_latency-sendingTime[ch].min()-sendingLatency[ch].min()));
   IntVarImp _range(home, 0, (*its_max)-1);
   IntView rangeView(&_range);
@@ -1498,12 +1506,12 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   if(all_assigned)GECODE_ME_CHECK(timedSched_IC_start[j].eq(home, -1));
   if(latency.assigned())GECODE_ME_CHECK(timedSched_IC_start[j].lq(home, wc_latency-sendingTime[ch].min()-sendingLatency[ch].min()));
   }
-  if(ite_min!=min_end[i].end()){
+  if(ite_min!=w.min_end[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_IC_end[j].lq(home, *ite_min));
   if(sendingLatency.assigned())GECODE_ME_CHECK(timedSched_IC_end[j].gq(home, *ite_max));
   ite_min++;
   ite_max++;
-  }else if(ite_max!=max_end[i].end()){
+  }else if(ite_max!=w.max_end[i].end()){
   if(latency.assigned())GECODE_ME_CHECK(timedSched_IC_end[j].lq(home, wc_latency));
   IntVarImp _range(home, 0, (*ite_max)-1);
   IntView rangeView(&_range);
@@ -1516,10 +1524,10 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   }
   }
   //periodic phase
-  GECODE_ME_CHECK(periodicSched_IC_start[ch].gq(home, start_pp[i]));
-  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_IC_start[ch].lq(home, end_pp[i]-sendingTime[ch].min()-sendingLatency[ch].min()));
-  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_IC_end[ch].lq(home, end_pp[i]));
-  GECODE_ME_CHECK(periodicSched_IC_end[ch].gq(home, start_pp[i]+sendingTime[ch].min()+sendingLatency[ch].min()));
+  GECODE_ME_CHECK(periodicSched_IC_start[ch].gq(home, w.start_pp[i]));
+  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_IC_start[ch].lq(home, w.end_pp[i]-sendingTime[ch].min()-sendingLatency[ch].min()));
+  if(latency.assigned() && period.assigned())GECODE_ME_CHECK(periodicSched_IC_end[ch].lq(home, w.end_pp[i]));
+  GECODE_ME_CHECK(periodicSched_IC_end[ch].gq(home, w.start_pp[i]+sendingTime[ch].min()+sendingLatency[ch].min()));
   }
   }
   }
@@ -1552,8 +1560,8 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
       bool schedFixed = true;
       for (auto i=0; i<ch_src.size(); i++){
       if(sendingTime[i].max() + sendingLatency[i].max() != 0 &&
-      (min_send_buffer[i] < max_send_buffer[i] ||
-      min_rec_buffer[i] < max_rec_buffer[i])){
+      (w.min_send_buffer[i] < w.max_send_buffer[i] ||
+      w.min_rec_buffer[i] < w.max_rec_buffer[i])){
       int bufferSz_send = 0;
       int bufferSz_rec = 0;
       int max_send = 0;
@@ -1611,36 +1619,36 @@ ExecStatus ThroughputSSE::propagate(Space& home, const ModEventDelta&){
   /*
     if(timedSched_start.size()>0){
     for (auto i=0; i<ch_src.size(); i++){
-    GECODE_ME_CHECK(sendbufferSz[i].gq(home, min_send_buffer[i]));
-    GECODE_ME_CHECK(recbufferSz[i].gq(home, min_rec_buffer[i]));
+    GECODE_ME_CHECK(sendbufferSz[i].gq(home, w.min_send_buffer[i]));
+    GECODE_ME_CHECK(recbufferSz[i].gq(home, w.min_rec_buffer[i]));
     //if(sendingTime.assigned() && sendingLatency.assigned() &&
     //   receivingTime.assigned() && receivingNext.assigned()){*/
   /*if(all_assigned){
-    GECODE_ME_CHECK(sendbufferSz[i].lq(home, max_send_buffer[i]));
-    GECODE_ME_CHECK(recbufferSz[i].lq(home, max_rec_buffer[i]));
+    GECODE_ME_CHECK(sendbufferSz[i].lq(home, w.max_send_buffer[i]));
+    GECODE_ME_CHECK(recbufferSz[i].lq(home, w.max_rec_buffer[i]));
     }*/
   /*    }
         }
   */
 
-  msaGraph.clear();
-  channelMapping.clear();
-  receivingActors.clear();
-  ch_state.clear();
-  actor_delay.clear();
-
-  max_start.clear();
-  max_end.clear();
-  min_start.clear();
-  min_end.clear();
-  start_pp.clear();
-  end_pp.clear();
-  min_iterations.clear();
-  max_iterations.clear();
-  min_send_buffer.clear();
-  max_send_buffer.clear();
-  min_rec_buffer.clear();
-  max_rec_buffer.clear();
+  w.msaGraph.clear();
+  w.channelMapping.clear();
+  w.receivingActors.clear();
+  w.ch_state.clear();
+  w.actor_delay.clear();
+
+  w.max_start.clear();
+  w.max_end.clear();
+  w.min_start.clear();
+  w.min_end.clear();
+  w.start_pp.clear();
+  w.end_pp.clear();
+  w.min_iterations.clear();
+  w.max_iterations.clear();
+  w.min_send_buffer.clear();
+  w.max_send_buffer.clear();
+  w.min_rec_buffer.clear();
+  w.max_rec_buffer.clear();
 
   if(next.assigned() &&
      wcet.assigned() &&
@@ -1978,34 +1986,38 @@ void throughputSSE(Space& home, const IntVarArgs& latency,
 }
 
 int ThroughputSSE::getBlockActor(int ch_id) const{
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it)+n_actors;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it)+n_actors;
     
   return -1;
 }
 
 int ThroughputSSE::getSendActor(int ch_id) const{
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it)+n_actors+1;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it)+n_actors+1;
     
   return -1;
 }
 
 int ThroughputSSE::getRecActor(int ch_id) const{
-  auto it = find(channelMapping.begin(), channelMapping.end(), ch_id);
-  if(it != channelMapping.end())
-    return distance(channelMapping.begin(), it)+n_actors+2;
+  Workspace& w = workspace();
+  auto it = find(w.channelMapping.begin(), w.channelMapping.end(), ch_id);
+  if(it != w.channelMapping.end())
+    return distance(w.channelMapping.begin(), it)+n_actors+2;
     
   return -1;
 }
 
 
 int ThroughputSSE::getApp(int msagActor_id) const{
+  Workspace& w = workspace();
   int id = msagActor_id;
   if(msagActor_id >= n_actors){
-    id = ch_dst[channelMapping[msagActor_id-n_actors]];
+    id = ch_dst[w.channelMapping[msagActor_id-n_actors]];
   }
   for (auto i=0; i<apps.size(); i++){
     if(id<=apps[i]) return i;
@@ -2018,13 +2030,14 @@ int ThroughputSSE::getApp(int msagActor_id) const{
  * execution times stored in: vector<int> actor_delay
  */
 void ThroughputSSE::stateSpaceExploration(){
+  Workspace& w = workspace();
   if(printDebug) cout << "\tThroughputSSE::stateSpaceExploration()" << endl;
   //for checking whether all actors have had two iterations
   int minIterations=0;
   //for checking whether min-schedule needs to be done
   int maxIterations=2;
   //for saving the states during SSE
-  vector<int> tokens(ch_state);
+  vector<int> tokens(w.ch_state);
   vector<int> execution;
   execution.insert(execution.begin(), n_msagActors, -1);
   //for passing time
@@ -2036,7 +2049,7 @@ void ThroughputSSE::stateSpaceExploration(){
   //Step 0: Flip the MSAG (mirror on diagonal)
   for (auto i=0; i<n_msagActors; i++){
     for (auto j=0; j<n_msagActors; j++){
-      ch_state_flipped[j*n_msagActors+i] = ch_state[i*n_msagActors+j];
+      ch_state_flipped[j*n_msagActors+i] = w.ch_state[i*n_msagActors+j];
     }
   }
   /*  for (auto i=0; i<n_msagActors; i++){
@@ -2055,32 +2068,32 @@ void ThroughputSSE::stateSpaceExploration(){
   //Initialize (initial state already set in function propagate)
   wc_latency.clear();
   //vector<int> period_minSched(apps.size(), 0);
-  max_start.clear();
-  max_end.clear();
-  min_start.clear();
-  min_end.clear();
-  start_pp.clear();
-  end_pp.clear();
-  min_iterations.clear();
-  max_iterations.clear();
+  w.max_start.clear();
+  w.max_end.clear();
+  w.min_start.clear();
+  w.min_end.clear();
+  w.start_pp.clear();
+  w.end_pp.clear();
+  w.min_iterations.clear();
+  w.max_iterations.clear();
   wc_latency.insert(wc_latency.begin(), apps.size(), vector<int>());
-  max_start.insert(max_start.begin(), n_msagActors, vector<int>());
-  max_end.insert(max_end.begin(), n_msagActors, vector<int>());
-  min_start.insert(min_start.begin(), n_msagActors, vector<int>());
-  min_end.insert(min_end.begin(), n_msagActors, vector<int>());
-  start_pp.insert(start_pp.begin(), n_msagActors,0);
-  end_pp.insert(end_pp.begin(), n_msagActors, 0);
-  min_iterations.insert(min_iterations.begin(), n_msagActors, 0);
-  max_iterations.insert(max_iterations.begin(), n_msagActors, 0);
+  w.max_start.insert(w.max_start.begin(), n_msagActors, vector<int>());
+  w.max_end.insert(w.max_end.begin(), n_msagActors, vector<int>());
+  w.min_start.insert(w.min_start.begin(), n_msagActors, vector<int>());
+  w.min_end.insert(w.min_end.begin(), n_msagActors, vector<int>());
+  w.start_pp.insert(w.start_pp.begin(), n_msagActors,0);
+  w.end_pp.insert(w.end_pp.begin(), n_msagActors, 0);
+  w.min_iterations.insert(w.min_iterations.begin(), n_msagActors, 0);
+  w.max_iterations.insert(w.max_iterations.begin(), n_msagActors, 0);
   //for determining buffer bounds (send and receive)
-  min_send_buffer.clear();
-  max_send_buffer.clear();
-  min_rec_buffer.clear();
-  max_rec_buffer.clear();
-  min_send_buffer.insert(min_send_buffer.begin(), ch_src.size(), 0);
-  max_send_buffer.insert(max_send_buffer.begin(), ch_src.size(), 0);
-  min_rec_buffer.insert(min_rec_buffer.begin(), ch_src.size(), 0);
-  max_rec_buffer.insert(max_rec_buffer.begin(), ch_src.size(), 0);
+  w.min_send_buffer.clear();
+  w.max_send_buffer.clear();
+  w.min_rec_buffer.clear();
+  w.max_rec_buffer.clear();
+  w.min_send_buffer.insert(w.min_send_buffer.begin(), ch_src.size(), 0);
+  w.max_send_buffer.insert(w.max_send_buffer.begin(), ch_src.size(), 0);
+  w.min_rec_buffer.insert(w.min_rec_buffer.begin(), ch_src.size(), 0);
+  w.max_rec_buffer.insert(w.max_rec_buffer.begin(), ch_src.size(), 0);
   vector<int> sendBufferBound_max(ch_src.size(), 0);
   vector<int> recBufferBound_max(ch_src.size(), 0);
   vector<int> sendBufferBound_min(ch_src.size(), 0);
@@ -2112,29 +2125,29 @@ void ThroughputSSE::stateSpaceExploration(){
               if(minIterations<1){ //during the latency phase
                 //if i is a src and j a block actor, consider the send buffer
                 if(i<n_actors && j>=n_actors && (j-n_actors)%3 == 0){
-                  max_send_buffer[channelMapping[j-n_actors]]--;  
-                  if(max_send_buffer[channelMapping[j-n_actors]]<sendBufferBound_max[channelMapping[j-n_actors]])
-                    sendBufferBound_max[channelMapping[j-n_actors]] = max_send_buffer[channelMapping[j-n_actors]];
+                  w.max_send_buffer[w.channelMapping[j-n_actors]]--;  
+                  if(w.max_send_buffer[w.channelMapping[j-n_actors]]<sendBufferBound_max[w.channelMapping[j-n_actors]])
+                    sendBufferBound_max[w.channelMapping[j-n_actors]] = w.max_send_buffer[w.channelMapping[j-n_actors]];
                 }
                 //if i is a send actor and j a receive actor, consider the rec actor size
                 if(i>n_actors && j>n_actors && (i-n_actors)%3==1 && i+1==j){
-                  max_rec_buffer[channelMapping[i-n_actors]]--; 
-                  //cout << "a: Ch " << i << ": " << max_rec_buffer[channelMapping[i-n_actors]];
+                  w.max_rec_buffer[w.channelMapping[i-n_actors]]--; 
+                  //cout << "a: Ch " << i << ": " << w.max_rec_buffer[w.channelMapping[i-n_actors]];
                   //cout << " at time " << time << endl;
-                  if(max_rec_buffer[channelMapping[i-n_actors]]<recBufferBound_max[channelMapping[i-n_actors]])
-                    recBufferBound_max[channelMapping[i-n_actors]] = max_rec_buffer[channelMapping[i-n_actors]];
+                  if(w.max_rec_buffer[w.channelMapping[i-n_actors]]<recBufferBound_max[w.channelMapping[i-n_actors]])
+                    recBufferBound_max[w.channelMapping[i-n_actors]] = w.max_rec_buffer[w.channelMapping[i-n_actors]];
                 }
               }
             }
           }
-          execution[i] = actor_delay[i];
-          max_start[i].push_back(time);
-          //cout << "max_start[" << i << "].size() = " << max_start[i].size() << endl;
+          execution[i] = w.actor_delay[i];
+          w.max_start[i].push_back(time);
+          //cout << "w.max_start[" << i << "].size() = " << w.max_start[i].size() << endl;
           //determine length of next time transition (min. remaining actor execution demand)
           if(timeStep == -1)
-            timeStep = actor_delay[i];
-          else if(timeStep > actor_delay[i])
-            timeStep = actor_delay[i];
+            timeStep = w.actor_delay[i];
+          else if(timeStep > w.actor_delay[i])
+            timeStep = w.actor_delay[i];
         }
       }
     }
@@ -2172,42 +2185,42 @@ void ThroughputSSE::stateSpaceExploration(){
             if(minIterations<1){ //during the latency phase
               //if i is a block actor and j a src actor, consider the send buffer
               if(j<n_actors && i>=n_actors && (i-n_actors)%3 == 0){
-                max_send_buffer[channelMapping[i-n_actors]]++;  
-                if(max_send_buffer[channelMapping[i-n_actors]]<sendBufferBound_max[channelMapping[i-n_actors]])
-                  sendBufferBound_max[channelMapping[i-n_actors]] = max_send_buffer[channelMapping[i-n_actors]];
+                w.max_send_buffer[w.channelMapping[i-n_actors]]++;  
+                if(w.max_send_buffer[w.channelMapping[i-n_actors]]<sendBufferBound_max[w.channelMapping[i-n_actors]])
+                  sendBufferBound_max[w.channelMapping[i-n_actors]] = w.max_send_buffer[w.channelMapping[i-n_actors]];
               }
               //if i is a rec actor and j a send actor, consider the rec actor size
               if(i>n_actors && j>n_actors && (j-n_actors)%3==1 && j+1==i){
-                max_rec_buffer[channelMapping[i-n_actors]]++; 
-                //cout << "b: Ch " << j << ": " << max_rec_buffer[channelMapping[j-n_actors]];
+                w.max_rec_buffer[w.channelMapping[i-n_actors]]++; 
+                //cout << "b: Ch " << j << ": " << w.max_rec_buffer[w.channelMapping[j-n_actors]];
                 //cout << " at time " << time << endl;
-                if(max_rec_buffer[channelMapping[i-n_actors]]<recBufferBound_max[channelMapping[i-n_actors]])
-                  recBufferBound_max[channelMapping[i-n_actors]] = max_rec_buffer[channelMapping[i-n_actors]];
+                if(w.max_rec_buffer[w.channelMapping[i-n_actors]]<recBufferBound_max[w.channelMapping[i-n_actors]])
+                  recBufferBound_max[w.channelMapping[i-n_actors]] = w.max_rec_buffer[w.channelMapping[i-n_actors]];
               }
             }
           }
         }
-        max_end[i].push_back(time);
-        max_iterations[i]++;
-        if(max_iterations[i] == 1) {
+        w.max_end[i].push_back(time);
+        w.max_iterations[i]++;
+        if(w.max_iterations[i] == 1) {
           checkIterations = true; //to know when latency is fixed
           if (wc_latency[getApp(i)].size() == 0){
             wc_latency[getApp(i)].push_back(time);
           }else{
             wc_latency[getApp(i)][0] = time;
           }
-        }else if(max_iterations[i] == 2) {
+        }else if(w.max_iterations[i] == 2) {
           checkIterations = true;
           wc_period[getApp(i)] = time - wc_latency[getApp(i)][0];
           //cout << "New period: " << wc_period[getApp(i)];
           //cout << " (because of " << i << " made 2. it.)" << endl;
-        }else if(max_iterations[i]>2){
-          if(wc_period[getApp(i)] < max_end[i].back() - max_end[i][max_end[i].size()-2]){
-            wc_period[getApp(i)] = max_end[i].back() - max_end[i][max_end[i].size()-2];
+        }else if(w.max_iterations[i]>2){
+          if(wc_period[getApp(i)] < w.max_end[i].back() - w.max_end[i][w.max_end[i].size()-2]){
+            wc_period[getApp(i)] = w.max_end[i].back() - w.max_end[i][w.max_end[i].size()-2];
             //cout << "New period: " << wc_period[getApp(i)];
-            //cout << " (because of " << i << " made "<<max_iterations[i]<<" it.)" << endl;
+            //cout << " (because of " << i << " made "<<w.max_iterations[i]<<" it.)" << endl;
           }
-          if(maxIterations<max_iterations[i]) maxIterations = max_iterations[i];
+          if(maxIterations<w.max_iterations[i]) maxIterations = w.max_iterations[i];
         }
         
         execution[i] = -1; //update actor state
@@ -2225,7 +2238,7 @@ void ThroughputSSE::stateSpaceExploration(){
     if(checkIterations){
       int curMinIts = 2;
       for (auto i=0; i<n_msagActors; i++){
-        if(max_iterations[i]<curMinIts) curMinIts = max_iterations[i];
+        if(w.max_iterations[i]<curMinIts) curMinIts = w.max_iterations[i];
       }
       minIterations = curMinIts;
     }
@@ -2276,21 +2289,21 @@ void ThroughputSSE::stateSpaceExploration(){
             if(tokens[j*n_msagActors+i] == 0){ //an incoming channel with no tokens
               activate = false;
             }
-            if(min_iterations[i]>=max_iterations[i]){
+            if(w.min_iterations[i]>=w.max_iterations[i]){
               activate = false;
             }
           }
-          //if(activate) cout << "activate " <<  i << "_" << min_iterations[i] << ", current time: " << time << endl;
+          //if(activate) cout << "activate " <<  i << "_" << w.min_iterations[i] << ", current time: " << time << endl;
           //actors with initial tokens can add an extra iteration to their minimal schedule (i.e.
           //the iteration producing the initial token). Avoid this:
-          if(activate && //i>=n_actors && tok[channelMapping[i-n_actors]]>0 &&
-             min_iterations[i]>0 && min_start[i][0]-wc_period[getApp(i)]<time){
+          if(activate && //i>=n_actors && tok[w.channelMapping[i-n_actors]]>0 &&
+             w.min_iterations[i]>0 && w.min_start[i][0]-wc_period[getApp(i)]<time){
             activate = false; 
-            //cout << "DO NOT activate " <<  i << "_" << min_iterations[i] << endl;
-            //cout << "\t first start: " << min_start[i][0] << ", current time: " << time << endl;
-            if(xTimeStep == -1) xTimeStep = time-(min_start[i][0]-wc_period[getApp(i)]);
-            if(time-(min_start[i][0]-wc_period[getApp(i)]) < xTimeStep) {
-              xTimeStep = time-(min_start[i][0]-wc_period[getApp(i)]);
+            //cout << "DO NOT activate " <<  i << "_" << w.min_iterations[i] << endl;
+            //cout << "\t first start: " << w.min_start[i][0] << ", current time: " << time << endl;
+            if(xTimeStep == -1) xTimeStep = time-(w.min_start[i][0]-wc_period[getApp(i)]);
+            if(time-(w.min_start[i][0]-wc_period[getApp(i)]) < xTimeStep) {
+              xTimeStep = time-(w.min_start[i][0]-wc_period[getApp(i)]);
               //cout << "xTimeStep = " << xTimeStep << endl;
             }
           }
@@ -2298,35 +2311,35 @@ void ThroughputSSE::stateSpaceExploration(){
             for (auto j=0; j<n_msagActors; j++){
               if(tokens[j*n_msagActors+i] != -1){ 
                 tokens[j*n_msagActors+i] -= 1; //consume tokens
-                //cout << i << "_" << min_iterations[i] << " consumes a token from " << j;
+                //cout << i << "_" << w.min_iterations[i] << " consumes a token from " << j;
                 //cout << ". New amount of tokens on (" << j << ", " << i << "): " << tokens[j*n_msagActors+i] << endl;
                 
                 //buffer size analysis
                 if(minIterations<1){ //during the latency phase
                   //if i is a block and j a src actor, consider the send buffer
                   if(j<n_actors && i>=n_actors && (i-n_actors)%3 == 0){
-                    min_send_buffer[channelMapping[i-n_actors]]--;  
-                    if(min_send_buffer[channelMapping[i-n_actors]]<sendBufferBound_min[channelMapping[i-n_actors]])
-                      sendBufferBound_min[channelMapping[i-n_actors]] = min_send_buffer[channelMapping[i-n_actors]];
+                    w.min_send_buffer[w.channelMapping[i-n_actors]]--;  
+                    if(w.min_send_buffer[w.channelMapping[i-n_actors]]<sendBufferBound_min[w.channelMapping[i-n_actors]])
+                      sendBufferBound_min[w.channelMapping[i-n_actors]] = w.min_send_buffer[w.channelMapping[i-n_actors]];
                   }
                   //if i is a rec actor and j a send actor, consider the rec buffer size
                   if(j>n_actors && i>n_actors && (j-n_actors)%3==1 && j+1==i){
-                    min_rec_buffer[channelMapping[j-n_actors]]--; 
-                    //cout << "a: Ch " << j << ": " << min_rec_buffer[channelMapping[j-n_actors]];
+                    w.min_rec_buffer[w.channelMapping[j-n_actors]]--; 
+                    //cout << "a: Ch " << j << ": " << w.min_rec_buffer[w.channelMapping[j-n_actors]];
                     //cout << " at time " << time << endl;
-                    if(min_rec_buffer[channelMapping[j-n_actors]]<recBufferBound_min[channelMapping[j-n_actors]])
-                      recBufferBound_min[channelMapping[j-n_actors]] = min_rec_buffer[channelMapping[j-n_actors]];
+                    if(w.min_rec_buffer[w.channelMapping[j-n_actors]]<recBufferBound_min[w.channelMapping[j-n_actors]])
+                      recBufferBound_min[w.channelMapping[j-n_actors]] = w.min_rec_buffer[w.channelMapping[j-n_actors]];
                   }
                 }
               }
             }
-            execution[i] = actor_delay[i];
-            min_start[i].push_back(time);
+            execution[i] = w.actor_delay[i];
+            w.min_start[i].push_back(time);
             //determine length of next time transition (min. remaining actor execution demand)
             if(timeStep == -1)
-              timeStep = actor_delay[i];
-            else if(timeStep > actor_delay[i])
-              timeStep = actor_delay[i];
+              timeStep = w.actor_delay[i];
+            else if(timeStep > w.actor_delay[i])
+              timeStep = w.actor_delay[i];
           }
         }
       }
@@ -2375,30 +2388,30 @@ void ThroughputSSE::stateSpaceExploration(){
               if(minIterations<1){ //during the latency phase
                 //if i is a src actor and j a block actor, consider the send buffer
                 if(i<n_actors && j>=n_actors && (j-n_actors)%3 == 0){
-                  min_send_buffer[channelMapping[j-n_actors]]++;  
-                  if(min_send_buffer[channelMapping[j-n_actors]]<sendBufferBound_min[channelMapping[j-n_actors]])
-                    sendBufferBound_min[channelMapping[j-n_actors]] = min_send_buffer[channelMapping[j-n_actors]];
+                  w.min_send_buffer[w.channelMapping[j-n_actors]]++;  
+                  if(w.min_send_buffer[w.channelMapping[j-n_actors]]<sendBufferBound_min[w.channelMapping[j-n_actors]])
+                    sendBufferBound_min[w.channelMapping[j-n_actors]] = w.min_send_buffer[w.channelMapping[j-n_actors]];
                 }
                 //if i is a send actor and j a rec actor, consider the rec buffer size
                 if(j>n_actors && i>n_actors && (i-n_actors)%3==1 && i+1==j){
-                  min_rec_buffer[channelMapping[j-n_actors]]++; 
-                  //cout << "b: Ch " << j << ": " << min_rec_buffer[channelMapping[j-n_actors]];
+                  w.min_rec_buffer[w.channelMapping[j-n_actors]]++; 
+                  //cout << "b: Ch " << j << ": " << w.min_rec_buffer[w.channelMapping[j-n_actors]];
                   //cout << " at time " << time << endl;
-                  if(min_rec_buffer[channelMapping[j-n_actors]]<recBufferBound_min[channelMapping[j-n_actors]])
-                    recBufferBound_min[channelMapping[j-n_actors]] = min_rec_buffer[channelMapping[j-n_actors]];
+                  if(w.min_rec_buffer[w.channelMapping[j-n_actors]]<recBufferBound_min[w.channelMapping[j-n_actors]])
+                    recBufferBound_min[w.channelMapping[j-n_actors]] = w.min_rec_buffer[w.channelMapping[j-n_actors]];
                 }
               }
             }
           }
-          min_end[i].push_back(time);
-          min_iterations[i]++;
-          if(min_iterations[i] == 1) {
+          w.min_end[i].push_back(time);
+          w.min_iterations[i]++;
+          if(w.min_iterations[i] == 1) {
             checkIterations = true; //to know when latency is fixed
             //wc_latency = time;
           }
-          /*if(min_iterations[i] == 2) {
+          /*if(w.min_iterations[i] == 2) {
             checkIterations = true;
-            period_minSched[getApp(i)] = min_end[i][0] - min_end[i][1];
+            period_minSched[getApp(i)] = w.min_end[i][0] - w.min_end[i][1];
             //wc_period = time - wc_latency;
             }*/
           execution[i] = -1; //update actor state
@@ -2415,7 +2428,7 @@ void ThroughputSSE::stateSpaceExploration(){
       if(checkIterations){
         int curMinIts = 2;
         for (auto i=0; i<n_msagActors; i++){
-          if(min_iterations[i]<curMinIts) curMinIts = min_iterations[i];
+          if(w.min_iterations[i]<curMinIts) curMinIts = w.min_iterations[i];
         }
         minIterations = curMinIts;
       }
@@ -2423,21 +2436,21 @@ void ThroughputSSE::stateSpaceExploration(){
     
     //flip the min start and end times
     for (auto i=0; i<n_msagActors; i++){
-      if(min_start[i].size()>min_end[i].size()) min_start[i].pop_back();
+      if(w.min_start[i].size()>w.min_end[i].size()) w.min_start[i].pop_back();
       //if initial tokens are involved, an actor will have an extra iteration (the 0th one)
       //inside the minimal schedule, there it needs to be removed
-      if(max_end[i].size()<min_start[i].size()){
-        min_start[i].pop_back();
-        min_end[i].pop_back();
-        min_iterations[i]--;
-      }
-      for (size_t j=0; j<min_end[i].size(); j++){
-        int tmp_end = min_start[i][j];
-        min_start[i][j] = min_end[i][j];
-        min_end[i][j] = tmp_end;
-      }
-      reverse(min_start[i].begin(), min_start[i].end());
-      reverse(min_end[i].begin(), min_end[i].end());
+      if(w.max_end[i].size()<w.min_start[i].size()){
+        w.min_start[i].pop_back();
+        w.min_end[i].pop_back();
+        w.min_iterations[i]--;
+      }
+      for (size_t j=0; j<w.min_end[i].size(); j++){
+        int tmp_end = w.min_start[i][j];
+        w.min_start[i][j] = w.min_end[i][j];
+        w.min_end[i][j] = tmp_end;
+      }
+      reverse(w.min_start[i].begin(), w.min_start[i].end());
+      reverse(w.min_end[i].begin(), w.min_end[i].end());
     }
   }
   //if(next.assigned()){
@@ -2470,54 +2483,54 @@ void ThroughputSSE::stateSpaceExploration(){
 
   //setting lower and upper bound on iterations
   for (auto i=0; i<n_msagActors; i++){
-    min_iterations[i] = 0;
-    max_iterations[i]=0;
+    w.min_iterations[i] = 0;
+    w.max_iterations[i]=0;
     //..lower bound
-    for (size_t j=0; j<min_end[i].size(); j++){
-      if(min_end[i][j]<=wc_latency[getApp(i)][0] && min_start[i][j]<wc_latency[getApp(i)][0]) min_iterations[i]++;
+    for (size_t j=0; j<w.min_end[i].size(); j++){
+      if(w.min_end[i][j]<=wc_latency[getApp(i)][0] && w.min_start[i][j]<wc_latency[getApp(i)][0]) w.min_iterations[i]++;
     }
     //..upper bound
-    for (size_t j=0; j<max_end[i].size(); j++){
-      if(max_end[i][j]<=wc_latency[getApp(i)][0] && max_start[i][j]<wc_latency[getApp(i)][0]) max_iterations[i]++;
+    for (size_t j=0; j<w.max_end[i].size(); j++){
+      if(w.max_end[i][j]<=wc_latency[getApp(i)][0] && w.max_start[i][j]<wc_latency[getApp(i)][0]) w.max_iterations[i]++;
     }
   }
 
   //find correct bounds for periodic phase start and end times
   /*  for (auto i=0; i<n_msagActors; i++){
-      end_pp[i] = min_end[i].back();
-      int tmp_start = min_end[i][min_end[i].size()-2];
-      for(unsigned j=0; j<max_start[i].size(); j++){
+      w.end_pp[i] = w.min_end[i].back();
+      int tmp_start = w.min_end[i][w.min_end[i].size()-2];
+      for(unsigned j=0; j<w.max_start[i].size(); j++){
       if(i>=n_actors && (i-n_actors)%3==2){ //receiving node (because it doesn't consume any time yet)
-      if(max_start[i][j]>tmp_start){
-      tmp_start = max_start[i][j];
+      if(w.max_start[i][j]>tmp_start){
+      tmp_start = w.max_start[i][j];
       break;
       }
       }else{
-      if(max_start[i][j]>=tmp_start){
-      tmp_start = max_start[i][j];
+      if(w.max_start[i][j]>=tmp_start){
+      tmp_start = w.max_start[i][j];
       break;
       }
       }
       }*/
   /*    if(i<n_actors){
-        start_pp[i] = max(wc_latency+1-wcet[i].max(), tmp_start);
+        w.start_pp[i] = max(wc_latency+1-wcet[i].max(), tmp_start);
         }else if(i>=n_actors && (i-n_actors)%3==0){ //blocking node
-        int duration = sendingLatency[channelMapping[i-n_actors]].max();
-        start_pp[i] = max(wc_latency+1-duration, tmp_start);
+        int duration = sendingLatency[w.channelMapping[i-n_actors]].max();
+        w.start_pp[i] = max(wc_latency+1-duration, tmp_start);
         }else if(i>=n_actors && (i-n_actors)%3==1){ //sending node
-        int duration = sendingTime[channelMapping[i-n_actors]].max();
-        start_pp[i] = max(wc_latency+1-duration, tmp_start);
+        int duration = sendingTime[w.channelMapping[i-n_actors]].max();
+        w.start_pp[i] = max(wc_latency+1-duration, tmp_start);
         }else if(i>=n_actors && (i-n_actors)%3==2){ //receiving node
-        start_pp[i] = tmp_start;  
+        w.start_pp[i] = tmp_start;  
         }
   */
-  /*    start_pp[i] = tmp_start;  
+  /*    w.start_pp[i] = tmp_start;  
         }*/
  
   //removing periodic phase from maximum schedule
   /*  for (auto i=0; i<n_msagActors; i++){
-      max_start[i].erase(max_start[i].begin()+max_iterations[i], max_start[i].end());
-      max_end[i].erase(max_end[i].begin()+max_iterations[i], max_end[i].end());
+      w.max_start[i].erase(w.max_start[i].begin()+w.max_iterations[i], w.max_start[i].end());
+      w.max_end[i].erase(w.max_end[i].begin()+w.max_iterations[i], w.max_end[i].end());
       }*/
 
   
@@ -2525,41 +2538,42 @@ void ThroughputSSE::stateSpaceExploration(){
   /*  cout << "Latency: " << wc_latency << ", period: " << wc_period << endl;
       cout << "  Iterations min / max" << endl;
       for (auto i=0; i<n_msagActors; i++){
-      cout << "    " << i << ": " << min_iterations[i] << " / " << max_iterations[i] << endl;
+      cout << "    " << i << ": " << w.min_iterations[i] << " / " << w.max_iterations[i] << endl;
       }
       for (auto i=0; i<n_msagActors; i++){
       cout << i << ": ";
-      for (auto j=0; j<max_end[i].size(); j++){
-      cout << "(" << max_start[i][j] << ", " << max_end[i][j] << ") ";
+      for (auto j=0; j<w.max_end[i].size(); j++){
+      cout << "(" << w.max_start[i][j] << ", " << w.max_end[i][j] << ") ";
       }
-      cout << "| (" << start_pp[i] << ", " << end_pp[i] << ")";
+      cout << "| (" << w.start_pp[i] << ", " << w.end_pp[i] << ")";
       cout << endl;
       }
       cout << "------------------" << endl;
       for (auto i=0; i<n_msagActors; i++){
       cout << i << ": ";
-      for (auto j=0; j<min_end[i].size(); j++){
-      cout << "(" << min_start[i][j] << ", " << min_end[i][j] << ") ";
+      for (auto j=0; j<w.min_end[i].size(); j++){
+      cout << "(" << w.min_start[i][j] << ", " << w.min_end[i][j] << ") ";
       }
-      cout << "| (" << start_pp[i] << ", " << end_pp[i] << ")";
+      cout << "| (" << w.start_pp[i] << ", " << w.end_pp[i] << ")";
       cout << endl;
       }
       cout << "Send Buffer (min/max)" << endl;
       for (auto i=0; i<ch_src.size(); i++){
-      cout << min_send_buffer[i] << "/" << max_send_buffer[i] << " ";
+      cout << w.min_send_buffer[i] << "/" << w.max_send_buffer[i] << " ";
       }
       cout << endl;
       cout << "Rec Buffer (min/max)" << endl;
       for (auto i=0; i<ch_src.size(); i++){
-      cout << min_rec_buffer[i] << "/" << max_rec_buffer[i] << " ";
+      cout << w.min_rec_buffer[i] << "/" << w.max_rec_buffer[i] << " ";
       }
       cout << endl;*/
 }
 
 
 void ThroughputSSE::printThroughputGraph(){
+  Workspace& w = workspace();
   cout << "-------------------------------------------------"<<endl;
-  for ( auto it = msaGraph.begin(); it != msaGraph.end(); ++it){
+  for ( auto it = w.msaGraph.begin(); it != w.msaGraph.end(); ++it){
     int node=it->first;
     cout << node << ": ";
     vector<SuccessorNode> succs = (vector<SuccessorNode>)(it->second);
@@ -2588,6 +2602,7 @@ void ThroughputSSE::printThroughputGraph(){
 }
 
 void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
+  Workspace& w = workspace();
   cout << "call: " << calls << endl;
   string graphName = "throughputGraph"+std::to_string(calls);
   ofstream out;
@@ -2607,13 +2622,13 @@ void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
       actorName = "actor_"+to_string(i);
       col = (getApp(i)+1)%32;
     }else if(i>=n_actors && (i-n_actors)%3==0){ //blocking node
-      actorName = "block_ch" + to_string(channelMapping[i-n_actors]);
+      actorName = "block_ch" + to_string(w.channelMapping[i-n_actors]);
       col = -1;
     }else if(i>=n_actors && (i-n_actors)%3==1){ //sending node
-      actorName = "send_ch" + to_string(channelMapping[i-n_actors]) ;
+      actorName = "send_ch" + to_string(w.channelMapping[i-n_actors]) ;
       col = -2;
     }else if(i>=n_actors && (i-n_actors)%3==2){ //receiving node
-      actorName = "rec_ch" + to_string(channelMapping[i-n_actors]);
+      actorName = "rec_ch" + to_string(w.channelMapping[i-n_actors]);
       col = -3;
     }
     
@@ -2641,17 +2656,17 @@ void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
   }
   out << endl;
   
-  for ( auto it = msaGraph.begin(); it != msaGraph.end(); ++it){
+  for ( auto it = w.msaGraph.begin(); it != w.msaGraph.end(); ++it){
     string srcName;
     int node=it->first;
     if(node<n_actors){ 
       srcName = "actor_"+to_string(node);
     }else if(node>=n_actors && (node-n_actors)%3==0){ //blocking node
-      srcName = "block_ch" + to_string(channelMapping[node-n_actors]);
+      srcName = "block_ch" + to_string(w.channelMapping[node-n_actors]);
     }else if(node>=n_actors && (node-n_actors)%3==1){ //sending node
-      srcName = "send_ch" + to_string(channelMapping[node-n_actors]);
+      srcName = "send_ch" + to_string(w.channelMapping[node-n_actors]);
     }else if(node>=n_actors && (node-n_actors)%3==2){ //receiving node
-      srcName = "rec_ch" + to_string(channelMapping[node-n_actors]);
+      srcName = "rec_ch" + to_string(w.channelMapping[node-n_actors]);
     }
     vector<SuccessorNode> succs = (vector<SuccessorNode>)(it->second);
     for ( auto itV = succs.begin(); itV != succs.end(); ++itV){
@@ -2660,11 +2675,11 @@ void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
       if(node2<n_actors){ 
         dstName = "actor_"+to_string(node2);
       }else if(node2>=n_actors && (node2-n_actors)%3==0){ //blocking node
-        dstName = "block_ch" + to_string(channelMapping[node2-n_actors]);
+        dstName = "block_ch" + to_string(w.channelMapping[node2-n_actors]);
       }else if(node2>=n_actors && (node2-n_actors)%3==1){ //sending node
-        dstName = "send_ch" + to_string(channelMapping[node2-n_actors]);
+        dstName = "send_ch" + to_string(w.channelMapping[node2-n_actors]);
       }else if(node2>=n_actors && (node2-n_actors)%3==2){ //receiving node
-        dstName = "rec_ch" + to_string(channelMapping[node2-n_actors]);
+        dstName = "rec_ch" + to_string(w.channelMapping[node2-n_actors]);
       }
       int tok = ((SuccessorNode)(*itV)).max_tok;
       // Initial tokens on channel?
@@ -2672,10 +2687,10 @@ void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
         string label;
         out << "    " << srcName << " -> " << dstName;
         if(node>=n_actors && (node-n_actors)%3==0 && node2<n_actors){
-          label = "send_buff (ch" + to_string( channelMapping[node-n_actors])+ ")"; 
+          label = "send_buff (ch" + to_string( w.channelMapping[node-n_actors])+ ")"; 
           out << " [ label=\"" << label << "\"];" << endl;
         }else if(node>=n_actors && (node-n_actors)%3==2 && node2>=n_actors && (node2-n_actors)%3==1){
-          label = "rec_buff (ch" + to_string(channelMapping[node2-n_actors]) + ")";
+          label = "rec_buff (ch" + to_string(w.channelMapping[node2-n_actors]) + ")";
           out << " [ label=\"" << label << "\"];" << endl;
         } else {
           label = to_string(tok);
@@ -2723,6 +2738,7 @@ void ThroughputSSE::printThroughputGraphAsDot(const string &dir) const {
 }
 
 void ThroughputSSE::printSchedule(string type, int length, string dir){
+  Workspace& w = workspace();
   
   //determine processor-assignment
   vector<int> proc(n_msagActors, 0); 
@@ -2740,7 +2756,7 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
   }
   //processor assignment for channel actors (block-send-receive)
   for (auto i=n_actors; i<n_msagActors; i++){
-    proc[i] = proc[ch_src[channelMapping[i-n_actors]]]+n_procs;
+    proc[i] = proc[ch_src[w.channelMapping[i-n_actors]]]+n_procs;
     cout << " proc[" << i << "] = " << proc[i] << endl;
   }
   
@@ -2791,9 +2807,9 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
     
     for (auto i=0; i<n_actors; i++){
       double y=(double)(proc[i]+1)*-1.5;
-      for (size_t j=0; j<min_end[i].size(); j++){
-        double s = (double)min_start[i][j]/scaleFactor;
-        double l = (double)(min_end[i][j]-min_start[i][j])/scaleFactor;
+      for (size_t j=0; j<w.min_end[i].size(); j++){
+        double s = (double)w.min_start[i][j]/scaleFactor;
+        double l = (double)(w.min_end[i][j]-w.min_start[i][j])/scaleFactor;
         out << "\\draw  [fill=black!10] ("<<s<<","<<y<<") rectangle +(";
         out << l <<",0.5);" << endl;
         out << "\\node at (" << s+0.5*l << "," << y+0.25;
@@ -2802,10 +2818,10 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
     }
     for (auto i=n_actors; i<n_msagActors; i++){
       if((i-n_actors)%3 != 2){ //don't print rec actors
-        double y=(double)(proc[ch_src[channelMapping[i-n_actors]]]+1)*-1.5+0.5;
-        for (size_t j=0; j<min_end[i].size(); j++){
-          double s = (double)min_start[i][j]/scaleFactor;
-          double l = (double)(min_end[i][j]-min_start[i][j])/scaleFactor;
+        double y=(double)(proc[ch_src[w.channelMapping[i-n_actors]]]+1)*-1.5+0.5;
+        for (size_t j=0; j<w.min_end[i].size(); j++){
+          double s = (double)w.min_start[i][j]/scaleFactor;
+          double l = (double)(w.min_end[i][j]-w.min_start[i][j])/scaleFactor;
           if((i-n_actors)%3 == 0){
             out << "\\draw  [fill=black!60] (";
           }else{
@@ -2871,9 +2887,9 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
     
     for (auto i=0; i<n_actors; i++){
       double y=(double)(proc[i]+1)*-1.5;
-      for (size_t j=0; j<max_end[i].size(); j++){
-        double s = (double)max_start[i][j]/scaleFactor;
-        double l = (double)(max_end[i][j]-max_start[i][j])/scaleFactor;
+      for (size_t j=0; j<w.max_end[i].size(); j++){
+        double s = (double)w.max_start[i][j]/scaleFactor;
+        double l = (double)(w.max_end[i][j]-w.max_start[i][j])/scaleFactor;
         out << "\\draw  [fill=black!10] ("<<s<<","<<y<<") rectangle +(";
         out << l <<",0.5);" << endl;
         out << "\\node at (" << s+0.5*l << "," << y+0.25;
@@ -2882,10 +2898,10 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
     }
     for (auto i=n_actors; i<n_msagActors; i++){
       if((i-n_actors)%3 != 2){ //don't print rec actors
-        double y=(double)(proc[ch_src[channelMapping[i-n_actors]]]+1)*-1.5+0.5;
-        for (size_t j=0; j<max_end[i].size(); j++){
-          double s = (double)max_start[i][j]/scaleFactor;
-          double l = (double)(max_end[i][j]-max_start[i][j])/scaleFactor;
+        double y=(double)(proc[ch_src[w.channelMapping[i-n_actors]]]+1)*-1.5+0.5;
+        for (size_t j=0; j<w.max_end[i].size(); j++){
+          double s = (double)w.max_start[i][j]/scaleFactor;
+          double l = (double)(w.max_end[i][j]-w.max_start[i][j])/scaleFactor;
           if((i-n_actors)%3 == 0){ //block
             out << "\\draw  [fill=black!60] (";
           }else{ //send
@@ -2899,7 +2915,7 @@ void ThroughputSSE::printSchedule(string type, int length, string dir){
           }else{ //send
             out << ") {\\footnotesize $s_{";
           }
-          out << ch_src[channelMapping[i-n_actors]] << "\\rightarrow" << ch_dst[channelMapping[i-n_actors]];
+          out << ch_src[w.channelMapping[i-n_actors]] << "\\rightarrow" << ch_dst[w.channelMapping[i-n_actors]];
           out << "}$};\n";
         }
       }
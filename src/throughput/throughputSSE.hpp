@@ -54,6 +54,32 @@ private:
       SuccessorNode():successor_key(-1){};
 
   };
+  //scratch data only used within one propagation, kept once per thread instead of per clone
+  class Workspace{
+    public:
+      //for construction of the mapping and scheduling aware graph
+      unordered_map<int,vector<SuccessorNode>> msaGraph;
+      //for mapping from msag send/rec actors to appG-channels
+      vector<int> channelMapping;
+      //receivingActors: for storing/finding the first receiving actor for each dst
+      vector<int> receivingActors;
+      //to represent the state of state space exploration
+      vector<int> ch_state; //tokens on channels of msag
+      vector<int> actor_delay; //actor wcets of msag
+      vector<vector<int>> max_start; //self-timed schedule generated by SSE
+      vector<vector<int>> max_end; //self-timed schedule generated by SSE
+      vector<vector<int>> min_start; //minimal schedule with same latency & period
+      vector<vector<int>> min_end; //minimal schedule with same latency & period
+      vector<int> start_pp; //start times for periodic phase
+      vector<int> end_pp; //end times for periodic phase
+      vector<int> min_iterations; //min iterations of actors for wc latency and period
+      vector<int> max_iterations; //max iterations of actors for wc latency and period
+      vector<int> min_send_buffer; //min buffer size of all appG-channels
+      vector<int> max_send_buffer; //max buffer size of all appG-channels
+      vector<int> min_rec_buffer; //min buffer size of all appG-channels
+      vector<int> max_rec_buffer; //max buffer size of all appG-channels
+  };
+  static Workspace& workspace();
 protected:
   ViewArray<IntView> latency; //resulting initial latency
   ViewArray<IntView> period; //resulting period
@@ -76,12 +102,12 @@ protected:
   ViewArray<IntView> periodicSched_end; //time-based schedule for periodic phase, start times
   ViewArray<IntView> periodicSched_IC_start; //time-based schedule for periodic phase, start times for interconnect
   ViewArray<IntView> periodicSched_IC_end; //time-based schedule for periodic phase, end times for interconnect
-  IntArgs ch_src; //source actors for all channels 
-  IntArgs ch_dst; //destination actors for all channels
-  IntArgs tok; //initial token distribution of application graph
-  IntArgs apps; //apps[i] is index of last actor of application i
-  IntArgs minIndices; //for each entity and channel, its first index in the time-based schedule
-  IntArgs maxIndices; //for each entity and channel, its last index in the time-based schedule
+  IntSharedArray ch_src; //source actors for all channels 
+  IntSharedArray ch_dst; //destination actors for all channels
+  IntSharedArray tok; //initial token distribution of application graph
+  IntSharedArray apps; //apps[i] is index of last actor of application i
+  IntSharedArray minIndices; //for each entity and channel, its first index in the time-based schedule
+  IntSharedArray maxIndices; //for each entity and channel, its last index in the time-based schedule
 
   int n_actors; //number of actors in the graph
   int n_channels; //number of channels in the graph
@@ -89,32 +115,10 @@ protected:
   int n_msagActors; //number of actors in msag
   int n_msagChannels; //number of channels
   int channel_count; //number of messages on interconnect
-  
-  //for construction of the mapping and scheduling aware graph
-  unordered_map<int,vector<SuccessorNode>> msaGraph;
-  //for mapping from msag send/rec actors to appG-channels
-  vector<int> channelMapping;
-  //receivingActors: for storing/finding the first receiving actor for each dst
-  vector<int> receivingActors;
-  //to represent the state of state space exploration
-  vector<int> ch_state; //tokens on channels of msag
-  vector<int> actor_delay; //actor wcets of msag
 
   //SSE results
   vector<vector<int>> wc_latency; 
   vector<int> wc_period;
-  vector<vector<int>> max_start; //self-timed schedule generated by SSE
-  vector<vector<int>> max_end; //self-timed schedule generated by SSE
-  vector<vector<int>> min_start; //minimal schedule with same latency & period
-  vector<vector<int>> min_end; //minimal schedule with same latency & period
-  vector<int> start_pp; //start times for periodic phase
-  vector<int> end_pp; //end times for periodic phase
-  vector<int> min_iterations; //min iterations of actors for wc latency and period
-  vector<int> max_iterations; //max iterations of actors for wc latency and period
-  vector<int> min_send_buffer; //min buffer size of all appG-channels
-  vector<int> max_send_buffer; //max buffer size of all appG-channels
-  vector<int> min_rec_buffer; //min buffer size of all appG-channels
-  vector<int> max_rec_buffer; //max buffer size of all appG-channels
 
 
   //for evaluation purposes
@@ -213,6 +217,10 @@ virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
 
 virtual ExecStatus propagate(Space& home, const ModEventDelta&);
 
+protected:
+/** Builds the MSAG of the current decisions and bounds period and latency by its self-timed execution. */
+ExecStatus filter(Space& home, const ModEventDelta& med);
+
 };
 
 //throughput constraint with propagation on time-based schedule
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef TOOLS_ALIGNEDALLOCATOR_HPP_
+#define TOOLS_ALIGNEDALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace tools {
+
+/** Size of a cache line, the default alignment of an AlignedAllocator. */
+const size_t cacheLine = 64;
+
+/**
+ * @brief Allocator placing the elements of a container at an Align-byte
+ * boundary, e.g. std::vector<int, AlignedAllocator<int>> for a lookup
+ * table starting on a cache line.
+ */
+template<class T, size_t Align = cacheLine>
+class AlignedAllocator {
+public:
+  typedef T value_type;
+
+  template<class U> struct rebind { typedef AlignedAllocator<U, Align> other; };
+
+  AlignedAllocator() {}
+  template<class U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+  T* allocate(size_t n) {
+    void* p = nullptr;
+    if (posix_memalign(&p, Align, n * sizeof(T)) != 0)
+      throw std::bad_alloc();
+    return static_cast<T*>(p);
+  }
+
+  void deallocate(T* p, size_t) {
+    free(p);
+  }
+};
+
+template<class T, class U, size_t Align>
+bool operator==(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) { return true; }
+
+template<class T, class U, size_t Align>
+bool operator!=(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) { return false; }
+
+}
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "binaryio.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace tools;
+using namespace std;
+
+BinaryWriter::BinaryWriter(const string& path) : file(path, ios::binary | ios::trunc) {}
+
+bool BinaryWriter::good() const {
+  return file.good();
+}
+
+void BinaryWriter::putString(const string& s) {
+  put<uint64_t>(s.size());
+  file.write(s.data(), s.size());
+}
+
+void BinaryWriter::putStrings(const vector<string>& v) {
+  put<uint64_t>(v.size());
+  for (const auto& s : v)
+    putString(s);
+}
+
+BinaryReader::BinaryReader(const string& path) : data(nullptr), size(0), pos(0), valid(false) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      data = static_cast<const char*>(map);
+      size = st.st_size;
+      valid = true;
+    }
+  }
+  close(fd);
+}
+
+BinaryReader::~BinaryReader() {
+  if (data)
+    munmap(const_cast<char*>(data), size);
+}
+
+bool BinaryReader::good() const {
+  return valid;
+}
+
+bool BinaryReader::take(size_t n) {
+  if (!valid || n > size - pos) {
+    valid = false;
+    return false;
+  }
+  pos += n;
+  return true;
+}
+
+string BinaryReader::getString() {
+  uint64_t n = get<uint64_t>();
+  if (!take(n))
+    return string();
+  return string(data + pos - n, n);
+}
+
+vector<string> BinaryReader::getStrings() {
+  uint64_t n = get<uint64_t>();
+  vector<string> v;
+  for (uint64_t i = 0; i < n && valid; i++)
+    v.push_back(getString());
+  return v;
+}
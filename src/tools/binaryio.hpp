@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_BINARYIO_HPP_
+#define TOOLS_BINARYIO_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tools {
+
+/**
+ * @brief Writes plain values, strings and vectors of plain values to a
+ * binary file, in native byte order.
+ *
+ * Vectors and strings are stored as a 64-bit length followed by their
+ * elements, so that a reader can map the file and copy them in one go.
+ */
+class BinaryWriter {
+public:
+  explicit BinaryWriter(const std::string& path);
+
+  bool good() const;
+
+  template<class T> void put(T value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "plain values only");
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template<class T> void putVector(const std::vector<T>& v) {
+    static_assert(std::is_arithmetic<T>::value, "plain values only");
+    put<uint64_t>(v.size());
+    if (!v.empty())
+      file.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+  }
+
+  void putString(const std::string& s);
+  void putStrings(const std::vector<std::string>& v);
+
+private:
+  std::ofstream file;
+};
+
+/**
+ * @brief Reads a file written by BinaryWriter from a read-only memory map.
+ *
+ * Reading past the end of the file yields zeros and makes good() false,
+ * so a sequence of reads only has to be checked once at its end.
+ */
+class BinaryReader {
+public:
+  explicit BinaryReader(const std::string& path);
+  ~BinaryReader();
+
+  /** False if the file could not be mapped or a read went past its end. */
+  bool good() const;
+
+  template<class T> T get() {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "plain values only");
+    T value = T();
+    if (take(sizeof(T)))
+      std::memcpy(&value, data + pos - sizeof(T), sizeof(T));
+    return value;
+  }
+
+  template<class T> std::vector<T> getVector() {
+    static_assert(std::is_arithmetic<T>::value, "plain values only");
+    uint64_t n = get<uint64_t>();
+    std::vector<T> v;
+    if (n > (size - pos) / sizeof(T)) {
+      valid = false;
+      return v;
+    }
+    v.resize(n);
+    if (n > 0 && take(n * sizeof(T)))
+      std::memcpy(v.data(), data + pos - n * sizeof(T), n * sizeof(T));
+    return v;
+  }
+
+  std::string getString();
+  std::vector<std::string> getStrings();
+
+private:
+  const char* data; /**< the mapped file. */
+  size_t size;
+  size_t pos;
+  bool valid;
+
+  /** Advances past n bytes, false (and invalid) if there are not enough left. */
+  bool take(size_t n);
+
+  BinaryReader(const BinaryReader&) = delete;
+  BinaryReader& operator=(const BinaryReader&) = delete;
+};
+
+}
+
+#endif
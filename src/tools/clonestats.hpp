@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_CLONESTATS_HPP_
+#define TOOLS_CLONESTATS_HPP_
+
+#include <atomic>
+#include <cstddef>
+
+namespace tools {
+
+/**
+ * @brief Counters for the cost of cloning spaces during search.
+ *
+ * The model counts its clones, the custom propagators add the bytes
+ * of state they duplicate on copy(). The counters are global and
+ * atomic, so they are shared by all search threads.
+ */
+class CloneStats {
+public:
+  /** Counts one clone of the constraint model. */
+  static void clone(size_t bytes);
+  /** Adds bytes duplicated by a propagator during a clone. */
+  static void record(size_t bytes);
+  static unsigned long clones();
+  static unsigned long bytes();
+  static void reset();
+
+private:
+  static std::atomic<unsigned long> n_clones;
+  static std::atomic<unsigned long> n_bytes;
+};
+
+}
+
+#endif
@@ -41,6 +41,7 @@
 #include <list>
 #include <vector>
 #include <iterator>
+#include <cstddef>
 
 namespace tools {
 
@@ -87,6 +88,31 @@ TContainer<TObject, std::allocator<TObject>>
   return first;
 }
 
+/**
+ * Read-only view of a contiguous range of elements, e.g. a slice of a
+ * vector, which can be iterated without copying the elements. The view
+ * is invalidated with the underlying storage.
+ *
+ * @tparam T
+ *         Element class.
+ */
+template<class T>
+class ArrayView {
+public:
+  ArrayView() : first(nullptr), last(nullptr) {}
+  ArrayView(const T* _first, const T* _last) : first(_first), last(_last) {}
+
+  const T* begin() const { return first; }
+  const T* end() const { return last; }
+  size_t size() const { return last - first; }
+  bool empty() const { return first == last; }
+  const T& operator[](size_t i) const { return first[i]; }
+
+private:
+  const T* first;
+  const T* last;
+};
+
 }
 
 #endif
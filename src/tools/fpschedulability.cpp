@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fpschedulability.hpp"
+
+#include <cmath>
+
+using namespace std;
+
+namespace tools {
+
+long long leveliWorkload(const vector<FPTask>& tasks, size_t i, long long t) {
+  long long W = tasks[i].wcet;
+  for (size_t j = 0; j < tasks.size(); j++) {
+    if (j != i && tasks[j].priority < tasks[i].priority) {
+      W += ((t + tasks[j].period - 1) / tasks[j].period) * tasks[j].wcet;
+    }
+  }
+  return W;
+}
+
+long long responseTime(const vector<FPTask>& tasks, size_t i, long long limit) {
+  long long R = leveliWorkload(tasks, i, 1);
+  while (R <= limit) {
+    long long W = leveliWorkload(tasks, i, R);
+    if (W <= R)
+      return R;
+    R = W;
+  }
+  return -1;
+}
+
+bool utilizationBound(const vector<FPTask>& tasks) {
+  if (tasks.empty())
+    return true;
+  double utils = 0;
+  for (const auto& task : tasks)
+    utils += ((double) task.wcet) / task.deadline;
+  size_t n = tasks.size();
+  return utils <= n * (pow(2, (1.0 / n)) - 1);
+}
+
+bool fpSchedulable(const vector<FPTask>& tasks) {
+  if (utilizationBound(tasks))
+    return true;
+  for (size_t i = 0; i < tasks.size(); i++) {
+    if (responseTime(tasks, i, tasks[i].deadline) < 0)
+      return false;
+  }
+  return true;
+}
+
+bool FPSchedulabilityCache::schedulable(const vector<int>& ids, const vector<FPTask>& tasks) {
+  vector<int> key;
+  key.reserve(ids.size() * 5);
+  for (size_t i = 0; i < ids.size(); i++) {
+    key.push_back(ids[i]);
+    key.push_back(tasks[i].wcet);
+    key.push_back(tasks[i].period);
+    key.push_back(tasks[i].deadline);
+    key.push_back(tasks[i].priority);
+  }
+  auto it = verdicts.find(key);
+  if (it != verdicts.end()) {
+    n_hits++;
+    return it->second;
+  }
+  n_misses++;
+  if (verdicts.size() >= max_entries)
+    verdicts.clear();
+  bool result = fpSchedulable(tasks);
+  verdicts.emplace(std::move(key), result);
+  return result;
+}
+
+void FPSchedulabilityCache::clear() {
+  verdicts.clear();
+  n_hits = 0;
+  n_misses = 0;
+}
+
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_FPSCHEDULABILITY_HPP_
+#define TOOLS_FPSCHEDULABILITY_HPP_
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace tools {
+
+/**
+ * @brief A periodic task as seen by the fixed-priority analysis.
+ *
+ * Priority 0 is the highest (as assigned by TaskSet::SetRMPriorities).
+ * Periods are assumed to be positive.
+ */
+struct FPTask {
+  int wcet;
+  int period;
+  int deadline;
+  int priority;
+};
+
+/**
+ * Level-i workload of task i at time t: its own WCET plus the demand of all
+ * tasks with higher priority released in [0,t).
+ */
+long long leveliWorkload(const std::vector<FPTask>& tasks, std::size_t i, long long t);
+
+/**
+ * Worst-case response time of task i by fixed-point iteration
+ * R = leveliWorkload(i, R), i.e. the first t with leveliWorkload(i,t) <= t.
+ * @return the response time, or -1 if it exceeds limit.
+ */
+long long responseTime(const std::vector<FPTask>& tasks, std::size_t i, long long limit);
+
+/**
+ * Sufficient Liu & Layland test on wcet/deadline.
+ */
+bool utilizationBound(const std::vector<FPTask>& tasks);
+
+/**
+ * Exact test for partitioned FP scheduling of the tasks on one processor:
+ * the utilization bound first, response-time analysis against the
+ * deadlines if it fails.
+ */
+bool fpSchedulable(const std::vector<FPTask>& tasks);
+
+/**
+ * @brief Memoizes fpSchedulable() per processor task set.
+ *
+ * During search the same task set on a processor is tested over and over,
+ * so the verdicts are kept by task set (entity ids and their parameters).
+ * Not thread safe; use one cache per thread.
+ */
+class FPSchedulabilityCache {
+public:
+  /**
+   * @param ids entity ids of the tasks, identifying the task set
+   * @param tasks the tasks, in the same order as ids
+   */
+  bool schedulable(const std::vector<int>& ids, const std::vector<FPTask>& tasks);
+  std::size_t hits() const { return n_hits; }
+  std::size_t misses() const { return n_misses; }
+  void clear();
+
+private:
+  static const std::size_t max_entries = 1 << 16;
+  std::map<std::vector<int>, bool> verdicts;
+  std::size_t n_hits = 0;
+  std::size_t n_misses = 0;
+};
+
+}
+
+#endif
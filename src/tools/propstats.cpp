@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "propstats.hpp"
+#include <cstring>
+#include <mutex>
+
+using namespace tools;
+
+std::atomic<bool> PropStats::on(false);
+std::atomic<size_t> PropStats::n_kinds(0);
+
+namespace {
+  size_t log2Bucket(unsigned long long v) {
+    size_t b = 0;
+    while (v > 1 && b+1 < PropStats::n_buckets) {
+      v >>= 1;
+      b++;
+    }
+    return b;
+  }
+
+  void atomicMax(std::atomic<unsigned long long>& m, unsigned long long v) {
+    unsigned long long cur = m.load(std::memory_order_relaxed);
+    while (v > cur && !m.compare_exchange_weak(cur, v, std::memory_order_relaxed));
+  }
+
+  void writeHistogram(std::ostream& out, const std::atomic<unsigned long long>* hist) {
+    out << "[";
+    bool first = true;
+    for (size_t b = 0; b < PropStats::n_buckets; b++) {
+      unsigned long long n = hist[b].load();
+      if (n == 0)
+        continue;
+      out << (first ? "" : ", ") << "{\"from\": " << (1ULL << b) << ", \"to\": " << ((2ULL << b) - 1)
+          << ", \"count\": " << n << "}";
+      first = false;
+    }
+    out << "]";
+  }
+}
+
+PropStats::Counters* PropStats::counters() {
+  static Counters c[max_kinds];
+  return c;
+}
+
+void PropStats::enable(bool _on) {
+  on = _on;
+}
+
+bool PropStats::enabled() {
+  return on.load(std::memory_order_relaxed);
+}
+
+size_t PropStats::kind(const char* name) {
+  static std::mutex lock;
+  std::lock_guard<std::mutex> guard(lock);
+  Counters* c = counters();
+  for (size_t k = 0; k < n_kinds; k++) {
+    if (std::strcmp(c[k].name, name) == 0)
+      return k;
+  }
+  if (n_kinds == max_kinds)
+    return max_kinds;
+  c[n_kinds].name = name;
+  return n_kinds++;
+}
+
+void PropStats::call(size_t kind, long long ns, int status) {
+  if (kind >= n_kinds)
+    return;
+  Counters& c = counters()[kind];
+  c.calls.fetch_add(1, std::memory_order_relaxed);
+  c.ns.fetch_add(ns, std::memory_order_relaxed);
+  //ExecStatus: subsumed -2, failed -1, nofix 0, fix 1, partial/forced 2
+  int outcome = status < -2 ? SUBSUMED : (status > 2 ? PARTIAL : status + 2);
+  c.outcomes[outcome].fetch_add(1, std::memory_order_relaxed);
+  c.time_hist[log2Bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PropStats::msag(size_t kind, size_t actors, size_t channels) {
+  if (!enabled() || kind >= n_kinds)
+    return;
+  Counters& c = counters()[kind];
+  c.msags.fetch_add(1, std::memory_order_relaxed);
+  c.msag_actors.fetch_add(actors, std::memory_order_relaxed);
+  c.msag_channels.fetch_add(channels, std::memory_order_relaxed);
+  atomicMax(c.msag_max_actors, actors);
+  atomicMax(c.msag_max_channels, channels);
+  c.msag_hist[log2Bucket(actors)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PropStats::reset() {
+  Counters* c = counters();
+  for (size_t k = 0; k < n_kinds; k++) {
+    c[k].calls = 0;
+    c[k].ns = 0;
+    for (auto& o : c[k].outcomes)
+      o = 0;
+    for (auto& h : c[k].time_hist)
+      h = 0;
+    c[k].msags = 0;
+    c[k].msag_actors = 0;
+    c[k].msag_channels = 0;
+    c[k].msag_max_actors = 0;
+    c[k].msag_max_channels = 0;
+    for (auto& h : c[k].msag_hist)
+      h = 0;
+  }
+}
+
+void PropStats::writeJSON(std::ostream& out) {
+  static const char* outcomeNames[N_OUTCOMES] = {"subsumed", "failed", "nofix", "fix", "partial"};
+  Counters* c = counters();
+  out << "{\n  \"propagators\": [";
+  for (size_t k = 0; k < n_kinds; k++) {
+    out << (k > 0 ? "," : "") << "\n    {\n";
+    out << "      \"name\": \"" << c[k].name << "\",\n";
+    out << "      \"calls\": " << c[k].calls << ",\n";
+    out << "      \"time_ns\": " << c[k].ns << ",\n";
+    out << "      \"outcomes\": {";
+    for (size_t o = 0; o < N_OUTCOMES; o++)
+      out << (o > 0 ? ", " : "") << "\"" << outcomeNames[o] << "\": " << c[k].outcomes[o];
+    out << "},\n";
+    out << "      \"time_histogram_ns\": ";
+    writeHistogram(out, c[k].time_hist);
+    if (c[k].msags > 0) {
+      out << ",\n      \"msag\": {\"count\": " << c[k].msags
+          << ", \"actors\": " << c[k].msag_actors << ", \"channels\": " << c[k].msag_channels
+          << ", \"max_actors\": " << c[k].msag_max_actors << ", \"max_channels\": " << c[k].msag_max_channels
+          << ", \"actors_histogram\": ";
+      writeHistogram(out, c[k].msag_hist);
+      out << "}";
+    }
+    out << "\n    }";
+  }
+  out << "\n  ]\n}\n";
+}
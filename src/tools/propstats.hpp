@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_PROPSTATS_HPP_
+#define TOOLS_PROPSTATS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+
+namespace tools {
+
+/**
+ * @brief Opt-in profiling counters of the custom propagators (dse.prop_profile).
+ *
+ * Each kind of propagator registers once and then counts its calls,
+ * their run times in a log2 histogram, the status they returned and,
+ * for the throughput propagators, the sizes of the MSAGs they analysed.
+ * The counters are global and atomic, so they are shared by all search
+ * threads. Nothing is recorded unless profiling is enabled.
+ *
+ * A profiled propagator registers its kind once in its translation unit
+ * (const size_t profileKind = PropStats::kind("Name") in an anonymous
+ * namespace), keeps its filtering in a protected filter(home, med), and
+ * its propagate() only wraps that call in a PropTimer.
+ */
+class PropStats {
+public:
+  static const size_t max_kinds = 16;
+  static const size_t n_buckets = 40;
+
+  /** Outcomes of a call, from the ExecStatus returned by propagate(). */
+  enum Outcome { SUBSUMED, FAILED, NOFIX, FIX, PARTIAL, N_OUTCOMES };
+
+  static void enable(bool on);
+  static bool enabled();
+  /** Gets the id of the counters of a kind of propagator, registering it on first use. */
+  static size_t kind(const char* name);
+  /** Counts a call of kind that took ns nanoseconds and returned status. */
+  static void call(size_t kind, long long ns, int status);
+  /** Counts an MSAG of the given size built by kind. */
+  static void msag(size_t kind, size_t actors, size_t channels);
+  static void reset();
+  /** Writes all counters of the registered kinds as a JSON object. */
+  static void writeJSON(std::ostream& out);
+
+private:
+  struct Counters {
+    const char* name;
+    std::atomic<unsigned long long> calls;
+    std::atomic<unsigned long long> ns;
+    std::atomic<unsigned long long> outcomes[N_OUTCOMES];
+    std::atomic<unsigned long long> time_hist[n_buckets];  /**< calls by floor(log2(ns)). */
+    std::atomic<unsigned long long> msags;
+    std::atomic<unsigned long long> msag_actors;            /**< sum over all MSAGs. */
+    std::atomic<unsigned long long> msag_channels;          /**< sum over all MSAGs. */
+    std::atomic<unsigned long long> msag_max_actors;
+    std::atomic<unsigned long long> msag_max_channels;
+    std::atomic<unsigned long long> msag_hist[n_buckets];  /**< MSAGs by floor(log2(actors)). */
+  };
+
+  static std::atomic<bool> on;
+  static Counters* counters();
+  static std::atomic<size_t> n_kinds;
+};
+
+/**
+ * @brief Times one call of propagate(), if profiling is enabled.
+ *
+ * Usage: return PropTimer(kind).done(filter(home, med));
+ */
+class PropTimer {
+public:
+  explicit PropTimer(size_t _kind) : kind(_kind), active(PropStats::enabled()) {
+    if (active)
+      start = std::chrono::steady_clock::now();
+  }
+
+  /** Records the call with the status it returned, and passes the status on. */
+  template<class Status> Status done(Status status) {
+    if (active) {
+      auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      PropStats::call(kind, ns, static_cast<int>(status));
+    }
+    return status;
+  }
+
+private:
+  size_t kind;
+  bool active;
+  std::chrono::steady_clock::time_point start;
+};
+
+}
+
+#endif
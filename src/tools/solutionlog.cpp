@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "solutionlog.hpp"
+#include <algorithm>
+#include <chrono>
+
+using namespace tools;
+using namespace std;
+
+namespace {
+  const char magic[8] = {'D', 'S', 'Y', 'D', 'L', 'O', 'G', '1'};
+  const size_t queueCapacity = 4096;
+
+  template<class T> void put(ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template<class T> bool get(ifstream& in, T& value) {
+    return (bool) in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  void putVector(ofstream& out, const vector<int>& v) {
+    put<uint32_t>(out, v.size());
+    for (int x : v)
+      put<int32_t>(out, x);
+  }
+
+  bool getVector(ifstream& in, vector<int>& v) {
+    uint32_t size;
+    if (!get(in, size))
+      return false;
+    v.resize(size);
+    for (uint32_t i = 0; i < size; i++) {
+      int32_t x;
+      if (!get(in, x))
+        return false;
+      v[i] = x;
+    }
+    return true;
+  }
+}
+
+SolutionLogWriter::SolutionLogWriter() : queue(queueCapacity), closing(false) {}
+
+SolutionLogWriter::~SolutionLogWriter() {
+  close();
+}
+
+bool SolutionLogWriter::open(const string& path) {
+  close();
+  file.open(path, ios::binary | ios::trunc);
+  if (!file.is_open())
+    return false;
+  file.write(magic, sizeof(magic));
+  closing = false;
+  writer = thread(&SolutionLogWriter::drain, this);
+  return true;
+}
+
+void SolutionLogWriter::write(SolutionRecord& record) {
+  while (!queue.push(record))
+    this_thread::yield();
+}
+
+void SolutionLogWriter::close() {
+  if (writer.joinable()) {
+    closing = true;
+    writer.join();
+  }
+  if (file.is_open())
+    file.close();
+}
+
+bool SolutionLogWriter::is_open() const {
+  return file.is_open();
+}
+
+void SolutionLogWriter::drain() {
+  SolutionRecord r;
+  while (true) {
+    //checked before popping, so that records queued before close() are written
+    bool last = closing;
+    if (!queue.pop(r)) {
+      if (last)
+        break;
+      this_thread::sleep_for(chrono::milliseconds(1));
+      continue;
+    }
+    put<uint64_t>(file, r.number);
+    put<int64_t>(file, r.time_ms);
+    put<uint64_t>(file, r.node);
+    put<uint64_t>(file, r.fail);
+    put<uint64_t>(file, r.propagate);
+    put<uint64_t>(file, r.depth);
+    put<uint64_t>(file, r.nogood);
+    put<uint32_t>(file, r.design.size());
+    for (const auto& v : r.design)
+      putVector(file, v);
+    putVector(file, r.objectives);
+  }
+  file.flush();
+}
+
+SolutionLogReader::SolutionLogReader(const string& path) : file(path, ios::binary), valid(false) {
+  char header[sizeof(magic)];
+  if (file.read(header, sizeof(header)))
+    valid = equal(header, header + sizeof(header), magic);
+}
+
+bool SolutionLogReader::good() const {
+  return valid;
+}
+
+bool SolutionLogReader::next(SolutionRecord& r) {
+  if (!valid)
+    return false;
+  uint32_t n_vectors;
+  if (!get(file, r.number) || !get(file, r.time_ms) || !get(file, r.node) || !get(file, r.fail)
+      || !get(file, r.propagate) || !get(file, r.depth) || !get(file, r.nogood) || !get(file, n_vectors))
+    return false;
+  r.design.resize(n_vectors);
+  for (auto& v : r.design) {
+    if (!getVector(file, v))
+      return false;
+  }
+  return getVector(file, r.objectives);
+}
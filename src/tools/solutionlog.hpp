@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_SOLUTIONLOG_HPP_
+#define TOOLS_SOLUTIONLOG_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tools {
+
+/**
+ * @brief A solution as written to the binary solution log.
+ *
+ * Holds the decision vectors the solution can be rebuilt from, its
+ * objectives and the search statistics at the time it was found.
+ */
+struct SolutionRecord {
+  uint64_t number;   /**< number of the solution in the search. */
+  int64_t  time_ms;  /**< time since the start of the search. */
+  uint64_t node, fail, propagate, depth, nogood;
+  std::vector<std::vector<int>> design; /**< decision vectors, see SDFPROnlineModel::extractDesign. */
+  std::vector<int> objectives;          /**< see SDFPROnlineModel::extractObjectives. */
+};
+
+/**
+ * @brief Bounded lock-free queue for one producer and one consumer thread.
+ */
+template<class T>
+class SPSCQueue {
+public:
+  explicit SPSCQueue(size_t capacity) : buffer(capacity+1), head(0), tail(0) {}
+
+  /** Moves item into the queue, false if it is full. Producer only. */
+  bool push(T& item) {
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t n = next(t);
+    if (n == head.load(std::memory_order_acquire))
+      return false;
+    buffer[t] = std::move(item);
+    tail.store(n, std::memory_order_release);
+    return true;
+  }
+
+  /** Moves the oldest item out of the queue, false if it is empty. Consumer only. */
+  bool pop(T& item) {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+      return false;
+    item = std::move(buffer[h]);
+    head.store(next(h), std::memory_order_release);
+    return true;
+  }
+
+private:
+  size_t next(size_t i) const { return i+1 == buffer.size() ? 0 : i+1; }
+
+  std::vector<T> buffer;
+  std::atomic<size_t> head; /**< next item to pop. */
+  std::atomic<size_t> tail; /**< next free slot. */
+};
+
+/**
+ * @brief Append-only binary log of solutions, written by its own thread.
+ *
+ * The search thread only moves records into a lock-free queue; a writer
+ * thread drains the queue into the file. The file starts with a magic
+ * string followed by the records, integers in native byte order.
+ */
+class SolutionLogWriter {
+public:
+  SolutionLogWriter();
+  ~SolutionLogWriter();
+
+  /** Opens (truncates) the log and starts the writer thread. */
+  bool open(const std::string& path);
+  /** Queues a record, waiting only while the queue is full. */
+  void write(SolutionRecord& record);
+  /** Writes the queued records, stops the writer thread and closes the log. */
+  void close();
+  bool is_open() const;
+
+private:
+  std::ofstream file;
+  SPSCQueue<SolutionRecord> queue;
+  std::thread writer;
+  std::atomic<bool> closing;
+
+  void drain();
+};
+
+/**
+ * @brief Reads the records of a binary solution log in order.
+ */
+class SolutionLogReader {
+public:
+  /** Opens the log, false from good() if it is missing or not a solution log. */
+  explicit SolutionLogReader(const std::string& path);
+
+  bool good() const;
+  /** Reads the next record, false at the end of the log. */
+  bool next(SolutionRecord& record);
+
+private:
+  std::ifstream file;
+  bool valid;
+};
+
+}
+
+#endif
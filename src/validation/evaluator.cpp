@@ -0,0 +1,294 @@
+#include "evaluator.hpp"
+#include "../system/design.hpp"
+#include "../tools/solutionlog.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+using namespace std;
+using namespace DeSyDe;
+
+namespace {
+  /** Number of designs read, evaluated and written at a time. */
+  const size_t chunkSize = 4096;
+
+  /**
+   * True if the successors form a single circuit through all nodes, as
+   * next, sendNext and recNext do in the CP model.
+   */
+  bool isCircuit(const vector<int>& successors) {
+    vector<char> visited(successors.size(), 0);
+    int x = 0;
+    for (size_t k = 0; k < successors.size(); k++) {
+      if (successors[x] < 0 || successors[x] >= (int)successors.size() || visited[x])
+        return false;
+      visited[x] = 1;
+      x = successors[x];
+    }
+    return x == 0;
+  }
+
+  /**
+   * True if each chain of the n first nodes that ends in dummy node n+j is
+   * continued by the dummy node before it (n+j-1, or n+procs-1 for j=0)
+   * with one of the n first nodes, which is how Design closes the chains.
+   */
+  bool closesChains(const vector<int>& successors, int n, int procs) {
+    for (int i = 0; i < n; i++) {
+      if (successors[i] < n)
+        continue;
+      int dummy = successors[i] > n ? n + (successors[i] - n - 1) % procs : n + procs - 1;
+      if (successors[dummy] >= n)
+        return false;
+    }
+    return true;
+  }
+}
+
+BatchEvaluator::BatchEvaluator(Mapping* _map, Config& _cfg)
+  : map(_map), cfg(_cfg),
+    apps(_map->getApplications(), [](Applications*){}) { //owned by the caller
+
+  no_entities = apps->n_programEntities();
+  no_actors   = apps->n_SDFActors();
+  no_channels = apps->n_SDFchannels();
+  no_procs    = map->getPlatform()->nodes();
+}
+
+vector<size_t> BatchEvaluator::designSizes() const {
+  return {no_entities, no_procs, no_procs, no_actors+no_procs,
+          no_channels+no_procs, no_channels+no_procs};
+}
+
+void BatchEvaluator::splitRow(const vector<int>& row, vector<vector<int>>& design) const {
+  const vector<size_t> sizes = designSizes();
+  size_t parts = 0;
+  if (row.size() == sizes[0] + sizes[1]) {
+    parts = 2;
+  } else {
+    size_t n = 0;
+    for (auto s : sizes)
+      n += s;
+    if (row.size() == n)
+      parts = sizes.size();
+  }
+
+  design.clear();
+  if (parts == 0) {
+    design.push_back(row);
+    return;
+  }
+  auto it = row.begin();
+  for (size_t k = 0; k < parts; k++) {
+    design.emplace_back(it, it + sizes[k]);
+    it += sizes[k];
+  }
+}
+
+void BatchEvaluator::checkRanges(const vector<vector<int>>& design) const {
+  const vector<size_t> sizes = designSizes();
+  bool fits = design.size() == 2 || design.size() == sizes.size();
+  for (size_t k = 0; fits && k < design.size(); k++)
+    fits = design[k].size() == sizes[k];
+  if (!fits)
+    THROW_EXCEPTION(InvalidArgumentException, "the design has neither the size of a complete nor of a mapping-only design");
+
+  auto inRange = [](const vector<int>& values, int lo, int hi) {
+    for (int v : values) {
+      if (v < lo || v > hi)
+        return false;
+    }
+    return true;
+  };
+  Platform* platform = map->getPlatform();
+  if (!inRange(design[0], 0, no_procs-1))
+    THROW_EXCEPTION(InvalidArgumentException, "mapping to a processor that does not exist");
+  for (size_t j = 0; j < no_procs; j++) {
+    if (design[1][j] < 0 || design[1][j] >= (int)platform->getModes(j))
+      THROW_EXCEPTION(InvalidArgumentException, "processor " + tools::toString(j) + " has no mode " + tools::toString(design[1][j]));
+  }
+  if (design.size() == 2)
+    return;
+  if (!inRange(design[2], 0, platform->tdmaSlots()))
+    THROW_EXCEPTION(InvalidArgumentException, "TDMA allocation out of range");
+  if (!isCircuit(design[3]) || !closesChains(design[3], no_actors, no_procs))
+    THROW_EXCEPTION(InvalidArgumentException, "next is not a static-order schedule");
+  if (!isCircuit(design[4]) || !closesChains(design[4], no_channels, no_procs))
+    THROW_EXCEPTION(InvalidArgumentException, "sendNext is not a schedule of the messages");
+  if (!isCircuit(design[5]))
+    THROW_EXCEPTION(InvalidArgumentException, "recNext is not a schedule of the messages");
+}
+
+void BatchEvaluator::evaluate(const vector<vector<int>>& design, shared_ptr<Mapping> mapping, Result& result) const {
+  result.valid       = false;
+  result.schedulable = false;
+  result.complete    = false;
+  result.energy      = 0;
+  result.periods.clear();
+  result.memorySlack.clear();
+  try {
+    checkRanges(design);
+    vector<int> proc  = design[0];
+    vector<int> modes = design[1];
+
+    result.schedulable = true;
+    if (apps->n_IPTTasks() > 0) {
+      mapping->setMappingMode(proc, modes);
+      result.schedulable = mapping->FPSchedulable();
+    }
+
+    result.complete = design.size() > 2 && no_actors > 0;
+    if (result.complete) {
+      //the Design only covers the SDF actors
+      proc.resize(no_actors);
+      Design des(mapping, apps, proc, modes, design[3], design[4], design[5], design[2]);
+      result.periods     = des.get_periods();
+      result.energy      = des.get_energy();
+      result.memorySlack = des.get_slack_memory();
+    }
+    result.valid = true;
+  } catch (DeSyDe::Exception& ex) {
+    result.error = ex.getMessage();
+  } catch (std::exception& ex) {
+    result.error = ex.what();
+  }
+}
+
+void BatchEvaluator::writeHeader(ostream& out) const {
+  out << "design,schedulable,energy";
+  for (size_t i = 0; i < apps->n_SDFApps(); i++)
+    out << ",period_" << i;
+  for (size_t j = 0; j < no_procs; j++)
+    out << ",memorySlack_" << j;
+  out << endl;
+}
+
+void BatchEvaluator::writeResult(ostream& out, size_t number, const Result& result) const {
+  const char sep = ',';
+  out << number << sep;
+  if (!result.valid) {
+    out << "invalid\n";
+    return;
+  }
+  out << result.schedulable << sep;
+  if (result.complete) {
+    out << result.energy;
+    for (auto p : result.periods)
+      out << sep << p;
+    for (auto s : result.memorySlack)
+      out << sep << s;
+  } else {
+    //mapping-only design: no periods, energy or memory slack
+    out << string(apps->n_SDFApps() + no_procs, sep);
+  }
+  out << '\n';
+}
+
+size_t BatchEvaluator::run(const string& path) {
+  typedef chrono::steady_clock timer;
+  const auto start = timer::now();
+
+  //a binary solution log, otherwise a CSV file
+  tools::SolutionLogReader log(path);
+  ifstream csv;
+  if (!log.good()) {
+    csv.open(path);
+    if (!csv.is_open())
+      THROW_EXCEPTION(IOException, path, "cannot read the designs");
+  }
+  size_t line = 0;
+  auto nextDesign = [&](vector<vector<int>>& design) -> bool {
+    if (log.good()) {
+      tools::SolutionRecord record;
+      if (!log.next(record))
+        return false;
+      design = move(record.design);
+      return true;
+    }
+    string row;
+    while (getline(csv, row)) {
+      line++;
+      vector<int> values;
+      bool numeric = true;
+      for (const auto& field : tools::split(row, ',')) {
+        if (field.find_first_not_of(" \t\r") == string::npos)
+          continue;
+        char* end;
+        long value = strtol(field.c_str(), &end, 10);
+        if (end == field.c_str() || string(end).find_first_not_of(" \t\r") != string::npos) {
+          numeric = false;
+          break;
+        }
+        values.push_back(value);
+      }
+      //skips headers, comments and empty lines
+      if (!numeric || values.empty()) {
+        LOG_DEBUG("Skipping line " + tools::toString(line) + " of " + path);
+        continue;
+      }
+      splitRow(values, design);
+      return true;
+    }
+    return false;
+  };
+
+  const string out_path = cfg.settings().output_path + "out/evaluated.csv";
+  ofstream out(out_path);
+  if (!out.is_open())
+    THROW_EXCEPTION(IOException, out_path, "cannot write the results");
+  writeHeader(out);
+
+  //Mapping::FPSchedulable changes the mapping (current mapping and its cache)
+  const size_t n_workers = max(1u, thread::hardware_concurrency());
+  vector<shared_ptr<Mapping>> mappings;
+  for (size_t w = 0; w < n_workers; w++)
+    mappings.push_back(make_shared<Mapping>(*map));
+
+  size_t n_designs = 0, n_schedulable = 0, n_invalid = 0;
+  vector<vector<vector<int>>> designs;
+  vector<Result> results;
+  vector<vector<int>> design;
+  while (true) {
+    designs.clear();
+    while (designs.size() < chunkSize && nextDesign(design))
+      designs.push_back(move(design));
+    if (designs.empty())
+      break;
+
+    results.resize(designs.size());
+    atomic<size_t> next(0);
+    vector<thread> workers;
+    for (size_t w = 0; w < min(n_workers, designs.size()); w++) {
+      workers.emplace_back([&, w]() {
+        for (size_t i = next++; i < designs.size(); i = next++)
+          evaluate(designs[i], mappings[w], results[i]);
+      });
+    }
+    for (auto& worker : workers)
+      worker.join();
+
+    for (size_t i = 0; i < designs.size(); i++) {
+      writeResult(out, n_designs + i, results[i]);
+      if (!results[i].valid) {
+        n_invalid++;
+        LOG_WARNING("Design " + tools::toString(n_designs + i) + " is invalid: " + results[i].error);
+      } else if (results[i].schedulable) {
+        n_schedulable++;
+      }
+    }
+    out.flush();
+    n_designs += designs.size();
+    LOG_INFO("Evaluated " + tools::toString(n_designs) + " designs ...");
+  }
+  out.close();
+
+  const double seconds = chrono::duration<double>(timer::now() - start).count();
+  cout << "Evaluated " << n_designs << " designs (" << n_schedulable << " schedulable, "
+       << n_invalid << " invalid) on " << n_workers << " threads in " << seconds << " s: "
+       << (seconds > 0 ? n_designs / seconds : 0) << " designs/s" << endl;
+  cout << "Results written to " << out_path << endl;
+  return n_designs;
+}
@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2013-2016, George Ungureanu <ugeorge@kth.se>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef __EVALUATOR__
+#define __EVALUATOR__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../settings/config.hpp"
+#include "../system/mapping.hpp"
+
+using namespace std;
+
+/**
+ * Evaluates a batch of complete designs against the loaded problem, e.g.
+ * the solutions of earlier runs under new WCETs (adse --evaluate).
+ *
+ * The designs are read from a binary solution log (out/out.bin) or from a
+ * CSV file with one design per line, in the order of the solution log:
+ * mapping of all actors and tasks, processor modes, TDMA slots per processor,
+ * next, sendNext and recNext. Rows with only the mapping and the modes (as in
+ * out/out_mapping.csv) are only checked for schedulability.
+ *
+ * The periods, energy and memory slack of a design come from a Design, the
+ * schedulability of the periodic tasks from Mapping::FPSchedulable. Designs
+ * are evaluated in chunks by one thread per core, each with its own copy of
+ * the mapping, and the results of each chunk are appended to
+ * out/evaluated.csv in input order.
+ */
+class BatchEvaluator {
+public:
+  BatchEvaluator(Mapping* _map, Config& cfg);
+
+  /**
+   * Evaluates all designs in path and writes their results.
+   * @return number of evaluated designs
+   */
+  size_t run(const string& path);
+
+private:
+  struct Result {
+    bool        valid;
+    bool        schedulable;
+    bool        complete;     /*!< false for mapping-only designs. */
+    vector<int> periods;
+    int         energy;
+    vector<int> memorySlack;
+    string      error;
+  };
+
+  Mapping* map;
+  Config&  cfg;
+  shared_ptr<Applications> apps;
+  size_t no_entities; /**< Number of actors and periodic tasks. */
+  size_t no_actors;
+  size_t no_channels;
+  size_t no_procs;
+
+  /** Sizes of the vectors of a complete design, in the order of the solution log. */
+  vector<size_t> designSizes() const;
+
+  /**
+   * Splits a CSV row into the vectors of a design. A row that is neither a
+   * complete nor a mapping-only design is kept as a single vector, which
+   * checkRanges rejects.
+   */
+  void splitRow(const vector<int>& row, vector<vector<int>>& design) const;
+
+  /**
+   * Evaluates one design with the given (thread-local) copy of the mapping.
+   */
+  void evaluate(const vector<vector<int>>& design, shared_ptr<Mapping> mapping, Result& result) const;
+
+  /**
+   * Throws an InvalidArgumentException if a value of the design is out of
+   * range or the orders are not circuits as in the CP model.
+   */
+  void checkRanges(const vector<vector<int>>& design) const;
+
+  void writeHeader(ostream& out) const;
+  void writeResult(ostream& out, size_t number, const Result& result) const;
+};
+
+#endif
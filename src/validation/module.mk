@@ -28,7 +28,7 @@
 # MODULE PATH AND FILES
 #=======================
 
-CPP_FILES := validation.cpp 
+CPP_FILES := validation.cpp evaluator.cpp
 
 
 